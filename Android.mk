@@ -59,18 +59,30 @@ LOCAL_C_INCLUDES := \
 
 LOCAL_SRC_FILES := \
     src/waffle/core/wcore_tinfo.c \
+    src/waffle/core/wcore_caps_cache.c \
     src/waffle/core/wcore_config_attrs.c \
+    src/waffle/core/wcore_config_cache.c \
+    src/waffle/core/wcore_config_rank.c \
+    src/waffle/core/wcore_context_future.c \
+    src/waffle/core/wcore_context_pool.c \
     src/waffle/core/wcore_error.c \
+    src/waffle/core/wcore_executor.c \
     src/waffle/core/wcore_util.c \
     src/waffle/core/wcore_display.c \
     src/waffle/core/wcore_attrib_list.c \
+    src/waffle/core/wcore_frame_limiter.c \
+    src/waffle/core/wcore_present.c \
+    src/waffle/core/wcore_worker.c \
     src/waffle/api/api_priv.c \
     src/waffle/api/waffle_attrib_list.c \
     src/waffle/api/waffle_config.c \
     src/waffle/api/waffle_context.c \
+    src/waffle/api/waffle_context_pool.c \
     src/waffle/api/waffle_display.c \
     src/waffle/api/waffle_enum.c \
     src/waffle/api/waffle_error.c \
+    src/waffle/api/waffle_executor.c \
+    src/waffle/api/waffle_fence.c \
     src/waffle/api/waffle_gl_misc.c \
     src/waffle/api/waffle_init.c \
     src/waffle/api/waffle_window.c \
@@ -80,6 +92,7 @@ LOCAL_SRC_FILES := \
     src/waffle/egl/wegl_config.c \
     src/waffle/egl/wegl_context.c \
     src/waffle/egl/wegl_display.c \
+    src/waffle/egl/wegl_fence.c \
     src/waffle/egl/wegl_platform.c \
     src/waffle/egl/wegl_util.c \
     src/waffle/egl/wegl_surface.c \
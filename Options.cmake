@@ -24,6 +24,7 @@ if(waffle_on_linux)
     endif()
 
     set(surfaceless_egl_default ${egl_FOUND})
+    set(egl_device_default ${egl_FOUND})
 
     # On Linux, you must enable at least one of the below options.
     option(waffle_has_glx "Build support for GLX" ${glx_default})
@@ -31,6 +32,7 @@ if(waffle_on_linux)
     option(waffle_has_x11_egl "Build support for X11/EGL" ${x11_egl_default})
     option(waffle_has_gbm "Build support for GBM" ${gbm_default})
     option(waffle_has_surfaceless_egl "Build support for EGL_MESA_platform_surfaceless" ${surfaceless_egl_default})
+    option(waffle_has_egl_device "Build support for EGL_EXT_platform_device" ${egl_device_default})
     option(waffle_has_nacl "Build support for NaCl" OFF)
 
     # NaCl specific settings.
@@ -128,6 +128,10 @@ if(waffle_on_linux)
         add_definitions(-DWAFFLE_HAS_SURFACELESS_EGL)
     endif()
 
+    if(waffle_has_egl_device)
+        add_definitions(-DWAFFLE_HAS_EGL_DEVICE)
+    endif()
+
     if(waffle_has_tls)
         add_definitions(-DWAFFLE_HAS_TLS)
     endif()
@@ -50,6 +50,9 @@ endif()
 if(waffle_has_surfaceless_egl)
     message("    surfaceless_egl")
 endif()
+if(waffle_has_egl_device)
+    message("    egl_device")
+endif()
 if(waffle_on_windows)
     message("    wgl")
 endif()
@@ -48,12 +48,14 @@ if(waffle_on_linux)
     if(NOT waffle_has_glx AND NOT waffle_has_wayland AND
        NOT waffle_has_x11_egl AND NOT waffle_has_gbm AND
        NOT waffle_has_surfaceless_egl AND
+       NOT waffle_has_egl_device AND
        NOT waffle_has_nacl)
         message(FATAL_ERROR
                 "Must enable at least one of: "
                 "waffle_has_glx, waffle_has_wayland, "
                 "waffle_has_x11_egl, waffle_has_gbm, "
                 "waffle_has_surfaceless_egl, "
+                "waffle_has_egl_device, "
                 "waffle_has_nacl")
     endif()
     if(waffle_has_nacl)
@@ -156,6 +158,11 @@ if(waffle_on_linux)
             message(FATAL_ERROR "surfaceless_egl dependency is missing: egl")
         endif()
     endif()
+    if(waffle_has_egl_device)
+        if(NOT egl_FOUND)
+            message(FATAL_ERROR "egl_device dependency is missing: egl")
+        endif()
+    endif()
 elseif(waffle_on_mac)
     if(waffle_has_gbm)
         message(FATAL_ERROR "Option is not supported on Darwin: waffle_has_gbm.")
@@ -172,6 +179,9 @@ elseif(waffle_on_mac)
     if(waffle_has_surfaceless_egl)
         message(FATAL_ERROR "Option is not supported on Darwin: waffle_has_surfaceless_egl.")
     endif()
+    if(waffle_has_egl_device)
+        message(FATAL_ERROR "Option is not supported on Darwin: waffle_has_egl_device.")
+    endif()
 elseif(waffle_on_windows)
     if(waffle_has_gbm)
         message(FATAL_ERROR "Option is not supported on Windows: waffle_has_gbm.")
@@ -188,4 +198,7 @@ elseif(waffle_on_windows)
     if(waffle_has_surfaceless_egl)
         message(FATAL_ERROR "Option is not supported on windows: waffle_has_surfaceless_egl.")
     endif()
+    if(waffle_has_egl_device)
+        message(FATAL_ERROR "Option is not supported on Windows: waffle_has_egl_device.")
+    endif()
 endif()
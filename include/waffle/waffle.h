@@ -52,7 +52,13 @@ extern "C" {
 
 struct waffle_display;
 struct waffle_config;
+struct waffle_gl_dispatch;
 struct waffle_context;
+struct waffle_context_future;
+struct waffle_context_pool;
+struct waffle_executor;
+struct waffle_executor_future;
+struct waffle_fence;
 struct waffle_window;
 
 union waffle_native_display;
@@ -121,6 +127,11 @@ enum waffle_enum {
         WAFFLE_PLATFORM_NACL                                    = 0x0018,
         WAFFLE_PLATFORM_SURFACELESS_EGL                         = 0x0019,
         WAFFLE_PLATFORM_QNX                                     = 0x001a,
+        WAFFLE_PLATFORM_EGL_DEVICE                              = 0x001b,
+
+    WAFFLE_VALIDATE_MAKE_CURRENT                                = 0x0020,
+    WAFFLE_GL_DISPATCH                                          = 0x0021,
+    WAFFLE_CAPABILITY_CACHE                                     = 0x0022,
 
     // ------------------------------------------------------------------
     // For waffle_config_choose()
@@ -142,6 +153,16 @@ enum waffle_enum {
     WAFFLE_CONTEXT_FORWARD_COMPATIBLE                           = 0x0215,
     WAFFLE_CONTEXT_DEBUG                                        = 0x0216,
     WAFFLE_CONTEXT_ROBUST_ACCESS                                = 0x0217,
+    WAFFLE_CONTEXT_NO_ERROR                                     = 0x0218,
+
+    WAFFLE_CONTEXT_RELEASE_BEHAVIOR                             = 0x0219,
+        WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH                   = 0x021a,
+        WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE                    = 0x021b,
+
+    WAFFLE_CONTEXT_PRIORITY                                     = 0x021c,
+        WAFFLE_CONTEXT_PRIORITY_LOW                             = 0x021d,
+        WAFFLE_CONTEXT_PRIORITY_MEDIUM                          = 0x021e,
+        WAFFLE_CONTEXT_PRIORITY_HIGH                            = 0x021f,
 
     WAFFLE_RED_SIZE                                             = 0x0201,
     WAFFLE_GREEN_SIZE                                           = 0x0202,
@@ -158,6 +179,14 @@ enum waffle_enum {
 
     WAFFLE_ACCUM_BUFFER                                         = 0x0213,
 
+    WAFFLE_NO_CONFIG                                            = 0x0220,
+
+    WAFFLE_CONFIG_RANKING                                       = 0x0221,
+        WAFFLE_CONFIG_PREFER_NATIVE_ORDER                       = 0x0222,
+        WAFFLE_CONFIG_PREFER_SMALLEST                           = 0x0223,
+
+    WAFFLE_SAMPLES_FALLBACK                                     = 0x0224,
+
     // ------------------------------------------------------------------
     // For waffle_dl_sym()
     // ------------------------------------------------------------------
@@ -174,6 +203,62 @@ enum waffle_enum {
     WAFFLE_WINDOW_WIDTH                                         = 0x0310,
     WAFFLE_WINDOW_HEIGHT                                        = 0x0311,
     WAFFLE_WINDOW_FULLSCREEN                                    = 0x0312,
+    WAFFLE_WINDOW_FRAME_PACING                                  = 0x0313,
+    WAFFLE_WINDOW_SWAP_INTERVAL                                 = 0x0314,
+    WAFFLE_WINDOW_SURFACELESS                                   = 0x0315,
+    WAFFLE_WINDOW_ASYNC_PRESENT                                 = 0x0316,
+    WAFFLE_WINDOW_PRESENT_QUEUE_DEPTH                           = 0x0317,
+    WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT                          = 0x0318,
+
+    // ------------------------------------------------------------------
+    // For waffle_window_query()
+    // ------------------------------------------------------------------
+
+    WAFFLE_WINDOW_FRAMES_PRESENTED                              = 0x0320,
+    WAFFLE_WINDOW_FRAMES_DELAYED                                = 0x0321,
+    WAFFLE_WINDOW_FRAMES_DROPPED                                = 0x0322,
+    WAFFLE_WINDOW_FRAMEBUFFER                                   = 0x0323,
+
+    // ------------------------------------------------------------------
+    // For waffle_display_query()
+    // ------------------------------------------------------------------
+
+    WAFFLE_DISPLAY_DEVICE_COUNT                                 = 0x0400,
+    WAFFLE_DISPLAY_DEVICE_INDEX                                 = 0x0401,
+    WAFFLE_DISPLAY_DEVICE_SOFTWARE                              = 0x0402,
+    WAFFLE_DISPLAY_DEVICE_DRM_FILE                              = 0x0403,
+    WAFFLE_DISPLAY_DEVICE_DRM_RENDER_NODE_FILE                  = 0x0404,
+    WAFFLE_DISPLAY_DEVICE_EXTENSIONS                            = 0x0405,
+
+    // ------------------------------------------------------------------
+    // For waffle_display_query_renderer()
+    // ------------------------------------------------------------------
+
+    WAFFLE_RENDERER_VENDOR_ID                                   = 0x0410,
+    WAFFLE_RENDERER_DEVICE_ID                                   = 0x0411,
+    WAFFLE_RENDERER_VIDEO_MEMORY                                = 0x0412,
+    WAFFLE_RENDERER_ACCELERATED                                 = 0x0413,
+    WAFFLE_RENDERER_OPENGL_CORE_PROFILE_VERSION                 = 0x0414,
+    WAFFLE_RENDERER_OPENGL_COMPATIBILITY_PROFILE_VERSION        = 0x0415,
+    WAFFLE_RENDERER_OPENGL_ES_PROFILE_VERSION                   = 0x0416,
+    WAFFLE_RENDERER_OPENGL_ES2_PROFILE_VERSION                  = 0x0417,
+
+    // ------------------------------------------------------------------
+    // For waffle_context_pool
+    // ------------------------------------------------------------------
+
+    WAFFLE_CONTEXT_POOL_PREWARM                                 = 0x0500,
+    WAFFLE_CONTEXT_POOL_MAX                                     = 0x0501,
+    WAFFLE_CONTEXT_POOL_SIZE                                    = 0x0502,
+    WAFFLE_CONTEXT_POOL_AVAILABLE                               = 0x0503,
+    WAFFLE_CONTEXT_POOL_HITS                                    = 0x0504,
+    WAFFLE_CONTEXT_POOL_MISSES                                  = 0x0505,
+
+    // ------------------------------------------------------------------
+    // For waffle_executor
+    // ------------------------------------------------------------------
+
+    WAFFLE_EXECUTOR_THREADS                                     = 0x0510,
 };
 
 const char*
@@ -203,11 +288,24 @@ waffle_get_current_window(void);
 
 struct waffle_context *
 waffle_get_current_context(void);
+
+const struct waffle_gl_dispatch *
+waffle_get_current_dispatch(void);
+
+uint64_t
+waffle_get_elided_make_current_count(void);
 #endif
 
 void*
 waffle_get_proc_address(const char *name);
 
+#if WAFFLE_API_VERSION >= 0x0106
+bool
+waffle_get_proc_address_batch(size_t count,
+                              const char *const names[],
+                              void *procs[]);
+#endif
+
 bool
 waffle_is_extension_in_string(const char *extension_string,
                               const char *extension_name);
@@ -229,6 +327,29 @@ waffle_display_supports_context_api(struct waffle_display *self,
 union waffle_native_display*
 waffle_display_get_native(struct waffle_display *self);
 
+#if WAFFLE_API_VERSION >= 0x0106
+bool
+waffle_display_has_extension(struct waffle_display *self,
+                             const char *name);
+
+bool
+waffle_display_query(struct waffle_display *self,
+                     int32_t attrib,
+                     intptr_t *value);
+
+bool
+waffle_display_query_capability(struct waffle_display *self,
+                                int32_t context_api,
+                                int32_t context_profile,
+                                int32_t attrib,
+                                intptr_t *value);
+
+bool
+waffle_display_query_renderer(struct waffle_display *self,
+                              int32_t attrib,
+                              intptr_t *value);
+#endif
+
 // ---------------------------------------------------------------------------
 // waffle_config
 // ---------------------------------------------------------------------------
@@ -243,6 +364,22 @@ waffle_config_destroy(struct waffle_config *self);
 union waffle_native_config*
 waffle_config_get_native(struct waffle_config *self);
 
+#if WAFFLE_API_VERSION >= 0x0106
+bool
+waffle_config_enumerate(
+        struct waffle_display *dpy,
+        const int32_t attrib_list[],
+        struct waffle_config *configs[],
+        int32_t max_configs,
+        int32_t *num_configs);
+
+bool
+waffle_config_query(
+        struct waffle_config *self,
+        int32_t attrib,
+        intptr_t *value);
+#endif
+
 // ---------------------------------------------------------------------------
 // waffle_context
 // ---------------------------------------------------------------------------
@@ -257,6 +394,101 @@ waffle_context_destroy(struct waffle_context *self);
 union waffle_native_context*
 waffle_context_get_native(struct waffle_context *self);
 
+#if WAFFLE_API_VERSION >= 0x0106
+bool
+waffle_context_query(
+        struct waffle_context *self,
+        int32_t attrib,
+        intptr_t *value);
+
+struct waffle_context_future*
+waffle_context_create_async(struct waffle_config *config,
+                            struct waffle_context *shared_ctx);
+
+bool
+waffle_context_future_is_ready(struct waffle_context_future *self);
+
+struct waffle_context*
+waffle_context_future_wait(struct waffle_context_future *self);
+#endif
+
+// ---------------------------------------------------------------------------
+// waffle_context_pool
+// ---------------------------------------------------------------------------
+
+#if WAFFLE_API_VERSION >= 0x0106
+struct waffle_context_pool*
+waffle_context_pool_create(struct waffle_config *config,
+                           struct waffle_context *shared_ctx,
+                           const intptr_t attrib_list[]);
+
+bool
+waffle_context_pool_destroy(struct waffle_context_pool *self);
+
+struct waffle_context*
+waffle_context_pool_checkout(struct waffle_context_pool *self);
+
+bool
+waffle_context_pool_return(struct waffle_context_pool *self,
+                           struct waffle_context *ctx);
+
+bool
+waffle_context_pool_query(struct waffle_context_pool *self,
+                          int32_t attrib,
+                          intptr_t *value);
+#endif
+
+// ---------------------------------------------------------------------------
+// waffle_executor
+// ---------------------------------------------------------------------------
+
+#if WAFFLE_API_VERSION >= 0x0106
+struct waffle_executor*
+waffle_executor_create(struct waffle_config *config,
+                       struct waffle_context *shared_ctx,
+                       const intptr_t attrib_list[]);
+
+bool
+waffle_executor_destroy(struct waffle_executor *self);
+
+struct waffle_executor_future*
+waffle_executor_submit(struct waffle_executor *self,
+                       bool (*func)(void *data),
+                       void *data);
+
+bool
+waffle_executor_future_is_ready(struct waffle_executor_future *self);
+
+bool
+waffle_executor_future_wait(struct waffle_executor_future *self);
+#endif
+
+// ---------------------------------------------------------------------------
+// waffle_fence
+// ---------------------------------------------------------------------------
+
+#if WAFFLE_API_VERSION >= 0x0106
+struct waffle_fence*
+waffle_fence_create(struct waffle_context *ctx);
+
+bool
+waffle_fence_destroy(struct waffle_fence *self);
+
+bool
+waffle_fence_client_wait(struct waffle_fence *self,
+                         uint64_t timeout,
+                         bool *signaled);
+
+bool
+waffle_fence_server_wait(struct waffle_fence *self);
+
+bool
+waffle_fence_export_fd(struct waffle_fence *self, int *fd);
+
+struct waffle_fence*
+waffle_fence_import_fd(struct waffle_context *ctx, int fd);
+#endif
+
 // ---------------------------------------------------------------------------
 // waffle_window
 // ---------------------------------------------------------------------------
@@ -286,6 +518,36 @@ waffle_window_swap_buffers(struct waffle_window *self);
 union waffle_native_window*
 waffle_window_get_native(struct waffle_window *self);
 
+#if WAFFLE_API_VERSION >= 0x0106
+bool
+waffle_window_set_swap_interval(
+        struct waffle_window *self,
+        int32_t interval);
+
+bool
+waffle_window_query(
+        struct waffle_window *self,
+        int32_t attrib,
+        intptr_t *value);
+
+bool
+waffle_window_swap_buffers_with_damage(
+        struct waffle_window *self,
+        const int32_t *rects,
+        int32_t n_rects);
+
+bool
+waffle_window_get_buffer_age(
+        struct waffle_window *self,
+        int32_t *age);
+
+bool
+waffle_window_set_damage_region(
+        struct waffle_window *self,
+        const int32_t *rects,
+        int32_t n_rects);
+#endif
+
 #if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
 bool
 waffle_window_resize(
@@ -304,6 +566,14 @@ waffle_dl_can_open(int32_t dl);
 void*
 waffle_dl_sym(int32_t dl, const char *name);
 
+#if WAFFLE_API_VERSION >= 0x0106
+bool
+waffle_dl_sym_batch(int32_t dl,
+                    size_t count,
+                    const char *const names[],
+                    void *syms[]);
+#endif
+
 // ---------------------------------------------------------------------------
 // waffle_native
 // ---------------------------------------------------------------------------
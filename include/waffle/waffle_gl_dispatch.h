@@ -0,0 +1,748 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @file
+/// @brief Per-context table of GL and GLES entry points.
+///
+/// Enable the table with the waffle_init() attribute WAFFLE_GL_DISPATCH.
+/// Waffle then fills a context's table the first time the context is made
+/// current, and waffle_get_current_dispatch() returns the table of the
+/// thread's current context.
+///
+/// The table covers the core profile of OpenGL 1.0 through 4.6, following
+/// the GL_VERSION_* sections of Khronos's glcorearb.h, plus the entry points
+/// that OpenGL ES 3.2 adds. OpenGL ES 2.0 through 3.2 are subsets of it.
+/// Members are named without the "gl" prefix, so glClear is `Clear`.
+/// An entry point that could not be resolved is null. As with
+/// waffle_get_proc_address(), a non-null entry point is not proof that the
+/// context supports it; check the context's version and extensions.
+///
+/// The members are untyped. Cast them to the types from your GL headers:
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.c}
+/// const struct waffle_gl_dispatch *gl = waffle_get_current_dispatch();
+/// ((PFNGLCLEARPROC) gl->Clear)(GL_COLOR_BUFFER_BIT);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// WAFFLE_GL_DISPATCH_ENTRY_POINTS(X) expands X(name) once per member, which
+/// lets applications generate typed wrappers from the same list.
+
+#define WAFFLE_GL_DISPATCH_ENTRY_POINTS(X) \
+    /* OpenGL 1.0 */ \
+    X(CullFace) \
+    X(FrontFace) \
+    X(Hint) \
+    X(LineWidth) \
+    X(PointSize) \
+    X(PolygonMode) \
+    X(Scissor) \
+    X(TexParameterf) \
+    X(TexParameterfv) \
+    X(TexParameteri) \
+    X(TexParameteriv) \
+    X(TexImage1D) \
+    X(TexImage2D) \
+    X(DrawBuffer) \
+    X(Clear) \
+    X(ClearColor) \
+    X(ClearStencil) \
+    X(ClearDepth) \
+    X(StencilMask) \
+    X(ColorMask) \
+    X(DepthMask) \
+    X(Disable) \
+    X(Enable) \
+    X(Finish) \
+    X(Flush) \
+    X(BlendFunc) \
+    X(LogicOp) \
+    X(StencilFunc) \
+    X(StencilOp) \
+    X(DepthFunc) \
+    X(PixelStoref) \
+    X(PixelStorei) \
+    X(ReadBuffer) \
+    X(ReadPixels) \
+    X(GetBooleanv) \
+    X(GetDoublev) \
+    X(GetError) \
+    X(GetFloatv) \
+    X(GetIntegerv) \
+    X(GetString) \
+    X(GetTexImage) \
+    X(GetTexParameterfv) \
+    X(GetTexParameteriv) \
+    X(GetTexLevelParameterfv) \
+    X(GetTexLevelParameteriv) \
+    X(IsEnabled) \
+    X(DepthRange) \
+    X(Viewport) \
+    /* OpenGL 1.1 */ \
+    X(DrawArrays) \
+    X(DrawElements) \
+    X(GetPointerv) \
+    X(PolygonOffset) \
+    X(CopyTexImage1D) \
+    X(CopyTexImage2D) \
+    X(CopyTexSubImage1D) \
+    X(CopyTexSubImage2D) \
+    X(TexSubImage1D) \
+    X(TexSubImage2D) \
+    X(BindTexture) \
+    X(DeleteTextures) \
+    X(GenTextures) \
+    X(IsTexture) \
+    /* OpenGL 1.2 */ \
+    X(DrawRangeElements) \
+    X(TexImage3D) \
+    X(TexSubImage3D) \
+    X(CopyTexSubImage3D) \
+    /* OpenGL 1.3 */ \
+    X(ActiveTexture) \
+    X(SampleCoverage) \
+    X(CompressedTexImage3D) \
+    X(CompressedTexImage2D) \
+    X(CompressedTexImage1D) \
+    X(CompressedTexSubImage3D) \
+    X(CompressedTexSubImage2D) \
+    X(CompressedTexSubImage1D) \
+    X(GetCompressedTexImage) \
+    /* OpenGL 1.4 */ \
+    X(BlendFuncSeparate) \
+    X(MultiDrawArrays) \
+    X(MultiDrawElements) \
+    X(PointParameterf) \
+    X(PointParameterfv) \
+    X(PointParameteri) \
+    X(PointParameteriv) \
+    X(BlendColor) \
+    X(BlendEquation) \
+    /* OpenGL 1.5 */ \
+    X(GenQueries) \
+    X(DeleteQueries) \
+    X(IsQuery) \
+    X(BeginQuery) \
+    X(EndQuery) \
+    X(GetQueryiv) \
+    X(GetQueryObjectiv) \
+    X(GetQueryObjectuiv) \
+    X(BindBuffer) \
+    X(DeleteBuffers) \
+    X(GenBuffers) \
+    X(IsBuffer) \
+    X(BufferData) \
+    X(BufferSubData) \
+    X(GetBufferSubData) \
+    X(MapBuffer) \
+    X(UnmapBuffer) \
+    X(GetBufferParameteriv) \
+    X(GetBufferPointerv) \
+    /* OpenGL 2.0 */ \
+    X(BlendEquationSeparate) \
+    X(DrawBuffers) \
+    X(StencilOpSeparate) \
+    X(StencilFuncSeparate) \
+    X(StencilMaskSeparate) \
+    X(AttachShader) \
+    X(BindAttribLocation) \
+    X(CompileShader) \
+    X(CreateProgram) \
+    X(CreateShader) \
+    X(DeleteProgram) \
+    X(DeleteShader) \
+    X(DetachShader) \
+    X(DisableVertexAttribArray) \
+    X(EnableVertexAttribArray) \
+    X(GetActiveAttrib) \
+    X(GetActiveUniform) \
+    X(GetAttachedShaders) \
+    X(GetAttribLocation) \
+    X(GetProgramiv) \
+    X(GetProgramInfoLog) \
+    X(GetShaderiv) \
+    X(GetShaderInfoLog) \
+    X(GetShaderSource) \
+    X(GetUniformLocation) \
+    X(GetUniformfv) \
+    X(GetUniformiv) \
+    X(GetVertexAttribdv) \
+    X(GetVertexAttribfv) \
+    X(GetVertexAttribiv) \
+    X(GetVertexAttribPointerv) \
+    X(IsProgram) \
+    X(IsShader) \
+    X(LinkProgram) \
+    X(ShaderSource) \
+    X(UseProgram) \
+    X(Uniform1f) \
+    X(Uniform2f) \
+    X(Uniform3f) \
+    X(Uniform4f) \
+    X(Uniform1i) \
+    X(Uniform2i) \
+    X(Uniform3i) \
+    X(Uniform4i) \
+    X(Uniform1fv) \
+    X(Uniform2fv) \
+    X(Uniform3fv) \
+    X(Uniform4fv) \
+    X(Uniform1iv) \
+    X(Uniform2iv) \
+    X(Uniform3iv) \
+    X(Uniform4iv) \
+    X(UniformMatrix2fv) \
+    X(UniformMatrix3fv) \
+    X(UniformMatrix4fv) \
+    X(ValidateProgram) \
+    X(VertexAttrib1d) \
+    X(VertexAttrib1dv) \
+    X(VertexAttrib1f) \
+    X(VertexAttrib1fv) \
+    X(VertexAttrib1s) \
+    X(VertexAttrib1sv) \
+    X(VertexAttrib2d) \
+    X(VertexAttrib2dv) \
+    X(VertexAttrib2f) \
+    X(VertexAttrib2fv) \
+    X(VertexAttrib2s) \
+    X(VertexAttrib2sv) \
+    X(VertexAttrib3d) \
+    X(VertexAttrib3dv) \
+    X(VertexAttrib3f) \
+    X(VertexAttrib3fv) \
+    X(VertexAttrib3s) \
+    X(VertexAttrib3sv) \
+    X(VertexAttrib4Nbv) \
+    X(VertexAttrib4Niv) \
+    X(VertexAttrib4Nsv) \
+    X(VertexAttrib4Nub) \
+    X(VertexAttrib4Nubv) \
+    X(VertexAttrib4Nuiv) \
+    X(VertexAttrib4Nusv) \
+    X(VertexAttrib4bv) \
+    X(VertexAttrib4d) \
+    X(VertexAttrib4dv) \
+    X(VertexAttrib4f) \
+    X(VertexAttrib4fv) \
+    X(VertexAttrib4iv) \
+    X(VertexAttrib4s) \
+    X(VertexAttrib4sv) \
+    X(VertexAttrib4ubv) \
+    X(VertexAttrib4uiv) \
+    X(VertexAttrib4usv) \
+    X(VertexAttribPointer) \
+    /* OpenGL 2.1 */ \
+    X(UniformMatrix2x3fv) \
+    X(UniformMatrix3x2fv) \
+    X(UniformMatrix2x4fv) \
+    X(UniformMatrix4x2fv) \
+    X(UniformMatrix3x4fv) \
+    X(UniformMatrix4x3fv) \
+    /* OpenGL 3.0 */ \
+    X(ColorMaski) \
+    X(GetBooleani_v) \
+    X(GetIntegeri_v) \
+    X(Enablei) \
+    X(Disablei) \
+    X(IsEnabledi) \
+    X(BeginTransformFeedback) \
+    X(EndTransformFeedback) \
+    X(BindBufferRange) \
+    X(BindBufferBase) \
+    X(TransformFeedbackVaryings) \
+    X(GetTransformFeedbackVarying) \
+    X(ClampColor) \
+    X(BeginConditionalRender) \
+    X(EndConditionalRender) \
+    X(VertexAttribIPointer) \
+    X(GetVertexAttribIiv) \
+    X(GetVertexAttribIuiv) \
+    X(VertexAttribI1i) \
+    X(VertexAttribI2i) \
+    X(VertexAttribI3i) \
+    X(VertexAttribI4i) \
+    X(VertexAttribI1ui) \
+    X(VertexAttribI2ui) \
+    X(VertexAttribI3ui) \
+    X(VertexAttribI4ui) \
+    X(VertexAttribI1iv) \
+    X(VertexAttribI2iv) \
+    X(VertexAttribI3iv) \
+    X(VertexAttribI4iv) \
+    X(VertexAttribI1uiv) \
+    X(VertexAttribI2uiv) \
+    X(VertexAttribI3uiv) \
+    X(VertexAttribI4uiv) \
+    X(VertexAttribI4bv) \
+    X(VertexAttribI4sv) \
+    X(VertexAttribI4ubv) \
+    X(VertexAttribI4usv) \
+    X(GetUniformuiv) \
+    X(BindFragDataLocation) \
+    X(GetFragDataLocation) \
+    X(Uniform1ui) \
+    X(Uniform2ui) \
+    X(Uniform3ui) \
+    X(Uniform4ui) \
+    X(Uniform1uiv) \
+    X(Uniform2uiv) \
+    X(Uniform3uiv) \
+    X(Uniform4uiv) \
+    X(TexParameterIiv) \
+    X(TexParameterIuiv) \
+    X(GetTexParameterIiv) \
+    X(GetTexParameterIuiv) \
+    X(ClearBufferiv) \
+    X(ClearBufferuiv) \
+    X(ClearBufferfv) \
+    X(ClearBufferfi) \
+    X(GetStringi) \
+    X(IsRenderbuffer) \
+    X(BindRenderbuffer) \
+    X(DeleteRenderbuffers) \
+    X(GenRenderbuffers) \
+    X(RenderbufferStorage) \
+    X(GetRenderbufferParameteriv) \
+    X(IsFramebuffer) \
+    X(BindFramebuffer) \
+    X(DeleteFramebuffers) \
+    X(GenFramebuffers) \
+    X(CheckFramebufferStatus) \
+    X(FramebufferTexture1D) \
+    X(FramebufferTexture2D) \
+    X(FramebufferTexture3D) \
+    X(FramebufferRenderbuffer) \
+    X(GetFramebufferAttachmentParameteriv) \
+    X(GenerateMipmap) \
+    X(BlitFramebuffer) \
+    X(RenderbufferStorageMultisample) \
+    X(FramebufferTextureLayer) \
+    X(MapBufferRange) \
+    X(FlushMappedBufferRange) \
+    X(BindVertexArray) \
+    X(DeleteVertexArrays) \
+    X(GenVertexArrays) \
+    X(IsVertexArray) \
+    /* OpenGL 3.1 */ \
+    X(DrawArraysInstanced) \
+    X(DrawElementsInstanced) \
+    X(TexBuffer) \
+    X(PrimitiveRestartIndex) \
+    X(CopyBufferSubData) \
+    X(GetUniformIndices) \
+    X(GetActiveUniformsiv) \
+    X(GetActiveUniformName) \
+    X(GetUniformBlockIndex) \
+    X(GetActiveUniformBlockiv) \
+    X(GetActiveUniformBlockName) \
+    X(UniformBlockBinding) \
+    /* OpenGL 3.2 */ \
+    X(DrawElementsBaseVertex) \
+    X(DrawRangeElementsBaseVertex) \
+    X(DrawElementsInstancedBaseVertex) \
+    X(MultiDrawElementsBaseVertex) \
+    X(ProvokingVertex) \
+    X(FenceSync) \
+    X(IsSync) \
+    X(DeleteSync) \
+    X(ClientWaitSync) \
+    X(WaitSync) \
+    X(GetInteger64v) \
+    X(GetSynciv) \
+    X(GetInteger64i_v) \
+    X(GetBufferParameteri64v) \
+    X(FramebufferTexture) \
+    X(TexImage2DMultisample) \
+    X(TexImage3DMultisample) \
+    X(GetMultisamplefv) \
+    X(SampleMaski) \
+    /* OpenGL 3.3 */ \
+    X(BindFragDataLocationIndexed) \
+    X(GetFragDataIndex) \
+    X(GenSamplers) \
+    X(DeleteSamplers) \
+    X(IsSampler) \
+    X(BindSampler) \
+    X(SamplerParameteri) \
+    X(SamplerParameteriv) \
+    X(SamplerParameterf) \
+    X(SamplerParameterfv) \
+    X(SamplerParameterIiv) \
+    X(SamplerParameterIuiv) \
+    X(GetSamplerParameteriv) \
+    X(GetSamplerParameterIiv) \
+    X(GetSamplerParameterfv) \
+    X(GetSamplerParameterIuiv) \
+    X(QueryCounter) \
+    X(GetQueryObjecti64v) \
+    X(GetQueryObjectui64v) \
+    X(VertexAttribDivisor) \
+    X(VertexAttribP1ui) \
+    X(VertexAttribP1uiv) \
+    X(VertexAttribP2ui) \
+    X(VertexAttribP2uiv) \
+    X(VertexAttribP3ui) \
+    X(VertexAttribP3uiv) \
+    X(VertexAttribP4ui) \
+    X(VertexAttribP4uiv) \
+    /* OpenGL 4.0 */ \
+    X(MinSampleShading) \
+    X(BlendEquationi) \
+    X(BlendEquationSeparatei) \
+    X(BlendFunci) \
+    X(BlendFuncSeparatei) \
+    X(DrawArraysIndirect) \
+    X(DrawElementsIndirect) \
+    X(Uniform1d) \
+    X(Uniform2d) \
+    X(Uniform3d) \
+    X(Uniform4d) \
+    X(Uniform1dv) \
+    X(Uniform2dv) \
+    X(Uniform3dv) \
+    X(Uniform4dv) \
+    X(UniformMatrix2dv) \
+    X(UniformMatrix3dv) \
+    X(UniformMatrix4dv) \
+    X(UniformMatrix2x3dv) \
+    X(UniformMatrix2x4dv) \
+    X(UniformMatrix3x2dv) \
+    X(UniformMatrix3x4dv) \
+    X(UniformMatrix4x2dv) \
+    X(UniformMatrix4x3dv) \
+    X(GetUniformdv) \
+    X(GetSubroutineUniformLocation) \
+    X(GetSubroutineIndex) \
+    X(GetActiveSubroutineUniformiv) \
+    X(GetActiveSubroutineUniformName) \
+    X(GetActiveSubroutineName) \
+    X(UniformSubroutinesuiv) \
+    X(GetUniformSubroutineuiv) \
+    X(GetProgramStageiv) \
+    X(PatchParameteri) \
+    X(PatchParameterfv) \
+    X(BindTransformFeedback) \
+    X(DeleteTransformFeedbacks) \
+    X(GenTransformFeedbacks) \
+    X(IsTransformFeedback) \
+    X(PauseTransformFeedback) \
+    X(ResumeTransformFeedback) \
+    X(DrawTransformFeedback) \
+    X(DrawTransformFeedbackStream) \
+    X(BeginQueryIndexed) \
+    X(EndQueryIndexed) \
+    X(GetQueryIndexediv) \
+    /* OpenGL 4.1 */ \
+    X(ReleaseShaderCompiler) \
+    X(ShaderBinary) \
+    X(GetShaderPrecisionFormat) \
+    X(DepthRangef) \
+    X(ClearDepthf) \
+    X(GetProgramBinary) \
+    X(ProgramBinary) \
+    X(ProgramParameteri) \
+    X(UseProgramStages) \
+    X(ActiveShaderProgram) \
+    X(CreateShaderProgramv) \
+    X(BindProgramPipeline) \
+    X(DeleteProgramPipelines) \
+    X(GenProgramPipelines) \
+    X(IsProgramPipeline) \
+    X(GetProgramPipelineiv) \
+    X(ProgramUniform1i) \
+    X(ProgramUniform1iv) \
+    X(ProgramUniform1f) \
+    X(ProgramUniform1fv) \
+    X(ProgramUniform1d) \
+    X(ProgramUniform1dv) \
+    X(ProgramUniform1ui) \
+    X(ProgramUniform1uiv) \
+    X(ProgramUniform2i) \
+    X(ProgramUniform2iv) \
+    X(ProgramUniform2f) \
+    X(ProgramUniform2fv) \
+    X(ProgramUniform2d) \
+    X(ProgramUniform2dv) \
+    X(ProgramUniform2ui) \
+    X(ProgramUniform2uiv) \
+    X(ProgramUniform3i) \
+    X(ProgramUniform3iv) \
+    X(ProgramUniform3f) \
+    X(ProgramUniform3fv) \
+    X(ProgramUniform3d) \
+    X(ProgramUniform3dv) \
+    X(ProgramUniform3ui) \
+    X(ProgramUniform3uiv) \
+    X(ProgramUniform4i) \
+    X(ProgramUniform4iv) \
+    X(ProgramUniform4f) \
+    X(ProgramUniform4fv) \
+    X(ProgramUniform4d) \
+    X(ProgramUniform4dv) \
+    X(ProgramUniform4ui) \
+    X(ProgramUniform4uiv) \
+    X(ProgramUniformMatrix2fv) \
+    X(ProgramUniformMatrix3fv) \
+    X(ProgramUniformMatrix4fv) \
+    X(ProgramUniformMatrix2dv) \
+    X(ProgramUniformMatrix3dv) \
+    X(ProgramUniformMatrix4dv) \
+    X(ProgramUniformMatrix2x3fv) \
+    X(ProgramUniformMatrix3x2fv) \
+    X(ProgramUniformMatrix2x4fv) \
+    X(ProgramUniformMatrix4x2fv) \
+    X(ProgramUniformMatrix3x4fv) \
+    X(ProgramUniformMatrix4x3fv) \
+    X(ProgramUniformMatrix2x3dv) \
+    X(ProgramUniformMatrix3x2dv) \
+    X(ProgramUniformMatrix2x4dv) \
+    X(ProgramUniformMatrix4x2dv) \
+    X(ProgramUniformMatrix3x4dv) \
+    X(ProgramUniformMatrix4x3dv) \
+    X(ValidateProgramPipeline) \
+    X(GetProgramPipelineInfoLog) \
+    X(VertexAttribL1d) \
+    X(VertexAttribL2d) \
+    X(VertexAttribL3d) \
+    X(VertexAttribL4d) \
+    X(VertexAttribL1dv) \
+    X(VertexAttribL2dv) \
+    X(VertexAttribL3dv) \
+    X(VertexAttribL4dv) \
+    X(VertexAttribLPointer) \
+    X(GetVertexAttribLdv) \
+    X(ViewportArrayv) \
+    X(ViewportIndexedf) \
+    X(ViewportIndexedfv) \
+    X(ScissorArrayv) \
+    X(ScissorIndexed) \
+    X(ScissorIndexedv) \
+    X(DepthRangeArrayv) \
+    X(DepthRangeIndexed) \
+    X(GetFloati_v) \
+    X(GetDoublei_v) \
+    /* OpenGL 4.2 */ \
+    X(DrawArraysInstancedBaseInstance) \
+    X(DrawElementsInstancedBaseInstance) \
+    X(DrawElementsInstancedBaseVertexBaseInstance) \
+    X(GetInternalformativ) \
+    X(GetActiveAtomicCounterBufferiv) \
+    X(BindImageTexture) \
+    X(MemoryBarrier) \
+    X(TexStorage1D) \
+    X(TexStorage2D) \
+    X(TexStorage3D) \
+    X(DrawTransformFeedbackInstanced) \
+    X(DrawTransformFeedbackStreamInstanced) \
+    /* OpenGL 4.3 */ \
+    X(ClearBufferData) \
+    X(ClearBufferSubData) \
+    X(DispatchCompute) \
+    X(DispatchComputeIndirect) \
+    X(CopyImageSubData) \
+    X(FramebufferParameteri) \
+    X(GetFramebufferParameteriv) \
+    X(GetInternalformati64v) \
+    X(InvalidateTexSubImage) \
+    X(InvalidateTexImage) \
+    X(InvalidateBufferSubData) \
+    X(InvalidateBufferData) \
+    X(InvalidateFramebuffer) \
+    X(InvalidateSubFramebuffer) \
+    X(MultiDrawArraysIndirect) \
+    X(MultiDrawElementsIndirect) \
+    X(GetProgramInterfaceiv) \
+    X(GetProgramResourceIndex) \
+    X(GetProgramResourceName) \
+    X(GetProgramResourceiv) \
+    X(GetProgramResourceLocation) \
+    X(GetProgramResourceLocationIndex) \
+    X(ShaderStorageBlockBinding) \
+    X(TexBufferRange) \
+    X(TexStorage2DMultisample) \
+    X(TexStorage3DMultisample) \
+    X(TextureView) \
+    X(BindVertexBuffer) \
+    X(VertexAttribFormat) \
+    X(VertexAttribIFormat) \
+    X(VertexAttribLFormat) \
+    X(VertexAttribBinding) \
+    X(VertexBindingDivisor) \
+    X(DebugMessageControl) \
+    X(DebugMessageInsert) \
+    X(DebugMessageCallback) \
+    X(GetDebugMessageLog) \
+    X(PushDebugGroup) \
+    X(PopDebugGroup) \
+    X(ObjectLabel) \
+    X(GetObjectLabel) \
+    X(ObjectPtrLabel) \
+    X(GetObjectPtrLabel) \
+    /* OpenGL 4.4 */ \
+    X(BufferStorage) \
+    X(ClearTexImage) \
+    X(ClearTexSubImage) \
+    X(BindBuffersBase) \
+    X(BindBuffersRange) \
+    X(BindTextures) \
+    X(BindSamplers) \
+    X(BindImageTextures) \
+    X(BindVertexBuffers) \
+    /* OpenGL 4.5 */ \
+    X(ClipControl) \
+    X(CreateTransformFeedbacks) \
+    X(TransformFeedbackBufferBase) \
+    X(TransformFeedbackBufferRange) \
+    X(GetTransformFeedbackiv) \
+    X(GetTransformFeedbacki_v) \
+    X(GetTransformFeedbacki64_v) \
+    X(CreateBuffers) \
+    X(NamedBufferStorage) \
+    X(NamedBufferData) \
+    X(NamedBufferSubData) \
+    X(CopyNamedBufferSubData) \
+    X(ClearNamedBufferData) \
+    X(ClearNamedBufferSubData) \
+    X(MapNamedBuffer) \
+    X(MapNamedBufferRange) \
+    X(UnmapNamedBuffer) \
+    X(FlushMappedNamedBufferRange) \
+    X(GetNamedBufferParameteriv) \
+    X(GetNamedBufferParameteri64v) \
+    X(GetNamedBufferPointerv) \
+    X(GetNamedBufferSubData) \
+    X(CreateFramebuffers) \
+    X(NamedFramebufferRenderbuffer) \
+    X(NamedFramebufferParameteri) \
+    X(NamedFramebufferTexture) \
+    X(NamedFramebufferTextureLayer) \
+    X(NamedFramebufferDrawBuffer) \
+    X(NamedFramebufferDrawBuffers) \
+    X(NamedFramebufferReadBuffer) \
+    X(InvalidateNamedFramebufferData) \
+    X(InvalidateNamedFramebufferSubData) \
+    X(ClearNamedFramebufferiv) \
+    X(ClearNamedFramebufferuiv) \
+    X(ClearNamedFramebufferfv) \
+    X(ClearNamedFramebufferfi) \
+    X(BlitNamedFramebuffer) \
+    X(CheckNamedFramebufferStatus) \
+    X(GetNamedFramebufferParameteriv) \
+    X(GetNamedFramebufferAttachmentParameteriv) \
+    X(CreateRenderbuffers) \
+    X(NamedRenderbufferStorage) \
+    X(NamedRenderbufferStorageMultisample) \
+    X(GetNamedRenderbufferParameteriv) \
+    X(CreateTextures) \
+    X(TextureBuffer) \
+    X(TextureBufferRange) \
+    X(TextureStorage1D) \
+    X(TextureStorage2D) \
+    X(TextureStorage3D) \
+    X(TextureStorage2DMultisample) \
+    X(TextureStorage3DMultisample) \
+    X(TextureSubImage1D) \
+    X(TextureSubImage2D) \
+    X(TextureSubImage3D) \
+    X(CompressedTextureSubImage1D) \
+    X(CompressedTextureSubImage2D) \
+    X(CompressedTextureSubImage3D) \
+    X(CopyTextureSubImage1D) \
+    X(CopyTextureSubImage2D) \
+    X(CopyTextureSubImage3D) \
+    X(TextureParameterf) \
+    X(TextureParameterfv) \
+    X(TextureParameteri) \
+    X(TextureParameterIiv) \
+    X(TextureParameterIuiv) \
+    X(TextureParameteriv) \
+    X(GenerateTextureMipmap) \
+    X(BindTextureUnit) \
+    X(GetTextureImage) \
+    X(GetCompressedTextureImage) \
+    X(GetTextureLevelParameterfv) \
+    X(GetTextureLevelParameteriv) \
+    X(GetTextureParameterfv) \
+    X(GetTextureParameterIiv) \
+    X(GetTextureParameterIuiv) \
+    X(GetTextureParameteriv) \
+    X(CreateVertexArrays) \
+    X(DisableVertexArrayAttrib) \
+    X(EnableVertexArrayAttrib) \
+    X(VertexArrayElementBuffer) \
+    X(VertexArrayVertexBuffer) \
+    X(VertexArrayVertexBuffers) \
+    X(VertexArrayAttribBinding) \
+    X(VertexArrayAttribFormat) \
+    X(VertexArrayAttribIFormat) \
+    X(VertexArrayAttribLFormat) \
+    X(VertexArrayBindingDivisor) \
+    X(GetVertexArrayiv) \
+    X(GetVertexArrayIndexediv) \
+    X(GetVertexArrayIndexed64iv) \
+    X(CreateSamplers) \
+    X(CreateProgramPipelines) \
+    X(CreateQueries) \
+    X(GetQueryBufferObjecti64v) \
+    X(GetQueryBufferObjectiv) \
+    X(GetQueryBufferObjectui64v) \
+    X(GetQueryBufferObjectuiv) \
+    X(MemoryBarrierByRegion) \
+    X(GetTextureSubImage) \
+    X(GetCompressedTextureSubImage) \
+    X(GetGraphicsResetStatus) \
+    X(GetnCompressedTexImage) \
+    X(GetnTexImage) \
+    X(GetnUniformdv) \
+    X(GetnUniformfv) \
+    X(GetnUniformiv) \
+    X(GetnUniformuiv) \
+    X(ReadnPixels) \
+    X(TextureBarrier) \
+    /* OpenGL 4.6 */ \
+    X(SpecializeShader) \
+    X(MultiDrawArraysIndirectCount) \
+    X(MultiDrawElementsIndirectCount) \
+    X(PolygonOffsetClamp) \
+    /* OpenGL ES 3.2 */ \
+    X(BlendBarrier) \
+    X(PrimitiveBoundingBox)
+
+struct waffle_gl_dispatch {
+#define WAFFLE_GL_DISPATCH_MEMBER(name) void *name;
+    WAFFLE_GL_DISPATCH_ENTRY_POINTS(WAFFLE_GL_DISPATCH_MEMBER)
+#undef WAFFLE_GL_DISPATCH_MEMBER
+};
+
+#ifdef __cplusplus
+} // end extern "C"
+#endif
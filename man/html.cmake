@@ -36,6 +36,8 @@ set(html_outputs
     ${html_out_dir}/waffle_dl.3.html
     ${html_out_dir}/waffle_enum.3.html
     ${html_out_dir}/waffle_error.3.html
+    ${html_out_dir}/waffle_executor.3.html
+    ${html_out_dir}/waffle_fence.3.html
     ${html_out_dir}/waffle_gbm.3.html
     ${html_out_dir}/waffle_get_proc_address.3.html
     ${html_out_dir}/waffle_glx.3.html
@@ -75,6 +77,8 @@ waffle_add_html(3 waffle_display)
 waffle_add_html(3 waffle_dl)
 waffle_add_html(3 waffle_enum)
 waffle_add_html(3 waffle_error)
+waffle_add_html(3 waffle_executor)
+waffle_add_html(3 waffle_fence)
 waffle_add_html(3 waffle_gbm)
 waffle_add_html(3 waffle_get_proc_address)
 waffle_add_html(3 waffle_glx)
@@ -38,6 +38,8 @@ set(man_outputs
     ${man_out_dir}/man3/waffle_dl.3
     ${man_out_dir}/man3/waffle_enum.3
     ${man_out_dir}/man3/waffle_error.3
+    ${man_out_dir}/man3/waffle_executor.3
+    ${man_out_dir}/man3/waffle_fence.3
     ${man_out_dir}/man3/waffle_gbm.3
     ${man_out_dir}/man3/waffle_get_proc_address.3
     ${man_out_dir}/man3/waffle_glx.3
@@ -75,6 +77,8 @@ waffle_add_manpage(3 waffle_display)
 waffle_add_manpage(3 waffle_dl)
 waffle_add_manpage(3 waffle_enum)
 waffle_add_manpage(3 waffle_error)
+waffle_add_manpage(3 waffle_executor)
+waffle_add_manpage(3 waffle_fence)
 waffle_add_manpage(3 waffle_gbm)
 waffle_add_manpage(3 waffle_get_proc_address)
 waffle_add_manpage(3 waffle_glx)
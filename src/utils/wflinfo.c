@@ -64,8 +64,8 @@ static const char *usage_message =
     "\n"
     "Required Parameters:\n"
     "    -p, --platform <platform>\n"
-    "        One of: android, cgl, gbm, glx, surfaceless_egl (or short\n"
-    "        alias 'sl'), wayland, wgl, qnx or x11_egl.\n"
+    "        One of: android, cgl, egl_device, gbm, glx, surfaceless_egl\n"
+    "        (or short alias 'sl'), wayland, wgl, qnx or x11_egl.\n"
     "\n"
     "    -a, --api <api>\n"
     "        One of: gl, gles1, gles2 or gles3\n"
@@ -89,6 +89,10 @@ static const char *usage_message =
     "    -f, --format <format>\n"
     "        One of: original (default) or json.\n"
     "\n"
+    "    --cache\n"
+    "        Read and update waffle's capability cache, which remembers the\n"
+    "        highest context version created on each driver, to try it early.\n"
+    "\n"
     "    -h, --help\n"
     "        Print wflinfo usage information.\n"
     "\n"
@@ -108,6 +112,7 @@ enum {
     OPT_VERBOSE = 'v',
     OPT_DEBUG_CONTEXT,
     OPT_FORWARD_COMPATIBLE,
+    OPT_CACHE,
     OPT_FORMAT = 'f',
     OPT_HELP = 'h',
 };
@@ -121,6 +126,7 @@ static const struct option get_opts[] = {
     { .name = "debug-context",  .has_arg = no_argument,           .val = OPT_DEBUG_CONTEXT },
     { .name = "forward-compatible", .has_arg = no_argument,       .val = OPT_FORWARD_COMPATIBLE },
     { .name = "format",         .has_arg = required_argument,     .val = OPT_FORMAT },
+    { .name = "cache",          .has_arg = no_argument,           .val = OPT_CACHE },
     { .name = "help",           .has_arg = no_argument,           .val = OPT_HELP },
     { 0 },
 };
@@ -273,6 +279,8 @@ struct options {
     bool context_forward_compatible;
     bool context_debug;
 
+    bool cache;
+
     /// @brief One of `WAFFLE_DL_*`.
     int dl;
 };
@@ -292,6 +300,7 @@ static const struct enum_map platform_map[] = {
     {WAFFLE_PLATFORM_X11_EGL,   "x11_egl"       },
     {WAFFLE_PLATFORM_SURFACELESS_EGL,   "surfaceless_egl" },
     {WAFFLE_PLATFORM_SURFACELESS_EGL,   "sl"              },
+    {WAFFLE_PLATFORM_EGL_DEVICE,        "egl_device"      },
     {WAFFLE_PLATFORM_QNX,       "qnx"           },
     {0,                         0               },
 };
@@ -426,6 +435,9 @@ parse_args(int argc, char *argv[], struct options *opts)
             case OPT_DEBUG_CONTEXT:
                 opts->context_debug = true;
                 break;
+            case OPT_CACHE:
+                opts->cache = true;
+                break;
             case OPT_HELP:
                 write_usage_and_exit(stdout, EXIT_SUCCESS);
                 break;
@@ -1124,11 +1136,71 @@ wflinfo_create_context(struct waffle_display *dpy,
         // If the user requested OpenGL and a CORE or COMPAT profile,
         // but they didn't specify a version, then we'll try a set
         // of known versions from highest to lowest.
+        //
+        // The driver may report the highest version it supports without a
+        // context, in which case try it first. The capability cache only
+        // knows the highest version created so far, which is a lower
+        // bound: the known versions above it are still tried before it.
 
         static int known_gl_profile_versions[] =
             { 32, 33, 40, 41, 42, 43, 44 };
 
-        for (int i = ARRAY_SIZE(known_gl_profile_versions) - 1; i >= 0; i--) {
+        intptr_t known_version = 0;
+        intptr_t cached_major = 0, cached_minor = 0;
+        int cached_version;
+        int i = ARRAY_SIZE(known_gl_profile_versions) - 1;
+        int32_t renderer_attrib =
+            attrs.profile == WAFFLE_CONTEXT_CORE_PROFILE
+                ? WAFFLE_RENDERER_OPENGL_CORE_PROFILE_VERSION
+                : WAFFLE_RENDERER_OPENGL_COMPATIBILITY_PROFILE_VERSION;
+
+        if (waffle_display_query_renderer(dpy, renderer_attrib,
+                                          &known_version) &&
+            known_version >= 32) {
+            struct wflinfo_config_attrs known_attrs = attrs;
+            known_attrs.major = known_version / 10;
+            known_attrs.minor = known_version % 10;
+            ok = wflinfo_try_create_context(dpy, known_attrs,
+                                            out_ctx, out_config, false);
+            if (ok) {
+                return;
+            }
+        }
+
+        waffle_display_query_capability(dpy, attrs.api, attrs.profile,
+                                        WAFFLE_CONTEXT_MAJOR_VERSION,
+                                        &cached_major);
+        waffle_display_query_capability(dpy, attrs.api, attrs.profile,
+                                        WAFFLE_CONTEXT_MINOR_VERSION,
+                                        &cached_minor);
+        cached_version = 10 * cached_major + cached_minor;
+
+        for (; i >= 0 && known_gl_profile_versions[i] > cached_version; i--) {
+            attrs.major = known_gl_profile_versions[i] / 10;
+            attrs.minor = known_gl_profile_versions[i] % 10;
+            ok = wflinfo_try_create_context(dpy, attrs,
+                                            out_ctx, out_config, false);
+            if (ok) {
+                return;
+            }
+        }
+
+        // The cached version may be one that wflinfo does not know.
+        if (cached_version >= 32) {
+            attrs.major = cached_version / 10;
+            attrs.minor = cached_version % 10;
+            ok = wflinfo_try_create_context(dpy, attrs,
+                                            out_ctx, out_config, false);
+            if (ok) {
+                return;
+            }
+        }
+
+        // The driver may have changed since the version was cached.
+        for (; i >= 0; i--) {
+            if (known_gl_profile_versions[i] == cached_version)
+                continue;
+
             attrs.major = known_gl_profile_versions[i] / 10;
             attrs.minor = known_gl_profile_versions[i] % 10;
             ok = wflinfo_try_create_context(dpy, attrs,
@@ -1191,7 +1263,7 @@ main(int argc, char **argv)
 
     struct options opts = {0};
 
-    int32_t init_attrib_list[3];
+    int32_t init_attrib_list[5];
 
     struct waffle_display *dpy;
     struct waffle_config *config;
@@ -1209,6 +1281,8 @@ main(int argc, char **argv)
     i = 0;
     init_attrib_list[i++] = WAFFLE_PLATFORM;
     init_attrib_list[i++] = opts.platform;
+    init_attrib_list[i++] = WAFFLE_CAPABILITY_CACHE;
+    init_attrib_list[i++] = opts.cache;
     init_attrib_list[i++] = WAFFLE_NONE;
 
     ok = waffle_init(init_attrib_list);
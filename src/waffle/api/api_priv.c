@@ -58,3 +58,24 @@ api_check_entry(const struct api_object *obj_list[], int length)
 
     return true;
 }
+
+bool
+api_check_sym_batch(size_t count, const char *const names[], void *syms[])
+{
+    if (count == 0)
+        return true;
+
+    if (names == NULL || syms == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "null array");
+        return false;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (names[i] == NULL) {
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "null symbol name");
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -67,3 +67,7 @@ extern struct wcore_platform *api_platform;
 ///     - two objects belong to different displays
 bool
 api_check_entry(const struct api_object *obj_list[], int length);
+
+/// @brief Validate the arrays given to the waffle_*_batch() entry points.
+bool
+api_check_sym_batch(size_t count, const char *const names[], void *syms[]);
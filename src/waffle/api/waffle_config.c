@@ -27,6 +27,7 @@
 
 #include "wcore_config_attrs.h"
 #include "wcore_config.h"
+#include "wcore_config_cache.h"
 #include "wcore_display.h"
 #include "wcore_error.h"
 #include "wcore_platform.h"
@@ -37,6 +38,7 @@ waffle_config_choose(
         const int32_t attrib_list[])
 {
     struct wcore_config *wc_self;
+    struct wcore_config *wc_cached;
     struct wcore_display *wc_dpy = wcore_display(dpy);
     struct wcore_config_attrs attrs;
     bool ok = true;
@@ -52,11 +54,105 @@ waffle_config_choose(
     if (!ok)
         return NULL;
 
+    // Identical requests share one config, so the platform's checks and
+    // native queries run once per display.
+    wc_self = wcore_config_cache_lookup(&wc_dpy->config_cache, &attrs);
+    if (wc_self)
+        return waffle_config(wc_self);
+
     wc_self = api_platform->vtbl->config.choose(api_platform, wc_dpy, &attrs);
     if (!wc_self)
         return NULL;
 
-    return waffle_config(wc_self);
+    wc_cached = wcore_config_cache_insert(&wc_dpy->config_cache, wc_self);
+    if (wc_cached != wc_self)
+        api_platform->vtbl->config.destroy(wc_self);
+
+    return waffle_config(wc_cached);
+}
+
+WAFFLE_API bool
+waffle_config_enumerate(
+        struct waffle_display *dpy,
+        const int32_t attrib_list[],
+        struct waffle_config *configs[],
+        int32_t max_configs,
+        int32_t *num_configs)
+{
+    struct wcore_display *wc_dpy = wcore_display(dpy);
+    struct wcore_config_attrs attrs;
+
+    const struct api_object *obj_list[] = {
+        wc_dpy ? &wc_dpy->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (num_configs == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "num_configs is null");
+        return false;
+    }
+
+    if (configs != NULL && max_configs < 0) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "max_configs is negative");
+        return false;
+    }
+
+    if (!wcore_config_attrs_parse(attrib_list, &attrs))
+        return false;
+
+    if (attrs.no_config) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_NO_CONFIG selects no configs to enumerate");
+        return false;
+    }
+
+    if (!api_platform->vtbl->config.enumerate) {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+
+    return api_platform->vtbl->config.enumerate(api_platform, wc_dpy, &attrs,
+                                                (struct wcore_config **) configs,
+                                                max_configs, num_configs);
+}
+
+WAFFLE_API bool
+waffle_config_query(
+        struct waffle_config *self,
+        int32_t attrib,
+        intptr_t *value)
+{
+    struct wcore_config *wc_self = wcore_config(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (value == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "value is null");
+        return false;
+    }
+
+    if (wc_self->attrs.no_config) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "a config chosen with WAFFLE_NO_CONFIG has no "
+                     "framebuffer attributes");
+        return false;
+    }
+
+    if (api_platform->vtbl->config.query) {
+        return api_platform->vtbl->config.query(wc_self, attrib, value);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
 }
 
 WAFFLE_API bool
@@ -71,6 +167,9 @@ waffle_config_destroy(struct waffle_config *self)
     if (!api_check_entry(obj_list, 1))
         return false;
 
+    if (!wcore_config_unref(wc_self))
+        return true;
+
     return api_platform->vtbl->config.destroy(wc_self);
 }
 
@@ -0,0 +1,201 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Measure waffle_config_choose latency on a freshly connected display, where
+// the request reaches the platform, and on a display that has already seen
+// the same request, where it is answered from the display's config cache.
+//
+// Usage: waffle_config_choose_bench [platform [iterations]]
+
+#define _POSIX_C_SOURCE 199309L // clock_gettime()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "waffle.h"
+
+static const struct {
+    const char *name;
+    int32_t platform;
+} platforms[] = {
+#ifdef WAFFLE_HAS_SURFACELESS_EGL
+    { "surfaceless_egl", WAFFLE_PLATFORM_SURFACELESS_EGL },
+#endif
+#ifdef WAFFLE_HAS_EGL_DEVICE
+    { "egl_device", WAFFLE_PLATFORM_EGL_DEVICE },
+#endif
+#ifdef WAFFLE_HAS_GBM
+    { "gbm", WAFFLE_PLATFORM_GBM },
+#endif
+#ifdef WAFFLE_HAS_GLX
+    { "glx", WAFFLE_PLATFORM_GLX },
+#endif
+};
+
+static const int32_t rgba8_attrib_list[] = {
+    WAFFLE_CONTEXT_API,         WAFFLE_CONTEXT_OPENGL_ES2,
+    WAFFLE_RED_SIZE,            8,
+    WAFFLE_GREEN_SIZE,          8,
+    WAFFLE_BLUE_SIZE,           8,
+    WAFFLE_ALPHA_SIZE,          8,
+    0,
+};
+
+static const int32_t ranked_attrib_list[] = {
+    WAFFLE_CONTEXT_API,         WAFFLE_CONTEXT_OPENGL_ES2,
+    WAFFLE_RED_SIZE,            8,
+    WAFFLE_GREEN_SIZE,          8,
+    WAFFLE_BLUE_SIZE,           8,
+    WAFFLE_DEPTH_SIZE,          16,
+    WAFFLE_SAMPLE_BUFFERS,      1,
+    WAFFLE_SAMPLES,             8,
+    WAFFLE_CONFIG_RANKING,      WAFFLE_CONFIG_PREFER_SMALLEST,
+    WAFFLE_SAMPLES_FALLBACK,    true,
+    0,
+};
+
+static double
+now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static const char *
+error_string(void)
+{
+    return waffle_error_to_string(waffle_error_get_code());
+}
+
+static void
+bench(const char *name, const int32_t *attrib_list, int n)
+{
+    struct waffle_display *dpy;
+    struct waffle_config *config;
+    double cold = 0.0, warm, t0;
+    int warm_n = n * 100;
+
+    // Cold: every choose is the first one on its display, so connecting is
+    // done outside the timed region.
+    for (int i = 0; i < n; ++i) {
+        dpy = waffle_display_connect(NULL);
+        if (!dpy) {
+            printf("  %-26s skipped: waffle_display_connect failed: %s\n",
+                   name, error_string());
+            return;
+        }
+
+        t0 = now_ms();
+        config = waffle_config_choose(dpy, attrib_list);
+        cold += now_ms() - t0;
+
+        if (!config) {
+            printf("  %-26s skipped: waffle_config_choose failed: %s\n",
+                   name, error_string());
+            waffle_display_disconnect(dpy);
+            return;
+        }
+
+        waffle_config_destroy(config);
+        waffle_display_disconnect(dpy);
+    }
+
+    // Warm: one display, the same request over and over.
+    dpy = waffle_display_connect(NULL);
+    if (!dpy) {
+        printf("  %-26s skipped: waffle_display_connect failed: %s\n",
+               name, error_string());
+        return;
+    }
+
+    config = waffle_config_choose(dpy, attrib_list);
+    if (!config) {
+        printf("  %-26s skipped: waffle_config_choose failed: %s\n",
+               name, error_string());
+        waffle_display_disconnect(dpy);
+        return;
+    }
+    waffle_config_destroy(config);
+
+    t0 = now_ms();
+    for (int i = 0; i < warm_n; ++i) {
+        config = waffle_config_choose(dpy, attrib_list);
+        waffle_config_destroy(config);
+    }
+    warm = now_ms() - t0;
+
+    printf("  %-26s cold %10.3f us/choose  warm %8.3f us/choose\n",
+           name, cold * 1e3 / n, warm * 1e3 / warm_n);
+
+    waffle_display_disconnect(dpy);
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *platform_name = NULL;
+    int32_t platform = 0;
+    int n = 100;
+
+    if (argc > 1)
+        platform_name = argv[1];
+    if (argc > 2)
+        n = strtol(argv[2], NULL, 0);
+
+    for (size_t i = 0; i < sizeof(platforms) / sizeof(platforms[0]); ++i) {
+        if (!platform_name || strcmp(platform_name, platforms[i].name) == 0) {
+            platform_name = platforms[i].name;
+            platform = platforms[i].platform;
+            break;
+        }
+    }
+
+    if (!platform || n <= 0) {
+        fprintf(stderr, "usage: waffle_config_choose_bench "
+                "[platform [iterations]]\n");
+        return EXIT_FAILURE;
+    }
+
+    const int32_t init_attrib_list[] = {
+        WAFFLE_PLATFORM, platform,
+        0,
+    };
+
+    if (!waffle_init(init_attrib_list)) {
+        fprintf(stderr, "waffle_init failed: %s\n", error_string());
+        return EXIT_FAILURE;
+    }
+
+    printf("%s, %d iterations\n", platform_name, n);
+    bench("RGBA8", rgba8_attrib_list, n);
+    bench("MSAA8, smallest, fallback", ranked_attrib_list, n);
+
+    waffle_teardown();
+    return EXIT_SUCCESS;
+}
@@ -25,9 +25,13 @@
 
 #include "api_priv.h"
 
+#include "wcore_config.h"
 #include "wcore_context.h"
+#include "wcore_context_future.h"
+#include "wcore_display.h"
 #include "wcore_error.h"
 #include "wcore_platform.h"
+#include "wcore_tinfo.h"
 
 WAFFLE_API struct waffle_context*
 waffle_context_create(
@@ -54,9 +58,80 @@ waffle_context_create(
     if (!wc_self)
         return NULL;
 
+    wcore_caps_cache_note_version(&wc_config->display->caps_cache,
+                                  &wc_config->attrs);
     return waffle_context(wc_self);
 }
 
+WAFFLE_API struct waffle_context_future*
+waffle_context_create_async(
+        struct waffle_config *config,
+        struct waffle_context *shared_ctx)
+{
+    struct wcore_context_future *wc_future;
+    struct wcore_config *wc_config = wcore_config(config);
+    struct wcore_context *wc_shared_ctx = wcore_context(shared_ctx);
+
+    const struct api_object *obj_list[2];
+    int len = 0;
+
+    obj_list[len++] = wc_config ? &wc_config->api : NULL;
+    if (wc_shared_ctx)
+        obj_list[len++] = &wc_shared_ctx->api;
+
+    if (!api_check_entry(obj_list, len))
+        return NULL;
+
+    if (api_platform->native_display_is_single_threaded) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "asynchronous context creation needs a native display "
+                     "that is safe to use from another thread");
+        return NULL;
+    }
+
+    wc_future = wcore_context_future_create(api_platform, wc_config,
+                                            wc_shared_ctx);
+    if (!wc_future)
+        return NULL;
+
+    return waffle_context_future(wc_future);
+}
+
+WAFFLE_API bool
+waffle_context_future_is_ready(struct waffle_context_future *self)
+{
+    struct wcore_context_future *wc_self = wcore_context_future(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    return wcore_context_future_is_ready(wc_self);
+}
+
+WAFFLE_API struct waffle_context*
+waffle_context_future_wait(struct waffle_context_future *self)
+{
+    struct wcore_context_future *wc_self = wcore_context_future(self);
+    struct wcore_context *wc_ctx;
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return NULL;
+
+    wc_ctx = wcore_context_future_wait(wc_self);
+    if (!wc_ctx)
+        return NULL;
+
+    return waffle_context(wc_ctx);
+}
+
 WAFFLE_API bool
 waffle_context_destroy(struct waffle_context *self)
 {
@@ -69,9 +144,53 @@ waffle_context_destroy(struct waffle_context *self)
     if (!api_check_entry(obj_list, 1))
         return false;
 
+    if (wc_self->pool) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the context belongs to a pool; return it instead");
+        return false;
+    }
+
+    if (wc_self->present_windows > 0) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "%d windows with WAFFLE_WINDOW_ASYNC_PRESENT still "
+                     "render with the context; destroy them first",
+                     wc_self->present_windows);
+        return false;
+    }
+
+    wcore_tinfo_forget_current(wcore_tinfo_get(), wc_self);
     return api_platform->vtbl->context.destroy(wc_self);
 }
 
+WAFFLE_API bool
+waffle_context_query(
+        struct waffle_context *self,
+        int32_t attrib,
+        intptr_t *value)
+{
+    struct wcore_context *wc_self = wcore_context(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (value == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "value is null");
+        return false;
+    }
+
+    if (api_platform->vtbl->context.query) {
+        return api_platform->vtbl->context.query(wc_self, attrib, value);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
 WAFFLE_API union waffle_native_context*
 waffle_context_get_native(struct waffle_context *self)
 {
@@ -0,0 +1,189 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "api_priv.h"
+
+#include "wcore_config.h"
+#include "wcore_context.h"
+#include "wcore_context_pool.h"
+#include "wcore_error.h"
+#include "wcore_platform.h"
+#include "wcore_tinfo.h"
+
+WAFFLE_API struct waffle_context_pool*
+waffle_context_pool_create(
+        struct waffle_config *config,
+        struct waffle_context *shared_ctx,
+        const intptr_t attrib_list[])
+{
+    struct wcore_context_pool *wc_self;
+    struct wcore_config *wc_config = wcore_config(config);
+    struct wcore_context *wc_shared_ctx = wcore_context(shared_ctx);
+    intptr_t prewarm = 0;
+    intptr_t max = 8;
+
+    const struct api_object *obj_list[2];
+    int len = 0;
+
+    obj_list[len++] = wc_config ? &wc_config->api : NULL;
+    if (wc_shared_ctx)
+        obj_list[len++] = &wc_shared_ctx->api;
+
+    if (!api_check_entry(obj_list, len))
+        return NULL;
+
+    for (const intptr_t *i = attrib_list; i && *i != 0; i += 2) {
+        switch (i[0]) {
+            case WAFFLE_CONTEXT_POOL_PREWARM:
+                prewarm = i[1];
+                break;
+            case WAFFLE_CONTEXT_POOL_MAX:
+                max = i[1];
+                break;
+            default:
+                wcore_error_bad_attribute(i[0]);
+                return NULL;
+        }
+    }
+
+    if (max <= 0 || max > INT32_MAX) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_CONTEXT_POOL_MAX must be positive");
+        return NULL;
+    }
+
+    if (prewarm < 0 || prewarm > max) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_CONTEXT_POOL_PREWARM must be between 0 and "
+                     "WAFFLE_CONTEXT_POOL_MAX");
+        return NULL;
+    }
+
+    wc_self = wcore_context_pool_create(api_platform, wc_config,
+                                        wc_shared_ctx, (int32_t) prewarm,
+                                        (int32_t) max);
+    if (!wc_self)
+        return NULL;
+
+    return waffle_context_pool(wc_self);
+}
+
+WAFFLE_API bool
+waffle_context_pool_destroy(struct waffle_context_pool *self)
+{
+    struct wcore_context_pool *wc_self = wcore_context_pool(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    return wcore_context_pool_destroy(wc_self);
+}
+
+WAFFLE_API struct waffle_context*
+waffle_context_pool_checkout(struct waffle_context_pool *self)
+{
+    struct wcore_context_pool *wc_self = wcore_context_pool(self);
+    struct wcore_context *wc_ctx;
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return NULL;
+
+    wc_ctx = wcore_context_pool_checkout(wc_self);
+    if (!wc_ctx)
+        return NULL;
+
+    return waffle_context(wc_ctx);
+}
+
+WAFFLE_API bool
+waffle_context_pool_return(
+        struct waffle_context_pool *self,
+        struct waffle_context *ctx)
+{
+    struct wcore_context_pool *wc_self = wcore_context_pool(self);
+    struct wcore_context *wc_ctx = wcore_context(ctx);
+    struct wcore_tinfo *tinfo;
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+        wc_ctx ? &wc_ctx->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 2))
+        return false;
+
+    // The owner never changes, so this needs no lock.
+    if (wc_ctx->pool != wc_self) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the context does not belong to this pool");
+        return false;
+    }
+
+    // Hand the context back unbound, so that the next borrower can make it
+    // current on any thread.
+    tinfo = wcore_tinfo_get();
+    if (tinfo->current_context == wc_ctx) {
+        if (!api_platform->vtbl->make_current(api_platform, wc_ctx->display,
+                                              NULL, NULL)) {
+            tinfo->current_is_valid = false;
+            return false;
+        }
+
+        wcore_tinfo_set_current(tinfo, wc_ctx->display, NULL, NULL);
+    }
+
+    return wcore_context_pool_return(wc_self, wc_ctx);
+}
+
+WAFFLE_API bool
+waffle_context_pool_query(
+        struct waffle_context_pool *self,
+        int32_t attrib,
+        intptr_t *value)
+{
+    struct wcore_context_pool *wc_self = wcore_context_pool(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (value == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "value is null");
+        return false;
+    }
+
+    return wcore_context_pool_query(wc_self, attrib, value);
+}
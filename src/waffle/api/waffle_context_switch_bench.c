@@ -0,0 +1,215 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Measure how fast one thread can alternate between two contexts with
+// waffle_make_current(), issuing a clear in each, once with the default
+// release behavior (an implicit flush each time a context is released) and
+// once with WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE.
+//
+// Usage: waffle_context_switch_bench [platform [switches]]
+
+#define _POSIX_C_SOURCE 199309L // clock_gettime()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "waffle.h"
+
+#define GL_COLOR_BUFFER_BIT 0x00004000
+
+typedef void (*glClear_t)(unsigned mask);
+typedef void (*glClearColor_t)(float r, float g, float b, float a);
+typedef void (*glFinish_t)(void);
+
+static const struct {
+    const char *name;
+    int32_t platform;
+} platforms[] = {
+#ifdef WAFFLE_HAS_SURFACELESS_EGL
+    { "surfaceless_egl", WAFFLE_PLATFORM_SURFACELESS_EGL },
+#endif
+#ifdef WAFFLE_HAS_EGL_DEVICE
+    { "egl_device", WAFFLE_PLATFORM_EGL_DEVICE },
+#endif
+#ifdef WAFFLE_HAS_GBM
+    { "gbm", WAFFLE_PLATFORM_GBM },
+#endif
+#ifdef WAFFLE_HAS_GLX
+    { "glx", WAFFLE_PLATFORM_GLX },
+#endif
+#ifdef WAFFLE_HAS_X11_EGL
+    { "x11_egl", WAFFLE_PLATFORM_X11_EGL },
+#endif
+#ifdef WAFFLE_HAS_WAYLAND
+    { "wayland", WAFFLE_PLATFORM_WAYLAND },
+#endif
+};
+
+static double
+now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static const char *
+error_string(void)
+{
+    return waffle_error_to_string(waffle_error_get_code());
+}
+
+/// Return false if the platform cannot provide the release behavior.
+static bool
+bench(struct waffle_display *dpy, int32_t release_behavior, long switches)
+{
+    const int32_t config_attrib_list[] = {
+        WAFFLE_CONTEXT_API,                 WAFFLE_CONTEXT_OPENGL_ES2,
+        WAFFLE_CONTEXT_RELEASE_BEHAVIOR,    release_behavior,
+        WAFFLE_RED_SIZE,                    8,
+        WAFFLE_GREEN_SIZE,                  8,
+        WAFFLE_BLUE_SIZE,                   8,
+        0,
+    };
+    struct waffle_config *config;
+    struct waffle_window *window;
+    struct waffle_context *ctx[2];
+    glClear_t clear;
+    glClearColor_t clear_color;
+    glFinish_t finish;
+    double t0, ms;
+
+    config = waffle_config_choose(dpy, config_attrib_list);
+    if (!config) {
+        printf("  %-40s skipped: %s\n",
+               waffle_enum_to_string(release_behavior), error_string());
+        return false;
+    }
+
+    window = waffle_window_create(config, 64, 64);
+    ctx[0] = waffle_context_create(config, NULL);
+    ctx[1] = waffle_context_create(config, NULL);
+    if (!window || !ctx[0] || !ctx[1]) {
+        fprintf(stderr, "failed to create window or contexts: %s\n",
+                error_string());
+        exit(EXIT_FAILURE);
+    }
+
+    if (!waffle_make_current(dpy, window, ctx[0])) {
+        fprintf(stderr, "waffle_make_current failed: %s\n", error_string());
+        exit(EXIT_FAILURE);
+    }
+
+    clear = (glClear_t) waffle_get_proc_address("glClear");
+    clear_color = (glClearColor_t) waffle_get_proc_address("glClearColor");
+    finish = (glFinish_t) waffle_get_proc_address("glFinish");
+    if (!clear || !clear_color || !finish) {
+        fprintf(stderr, "failed to resolve GL entry points\n");
+        exit(EXIT_FAILURE);
+    }
+
+    t0 = now_ms();
+
+    for (long i = 0; i < switches; ++i) {
+        waffle_make_current(dpy, window, ctx[i & 1]);
+        clear_color((i & 1) ? 1.0f : 0.0f, 0.0f, 0.0f, 1.0f);
+        clear(GL_COLOR_BUFFER_BIT);
+    }
+
+    // Charge the deferred work to the loop, too, so that skipping the
+    // flushes cannot look faster than it is.
+    for (int i = 0; i < 2; ++i) {
+        waffle_make_current(dpy, window, ctx[i]);
+        finish();
+    }
+
+    ms = now_ms() - t0;
+    printf("  %-40s %8.3f ms  %8.0f ns/switch\n",
+           waffle_enum_to_string(release_behavior), ms, ms * 1e6 / switches);
+
+    waffle_make_current(dpy, NULL, NULL);
+    waffle_context_destroy(ctx[0]);
+    waffle_context_destroy(ctx[1]);
+    waffle_window_destroy(window);
+    waffle_config_destroy(config);
+    return true;
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *platform_name = NULL;
+    int32_t platform = 0;
+    long switches = 20000;
+    struct waffle_display *dpy;
+
+    if (argc > 1)
+        platform_name = argv[1];
+    if (argc > 2)
+        switches = strtol(argv[2], NULL, 0);
+
+    for (size_t i = 0; i < sizeof(platforms) / sizeof(platforms[0]); ++i) {
+        if (!platform_name || strcmp(platform_name, platforms[i].name) == 0) {
+            platform_name = platforms[i].name;
+            platform = platforms[i].platform;
+            break;
+        }
+    }
+
+    if (!platform || switches <= 0) {
+        fprintf(stderr, "usage: waffle_context_switch_bench "
+                "[platform [switches]]\n");
+        return EXIT_FAILURE;
+    }
+
+    const int32_t init_attrib_list[] = {
+        WAFFLE_PLATFORM, platform,
+        0,
+    };
+
+    if (!waffle_init(init_attrib_list)) {
+        fprintf(stderr, "waffle_init failed: %s\n", error_string());
+        return EXIT_FAILURE;
+    }
+
+    dpy = waffle_display_connect(NULL);
+    if (!dpy) {
+        printf("skipped: waffle_display_connect failed: %s\n", error_string());
+        waffle_teardown();
+        return EXIT_SUCCESS;
+    }
+
+    printf("%s, %ld context switches\n", platform_name, switches);
+
+    bench(dpy, WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH, switches);
+    bench(dpy, WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE, switches);
+
+    waffle_display_disconnect(dpy);
+    waffle_teardown();
+    return EXIT_SUCCESS;
+}
@@ -28,6 +28,7 @@
 #include "wcore_error.h"
 #include "wcore_display.h"
 #include "wcore_platform.h"
+#include "wcore_tinfo.h"
 #include "wcore_util.h"
 
 WAFFLE_API struct waffle_display*
@@ -42,6 +43,16 @@ waffle_display_connect(const char *name)
     if (!wc_self)
         return NULL;
 
+    if (api_platform->caps_cache_path && wc_self->driver_id) {
+        // The same driver may sit behind different platforms and devices.
+        uint64_t id = wc_self->driver_id;
+        id = wcore_caps_hash(id, &api_platform->waffle_platform,
+                             sizeof(api_platform->waffle_platform));
+        id = wcore_caps_hash_string(id, name);
+        wcore_caps_cache_load(&wc_self->caps_cache,
+                              api_platform->caps_cache_path, id);
+    }
+
     return waffle_display(wc_self);
 }
 
@@ -57,7 +68,14 @@ waffle_display_disconnect(struct waffle_display *self)
     if (!api_check_entry(obj_list, 1))
         return false;
 
-    return api_platform->vtbl->display.destroy(wc_self);
+    wcore_tinfo_forget_current(wcore_tinfo_get(), wc_self);
+
+    wcore_caps_cache_finish(&wc_self->caps_cache);
+
+    bool ok = wcore_config_cache_finish(&wc_self->config_cache,
+                                        api_platform->vtbl->config.destroy);
+    ok &= api_platform->vtbl->display.destroy(wc_self);
+    return ok;
 }
 
 WAFFLE_API bool
@@ -90,6 +108,157 @@ waffle_display_supports_context_api(
                                                             context_api);
 }
 
+WAFFLE_API bool
+waffle_display_has_extension(
+        struct waffle_display *self,
+        const char *name)
+{
+    struct wcore_display *wc_self = wcore_display(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (name == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "name is NULL");
+        return false;
+    }
+
+    return wcore_ext_set_has(&wc_self->extensions, name);
+}
+
+WAFFLE_API bool
+waffle_display_query(
+        struct waffle_display *self,
+        int32_t attrib,
+        intptr_t *value)
+{
+    struct wcore_display *wc_self = wcore_display(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (value == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "value is null");
+        return false;
+    }
+
+    if (api_platform->vtbl->display.query) {
+        return api_platform->vtbl->display.query(wc_self, attrib, value);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+WAFFLE_API bool
+waffle_display_query_capability(
+        struct waffle_display *self,
+        int32_t context_api,
+        int32_t context_profile,
+        int32_t attrib,
+        intptr_t *value)
+{
+    struct wcore_display *wc_self = wcore_display(self);
+    int32_t version;
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (value == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "value is null");
+        return false;
+    }
+
+    switch (context_api) {
+        case WAFFLE_CONTEXT_OPENGL:
+            switch (context_profile) {
+                case WAFFLE_NONE:
+                case WAFFLE_CONTEXT_CORE_PROFILE:
+                case WAFFLE_CONTEXT_COMPATIBILITY_PROFILE:
+                    break;
+                default:
+                    wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                                 "context_profile has bad value %#x",
+                                 context_profile);
+                    return false;
+            }
+            break;
+        case WAFFLE_CONTEXT_OPENGL_ES1:
+        case WAFFLE_CONTEXT_OPENGL_ES2:
+        case WAFFLE_CONTEXT_OPENGL_ES3:
+            if (context_profile != WAFFLE_NONE) {
+                wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                             "context_profile must be WAFFLE_NONE for "
+                             "OpenGL ES");
+                return false;
+            }
+            break;
+        default:
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                         "context_api has bad value %#x", context_api);
+            return false;
+    }
+
+    version = wcore_caps_cache_get_version(&wc_self->caps_cache,
+                                           context_api, context_profile);
+
+    switch (attrib) {
+        case WAFFLE_CONTEXT_MAJOR_VERSION:
+            *value = version / 10;
+            return true;
+        case WAFFLE_CONTEXT_MINOR_VERSION:
+            *value = version % 10;
+            return true;
+        default:
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                         "attrib has bad value %#x", attrib);
+            return false;
+    }
+}
+
+WAFFLE_API bool
+waffle_display_query_renderer(
+        struct waffle_display *self,
+        int32_t attrib,
+        intptr_t *value)
+{
+    struct wcore_display *wc_self = wcore_display(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (value == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "value is null");
+        return false;
+    }
+
+    if (api_platform->vtbl->display.query_renderer) {
+        return api_platform->vtbl->display.query_renderer(wc_self, attrib,
+                                                          value);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
 WAFFLE_API union waffle_native_display*
 waffle_display_get_native(struct waffle_display *self)
 {
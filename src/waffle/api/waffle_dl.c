@@ -58,11 +58,35 @@ waffle_dl_can_open(int32_t dl)
 WAFFLE_API void*
 waffle_dl_sym(int32_t dl, const char *name)
 {
+    void *sym = NULL;
+
     if (!api_check_entry(NULL, 0))
         return NULL;
 
     if (!waffle_dl_check_enum(dl))
         return NULL;
 
-    return api_platform->vtbl->dl_sym(api_platform, dl, name);
+    if (!api_check_sym_batch(1, &name, &sym))
+        return NULL;
+
+    wcore_platform_sym_batch(api_platform, dl, 1, &name, &sym);
+    return sym;
+}
+
+WAFFLE_API bool
+waffle_dl_sym_batch(int32_t dl,
+                    size_t count,
+                    const char *const names[],
+                    void *syms[])
+{
+    if (!api_check_entry(NULL, 0))
+        return false;
+
+    if (!waffle_dl_check_enum(dl))
+        return false;
+
+    if (!api_check_sym_batch(count, names, syms))
+        return false;
+
+    return wcore_platform_sym_batch(api_platform, dl, count, names, syms);
 }
@@ -0,0 +1,158 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "api_priv.h"
+
+#include "wcore_config.h"
+#include "wcore_context.h"
+#include "wcore_error.h"
+#include "wcore_executor.h"
+#include "wcore_platform.h"
+
+WAFFLE_API struct waffle_executor*
+waffle_executor_create(
+        struct waffle_config *config,
+        struct waffle_context *shared_ctx,
+        const intptr_t attrib_list[])
+{
+    struct wcore_executor *wc_self;
+    struct wcore_config *wc_config = wcore_config(config);
+    struct wcore_context *wc_shared_ctx = wcore_context(shared_ctx);
+    intptr_t num_threads = 1;
+
+    const struct api_object *obj_list[2];
+    int len = 0;
+
+    obj_list[len++] = wc_config ? &wc_config->api : NULL;
+    if (wc_shared_ctx)
+        obj_list[len++] = &wc_shared_ctx->api;
+
+    if (!api_check_entry(obj_list, len))
+        return NULL;
+
+    if (api_platform->native_display_is_single_threaded) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "executors need a native display that is safe to use "
+                     "from another thread");
+        return NULL;
+    }
+
+    for (const intptr_t *i = attrib_list; i && *i != 0; i += 2) {
+        switch (i[0]) {
+            case WAFFLE_EXECUTOR_THREADS:
+                num_threads = i[1];
+                break;
+            default:
+                wcore_error_bad_attribute(i[0]);
+                return NULL;
+        }
+    }
+
+    if (num_threads <= 0 || num_threads > INT32_MAX) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_EXECUTOR_THREADS must be positive");
+        return NULL;
+    }
+
+    wc_self = wcore_executor_create(api_platform, wc_config, wc_shared_ctx,
+                                    (int32_t) num_threads);
+    if (!wc_self)
+        return NULL;
+
+    return waffle_executor(wc_self);
+}
+
+WAFFLE_API bool
+waffle_executor_destroy(struct waffle_executor *self)
+{
+    struct wcore_executor *wc_self = wcore_executor(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    return wcore_executor_destroy(wc_self);
+}
+
+WAFFLE_API struct waffle_executor_future*
+waffle_executor_submit(
+        struct waffle_executor *self,
+        bool (*func)(void *data),
+        void *data)
+{
+    struct wcore_executor *wc_self = wcore_executor(self);
+    struct wcore_executor_future *wc_future;
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return NULL;
+
+    if (func == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "func is null");
+        return NULL;
+    }
+
+    wc_future = wcore_executor_submit(wc_self, func, data);
+    if (!wc_future)
+        return NULL;
+
+    return waffle_executor_future(wc_future);
+}
+
+WAFFLE_API bool
+waffle_executor_future_is_ready(struct waffle_executor_future *self)
+{
+    struct wcore_executor_future *wc_self = wcore_executor_future(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    return wcore_executor_future_is_ready(wc_self);
+}
+
+WAFFLE_API bool
+waffle_executor_future_wait(struct waffle_executor_future *self)
+{
+    struct wcore_executor_future *wc_self = wcore_executor_future(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    return wcore_executor_future_wait(wc_self);
+}
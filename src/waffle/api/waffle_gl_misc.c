@@ -32,7 +32,9 @@
 #include "wcore_context.h"
 #include "wcore_display.h"
 #include "wcore_error.h"
+#include "wcore_gl_dispatch.h"
 #include "wcore_platform.h"
+#include "wcore_present.h"
 #include "wcore_tinfo.h"
 #include "wcore_window.h"
 
@@ -97,19 +99,80 @@ waffle_make_current(
     if (!api_check_entry(obj_list, len))
         return false;
 
-    ok = api_platform->vtbl->make_current(api_platform, wc_dpy, wc_window,
-                                          wc_ctx);
-    if (!ok)
+    tinfo = wcore_tinfo_get();
+
+    // A swap interval set from another thread is applied by the bind.
+    if (wcore_tinfo_is_current(tinfo, wc_dpy, wc_window, wc_ctx) &&
+        !(wc_window && wcore_window_swap_interval_dirty(wc_window))) {
+        // Without a way to query the native binding, validation can't
+        // succeed and the call falls through to the platform.
+        bool elide = !api_platform->validate_make_current ||
+                     (api_platform->vtbl->is_current &&
+                      api_platform->vtbl->is_current(api_platform, wc_dpy,
+                                                     wc_window, wc_ctx));
+        if (elide) {
+            ++tinfo->make_current_elided;
+            return true;
+        }
+    }
+
+    // An asynchronously presented window is bound on its present thread,
+    // never here.
+    if (wc_window && wc_window->present && wc_ctx)
+        ok = wcore_present_make_current(wc_window->present, wc_dpy, wc_ctx);
+    else if (wc_window && wc_window->present)
+        ok = api_platform->vtbl->make_current(api_platform, wc_dpy,
+                                              NULL, NULL);
+    else
+        ok = api_platform->vtbl->make_current(api_platform, wc_dpy,
+                                              wc_window, wc_ctx);
+    if (!ok) {
+        // The native binding is now unknown.
+        tinfo->current_is_valid = false;
         return false;
+    }
 
-    tinfo = wcore_tinfo_get();
-    tinfo->current_display = wc_dpy;
-    tinfo->current_window = wc_window;
-    tinfo->current_context = wc_ctx;
+    wcore_tinfo_set_current(tinfo, wc_dpy, wc_window, wc_ctx);
+
+    // Whether a context has fences may be known only once it is current.
+    // Checking here keeps the swaps of a frame-limited window from failing.
+    if (wc_window && wc_window->limiter && wc_ctx &&
+        api_platform->vtbl->fence.check_context &&
+        !api_platform->vtbl->fence.check_context(api_platform, wc_ctx)) {
+        WCORE_ERROR_DISABLED({
+            ok = api_platform->vtbl->make_current(api_platform, wc_dpy,
+                                                  NULL, NULL);
+        });
+        if (ok)
+            wcore_tinfo_set_current(tinfo, wc_dpy, NULL, NULL);
+        else
+            tinfo->current_is_valid = false;
+        return false;
+    }
+
+    if (wc_ctx && api_platform->gl_dispatch) {
+        if (!wc_ctx->dispatch) {
+            wc_ctx->dispatch = wcore_gl_dispatch_create(api_platform, wc_ctx);
+            if (!wc_ctx->dispatch) {
+                // The context is bound, but a retry must not be elided, or
+                // it would succeed without a dispatch table.
+                tinfo->current_is_valid = false;
+                return false;
+            }
+        }
+
+        tinfo->current_dispatch = wc_ctx->dispatch;
+    }
 
     return true;
 }
 
+WAFFLE_API uint64_t
+waffle_get_elided_make_current_count(void)
+{
+    return wcore_tinfo_get()->make_current_elided;
+}
+
 WAFFLE_API struct waffle_display *
 waffle_get_current_display(void)
 {
@@ -128,11 +191,40 @@ waffle_get_current_context(void)
     return waffle_context(wcore_tinfo_get()->current_context);
 }
 
+WAFFLE_API const struct waffle_gl_dispatch *
+waffle_get_current_dispatch(void)
+{
+    return wcore_tinfo_get()->current_dispatch;
+}
+
 WAFFLE_API void*
 waffle_get_proc_address(const char *name)
 {
+    void *proc = NULL;
+
     if (!api_check_entry(NULL, 0))
         return NULL;
 
-    return api_platform->vtbl->get_proc_address(api_platform, name);
+    if (!api_check_sym_batch(1, &name, &proc))
+        return NULL;
+
+    wcore_platform_sym_batch(api_platform, WCORE_SYM_CACHE_PROC_ADDRESS,
+                             1, &name, &proc);
+    return proc;
+}
+
+WAFFLE_API bool
+waffle_get_proc_address_batch(size_t count,
+                              const char *const names[],
+                              void *procs[])
+{
+    if (!api_check_entry(NULL, 0))
+        return false;
+
+    if (!api_check_sym_batch(count, names, procs))
+        return false;
+
+    return wcore_platform_sym_batch(api_platform,
+                                    WCORE_SYM_CACHE_PROC_ADDRESS,
+                                    count, names, procs);
 }
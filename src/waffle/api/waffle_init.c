@@ -23,8 +23,11 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <stdlib.h>
+
 #include "api_priv.h"
 
+#include "wcore_caps_cache.h"
 #include "wcore_error.h"
 #include "wcore_platform.h"
 
@@ -38,11 +41,15 @@ struct wcore_platform* wgl_platform_create(void);
 struct wcore_platform* nacl_platform_create(void);
 struct wcore_platform* sl_platform_create(void);
 struct wcore_platform* qnx_platform_create(void);
+struct wcore_platform* edev_platform_create(void);
 
 static bool
 waffle_init_parse_attrib_list(
         const int32_t attrib_list[],
-        int *platform)
+        int *platform,
+        bool *validate_make_current,
+        bool *gl_dispatch,
+        bool *capability_cache)
 {
     bool found_platform = false;
 
@@ -125,6 +132,12 @@ waffle_init_parse_attrib_list(
                     CASE_UNDEFINED_PLATFORM(QNX)
 #endif
 
+#ifdef WAFFLE_HAS_EGL_DEVICE
+                    CASE_DEFINED_PLATFORM(EGL_DEVICE)
+#else
+                    CASE_UNDEFINED_PLATFORM(EGL_DEVICE)
+#endif
+
                     default:
                         wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
                                      "WAFFLE_PLATFORM has bad value 0x%x",
@@ -135,6 +148,57 @@ waffle_init_parse_attrib_list(
                     #undef CASE_UNDEFINED_PLATFORM
                 }
 
+                break;
+            case WAFFLE_VALIDATE_MAKE_CURRENT:
+                switch (value) {
+                    case WAFFLE_DONT_CARE:
+                    case false:
+                        *validate_make_current = false;
+                        break;
+                    case true:
+                        *validate_make_current = true;
+                        break;
+                    default:
+                        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                                     "WAFFLE_VALIDATE_MAKE_CURRENT has bad "
+                                     "value 0x%x. Must be true(1), false(0), "
+                                     "or WAFFLE_DONT_CARE(-1)", value);
+                        return false;
+                }
+                break;
+            case WAFFLE_GL_DISPATCH:
+                switch (value) {
+                    case WAFFLE_DONT_CARE:
+                    case false:
+                        *gl_dispatch = false;
+                        break;
+                    case true:
+                        *gl_dispatch = true;
+                        break;
+                    default:
+                        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                                     "WAFFLE_GL_DISPATCH has bad value 0x%x. "
+                                     "Must be true(1), false(0), or "
+                                     "WAFFLE_DONT_CARE(-1)", value);
+                        return false;
+                }
+                break;
+            case WAFFLE_CAPABILITY_CACHE:
+                switch (value) {
+                    case WAFFLE_DONT_CARE:
+                    case false:
+                        *capability_cache = false;
+                        break;
+                    case true:
+                        *capability_cache = true;
+                        break;
+                    default:
+                        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                                     "WAFFLE_CAPABILITY_CACHE has bad value "
+                                     "0x%x. Must be true(1), false(0), or "
+                                     "WAFFLE_DONT_CARE(-1)", value);
+                        return false;
+                }
                 break;
             default:
                 wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
@@ -208,6 +272,11 @@ waffle_init_create_platform(int32_t waffle_platform)
         case WAFFLE_PLATFORM_QNX:
             wc_platform = qnx_platform_create();
             break;
+#endif
+#ifdef WAFFLE_HAS_EGL_DEVICE
+        case WAFFLE_PLATFORM_EGL_DEVICE:
+            wc_platform = edev_platform_create();
+            break;
 #endif
         default:
             assert(false);
@@ -225,6 +294,10 @@ waffle_init(const int32_t *attrib_list)
 {
     bool ok = true;
     int platform;
+    bool validate_make_current = false;
+    bool gl_dispatch = false;
+    bool capability_cache = false;
+    char *caps_cache_path = NULL;
 
     wcore_error_reset();
 
@@ -233,13 +306,28 @@ waffle_init(const int32_t *attrib_list)
         return false;
     }
 
-    ok &= waffle_init_parse_attrib_list(attrib_list, &platform);
+    ok &= waffle_init_parse_attrib_list(attrib_list, &platform,
+                                        &validate_make_current,
+                                        &gl_dispatch,
+                                        &capability_cache);
     if (!ok)
         return false;
 
+    if (capability_cache) {
+        caps_cache_path = wcore_caps_cache_default_path();
+        if (!caps_cache_path)
+            return false;
+    }
+
     api_platform = waffle_init_create_platform(platform);
-    if (!api_platform)
+    if (!api_platform) {
+        free(caps_cache_path);
         return false;
+    }
+
+    api_platform->validate_make_current = validate_make_current;
+    api_platform->gl_dispatch = gl_dispatch;
+    api_platform->caps_cache_path = caps_cache_path;
 
     return true;
 }
@@ -256,6 +344,9 @@ waffle_teardown(void)
         return false;
     }
 
+    // Finish the pending asynchronous work while the platform still works.
+    wcore_worker_stop(&api_platform->worker);
+
     ok &= api_platform->vtbl->destroy(api_platform);
     if (!ok)
         return false;
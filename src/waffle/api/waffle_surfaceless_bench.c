@@ -0,0 +1,279 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Measure the memory and time that each context's window costs, by creating
+// contexts that each render to their own window: once with a pbuffer-backed
+// window, once with a WAFFLE_WINDOW_SURFACELESS window, and once with no
+// window at all. Memory is the growth of the resident set size, so the
+// pbuffer numbers are meaningful only for drivers that keep surfaces in
+// system memory, such as llvmpipe.
+//
+// Usage: waffle_surfaceless_bench [platform [contexts [width height]]]
+
+#define _POSIX_C_SOURCE 199309L // clock_gettime()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "waffle.h"
+
+#define GL_COLOR_BUFFER_BIT 0x00004000
+
+typedef void (*glClear_t)(unsigned mask);
+typedef void (*glFinish_t)(void);
+
+enum mode {
+    MODE_PBUFFER,
+    MODE_SURFACELESS_WINDOW,
+    MODE_NO_WINDOW,
+};
+
+static const char *mode_names[] = {
+    [MODE_PBUFFER] = "pbuffer window",
+    [MODE_SURFACELESS_WINDOW] = "WAFFLE_WINDOW_SURFACELESS window",
+    [MODE_NO_WINDOW] = "no window",
+};
+
+static const struct {
+    const char *name;
+    int32_t platform;
+} platforms[] = {
+#ifdef WAFFLE_HAS_SURFACELESS_EGL
+    { "surfaceless_egl", WAFFLE_PLATFORM_SURFACELESS_EGL },
+#endif
+#ifdef WAFFLE_HAS_EGL_DEVICE
+    { "egl_device", WAFFLE_PLATFORM_EGL_DEVICE },
+#endif
+};
+
+static double
+now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static long
+rss_kib(void)
+{
+    long pages = 0;
+    FILE *f = fopen("/proc/self/statm", "r");
+
+    if (f) {
+        if (fscanf(f, "%*s %ld", &pages) != 1)
+            pages = 0;
+        fclose(f);
+    }
+
+    return pages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static const char *
+error_string(void)
+{
+    return waffle_error_to_string(waffle_error_get_code());
+}
+
+static void
+bench(struct waffle_display *dpy, struct waffle_config *config,
+      enum mode mode, int n, int32_t width, int32_t height)
+{
+    const intptr_t surfaceless_attrib_list[] = {
+        WAFFLE_WINDOW_SURFACELESS, true,
+        0,
+    };
+    struct waffle_context **ctx = calloc(n, sizeof(*ctx));
+    struct waffle_window **window = calloc(n, sizeof(*window));
+    glClear_t clear = NULL;
+    glFinish_t finish = NULL;
+    long rss0;
+    double t0, ms;
+
+    if (!ctx || !window) {
+        fprintf(stderr, "out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    rss0 = rss_kib();
+    t0 = now_ms();
+
+    for (int i = 0; i < n; ++i) {
+        ctx[i] = waffle_context_create(config, NULL);
+        if (!ctx[i]) {
+            fprintf(stderr, "waffle_context_create failed: %s\n",
+                    error_string());
+            exit(EXIT_FAILURE);
+        }
+
+        switch (mode) {
+            case MODE_PBUFFER:
+                window[i] = waffle_window_create(config, width, height);
+                break;
+            case MODE_SURFACELESS_WINDOW:
+                window[i] = waffle_window_create2(config,
+                                                  surfaceless_attrib_list);
+                break;
+            case MODE_NO_WINDOW:
+                break;
+        }
+
+        if (mode != MODE_NO_WINDOW && !window[i]) {
+            printf("  %-36s skipped: %s\n", mode_names[mode], error_string());
+            waffle_context_destroy(ctx[i]);
+            n = i;
+            goto cleanup;
+        }
+
+        // Drivers allocate lazily, so render once to charge each context
+        // and its surface in full. Without a surface, the clear goes to
+        // the incomplete default framebuffer and does nothing, which is
+        // the point.
+        if (!waffle_make_current(dpy, window[i], ctx[i])) {
+            printf("  %-36s skipped: %s\n", mode_names[mode], error_string());
+            waffle_context_destroy(ctx[i]);
+            waffle_window_destroy(window[i]);
+            n = i;
+            goto cleanup;
+        }
+
+        if (!clear) {
+            clear = (glClear_t) waffle_get_proc_address("glClear");
+            finish = (glFinish_t) waffle_get_proc_address("glFinish");
+            if (!clear || !finish) {
+                fprintf(stderr, "failed to resolve GL entry points\n");
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        clear(GL_COLOR_BUFFER_BIT);
+        finish();
+    }
+
+    ms = now_ms() - t0;
+    printf("  %-36s %8.1f KiB/context  %8.3f ms/context\n",
+           mode_names[mode], (double) (rss_kib() - rss0) / n, ms / n);
+
+cleanup:
+    waffle_make_current(dpy, NULL, NULL);
+
+    for (int i = 0; i < n; ++i) {
+        waffle_context_destroy(ctx[i]);
+        if (window[i])
+            waffle_window_destroy(window[i]);
+    }
+
+    free(ctx);
+    free(window);
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *platform_name = NULL;
+    int32_t platform = 0;
+    int n = 32;
+    int32_t width = 1920, height = 1080;
+    struct waffle_display *dpy;
+    struct waffle_config *config;
+
+    if (argc > 1)
+        platform_name = argv[1];
+    if (argc > 2)
+        n = strtol(argv[2], NULL, 0);
+    if (argc > 4) {
+        width = strtol(argv[3], NULL, 0);
+        height = strtol(argv[4], NULL, 0);
+    }
+
+    for (size_t i = 0; i < sizeof(platforms) / sizeof(platforms[0]); ++i) {
+        if (!platform_name || strcmp(platform_name, platforms[i].name) == 0) {
+            platform_name = platforms[i].name;
+            platform = platforms[i].platform;
+            break;
+        }
+    }
+
+    if (!platform || n <= 0 || width <= 0 || height <= 0) {
+        fprintf(stderr, "usage: waffle_surfaceless_bench "
+                "[platform [contexts [width height]]]\n");
+        return EXIT_FAILURE;
+    }
+
+    const int32_t init_attrib_list[] = {
+        WAFFLE_PLATFORM, platform,
+        0,
+    };
+
+    const int32_t config_attrib_list[] = {
+        WAFFLE_CONTEXT_API,         WAFFLE_CONTEXT_OPENGL_ES2,
+        WAFFLE_RED_SIZE,            8,
+        WAFFLE_GREEN_SIZE,          8,
+        WAFFLE_BLUE_SIZE,           8,
+        WAFFLE_ALPHA_SIZE,          8,
+        0,
+    };
+
+    if (!waffle_init(init_attrib_list)) {
+        fprintf(stderr, "waffle_init failed: %s\n", error_string());
+        return EXIT_FAILURE;
+    }
+
+    dpy = waffle_display_connect(NULL);
+    if (!dpy) {
+        printf("skipped: waffle_display_connect failed: %s\n", error_string());
+        waffle_teardown();
+        return EXIT_SUCCESS;
+    }
+
+    config = waffle_config_choose(dpy, config_attrib_list);
+    if (!config) {
+        printf("skipped: waffle_config_choose failed: %s\n", error_string());
+        waffle_display_disconnect(dpy);
+        waffle_teardown();
+        return EXIT_SUCCESS;
+    }
+
+    printf("%s, %d contexts, %dx%d pbuffers\n",
+           platform_name, n, width, height);
+
+    // Warm up, so that the first mode does not pay for loading the driver.
+    printf("warm-up:\n");
+    bench(dpy, config, MODE_NO_WINDOW, 1, width, height);
+
+    printf("results:\n");
+    bench(dpy, config, MODE_PBUFFER, n, width, height);
+    bench(dpy, config, MODE_SURFACELESS_WINDOW, n, width, height);
+    bench(dpy, config, MODE_NO_WINDOW, n, width, height);
+
+    waffle_config_destroy(config);
+    waffle_display_disconnect(dpy);
+    waffle_teardown();
+    return EXIT_SUCCESS;
+}
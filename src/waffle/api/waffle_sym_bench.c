@@ -0,0 +1,266 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Measure what a GL loader pays at startup to resolve every entry point
+// declared in glext.h, through waffle_get_proc_address() and
+// waffle_dl_sym(), one at a time and in batches.
+//
+// The cold passes run against a freshly initialized platform, so they cost
+// what the uncached lookups did. The warm passes repeat the same lookups,
+// as a loader does for each additional context.
+//
+// Usage: waffle_sym_bench [platform [glext.h]]
+
+#define _POSIX_C_SOURCE 199309L // clock_gettime()
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "waffle.h"
+
+static const struct {
+    const char *name;
+    int32_t platform;
+} platforms[] = {
+#ifdef WAFFLE_HAS_SURFACELESS_EGL
+    { "surfaceless_egl", WAFFLE_PLATFORM_SURFACELESS_EGL },
+#endif
+#ifdef WAFFLE_HAS_EGL_DEVICE
+    { "egl_device", WAFFLE_PLATFORM_EGL_DEVICE },
+#endif
+#ifdef WAFFLE_HAS_GBM
+    { "gbm", WAFFLE_PLATFORM_GBM },
+#endif
+#ifdef WAFFLE_HAS_GLX
+    { "glx", WAFFLE_PLATFORM_GLX },
+#endif
+#ifdef WAFFLE_HAS_X11_EGL
+    { "x11_egl", WAFFLE_PLATFORM_X11_EGL },
+#endif
+#ifdef WAFFLE_HAS_WAYLAND
+    { "wayland", WAFFLE_PLATFORM_WAYLAND },
+#endif
+};
+
+static double
+now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/// Collect the names of the "APIENTRY glFoo (" declarations.
+static size_t
+read_names(const char *path, char ***names_out)
+{
+    char line[1024];
+    char **names = NULL;
+    size_t count = 0, capacity = 0;
+    FILE *f = fopen(path, "r");
+
+    if (!f)
+        return 0;
+
+    while (fgets(line, sizeof(line), f)) {
+        const char *p = strstr(line, "APIENTRY gl");
+        size_t len = 0;
+
+        if (!p || strncmp(line, "GLAPI", 5) != 0)
+            continue;
+
+        p += strlen("APIENTRY ");
+        while (isalnum((unsigned char) p[len]) || p[len] == '_')
+            ++len;
+
+        if (count == capacity) {
+            capacity = capacity ? 2 * capacity : 1024;
+            names = realloc(names, capacity * sizeof(*names));
+            if (!names)
+                abort();
+        }
+
+        names[count] = malloc(len + 1);
+        if (!names[count])
+            abort();
+        memcpy(names[count], p, len);
+        names[count][len] = '\0';
+        ++count;
+    }
+
+    fclose(f);
+    *names_out = names;
+    return count;
+}
+
+static void
+init(int32_t platform)
+{
+    const int32_t attrib_list[] = {
+        WAFFLE_PLATFORM, platform,
+        0,
+    };
+
+    if (!waffle_init(attrib_list)) {
+        fprintf(stderr, "waffle_init failed: %s\n",
+                waffle_error_to_string(waffle_error_get_code()));
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void
+report(const char *label, double ms, size_t count, size_t found)
+{
+    printf("  %-36s %8.3f ms  %6.0f ns/symbol  (%zu/%zu found)\n",
+           label, ms, ms * 1e6 / count, found, count);
+}
+
+static size_t
+count_found(void **syms, size_t count)
+{
+    size_t found = 0;
+
+    for (size_t i = 0; i < count; ++i)
+        found += syms[i] != NULL;
+
+    return found;
+}
+
+static void
+bench_single(int32_t dl, const char *label, const char *const names[],
+             void **syms, size_t count)
+{
+    char buf[64];
+
+    for (int pass = 0; pass < 2; ++pass) {
+        double t0 = now_ms();
+
+        for (size_t i = 0; i < count; ++i) {
+            if (dl)
+                syms[i] = waffle_dl_sym(dl, names[i]);
+            else
+                syms[i] = waffle_get_proc_address(names[i]);
+        }
+
+        snprintf(buf, sizeof(buf), "%s, %s", label,
+                 pass == 0 ? "cold" : "warm");
+        report(buf, now_ms() - t0, count, count_found(syms, count));
+    }
+}
+
+static void
+bench_batch(int32_t dl, const char *label, const char *const names[],
+            void **syms, size_t count)
+{
+    char buf[64];
+
+    for (int pass = 0; pass < 2; ++pass) {
+        double t0 = now_ms();
+
+        if (dl)
+            waffle_dl_sym_batch(dl, count, names, syms);
+        else
+            waffle_get_proc_address_batch(count, names, syms);
+
+        snprintf(buf, sizeof(buf), "%s batch, %s", label,
+                 pass == 0 ? "cold" : "warm");
+        report(buf, now_ms() - t0, count, count_found(syms, count));
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *platform_name = NULL;
+    const char *header = "/usr/include/GL/glext.h";
+    int32_t platform = 0;
+    char **names;
+    void **syms;
+    size_t count;
+
+    if (argc > 1)
+        platform_name = argv[1];
+    if (argc > 2)
+        header = argv[2];
+
+    for (size_t i = 0; i < sizeof(platforms) / sizeof(platforms[0]); ++i) {
+        if (!platform_name || strcmp(platform_name, platforms[i].name) == 0) {
+            platform_name = platforms[i].name;
+            platform = platforms[i].platform;
+            break;
+        }
+    }
+
+    if (!platform) {
+        fprintf(stderr, "usage: waffle_sym_bench [platform [glext.h]]\n");
+        return EXIT_FAILURE;
+    }
+
+    count = read_names(header, &names);
+    if (count == 0) {
+        printf("skipped: no GL entry points found in %s\n", header);
+        return EXIT_SUCCESS;
+    }
+
+    syms = calloc(count, sizeof(*syms));
+    if (!syms)
+        abort();
+
+    printf("%s, %zu entry points from %s\n", platform_name, count, header);
+
+    // Each measurement starts from an empty cache.
+    init(platform);
+    bench_single(0, "waffle_get_proc_address", (const char **) names,
+                 syms, count);
+    waffle_teardown();
+
+    init(platform);
+    bench_batch(0, "waffle_get_proc_address", (const char **) names,
+                syms, count);
+    waffle_teardown();
+
+    init(platform);
+    if (waffle_dl_can_open(WAFFLE_DL_OPENGL)) {
+        bench_single(WAFFLE_DL_OPENGL, "waffle_dl_sym", (const char **) names,
+                     syms, count);
+        waffle_teardown();
+
+        init(platform);
+        bench_batch(WAFFLE_DL_OPENGL, "waffle_dl_sym", (const char **) names,
+                    syms, count);
+    }
+    waffle_teardown();
+
+    for (size_t i = 0; i < count; ++i)
+        free(names[i]);
+    free(names);
+    free(syms);
+
+    return EXIT_SUCCESS;
+}
@@ -30,7 +30,10 @@
 #include "wcore_attrib_list.h"
 #include "wcore_config.h"
 #include "wcore_error.h"
+#include "wcore_frame_limiter.h"
 #include "wcore_platform.h"
+#include "wcore_present.h"
+#include "wcore_tinfo.h"
 #include "wcore_window.h"
 
 WAFFLE_API struct waffle_window*
@@ -44,6 +47,13 @@ waffle_window_create2(
     intptr_t width = 1, height = 1;
     bool need_size = true;
     intptr_t fullscreen = WAFFLE_DONT_CARE;
+    intptr_t surfaceless = false;
+    intptr_t swap_interval = WAFFLE_DONT_CARE;
+    bool has_swap_interval;
+    intptr_t async_present = false;
+    intptr_t queue_depth = 2;
+    bool has_queue_depth;
+    intptr_t max_frames = WAFFLE_DONT_CARE;
 
     const struct api_object *obj_list[] = {
         wc_config ? &wc_config->api : NULL,
@@ -71,6 +81,28 @@ waffle_window_create2(
         goto done;
     }
 
+    // The attribute stays in the list for the platform, which validates its
+    // value and rejects it if unsupported. Only its effect on the size is
+    // handled here.
+    wcore_attrib_list_get(attrib_list_filtered,
+                          WAFFLE_WINDOW_SURFACELESS, &surfaceless);
+    if (surfaceless == true) {
+        if (fullscreen) {
+            wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                         "WAFFLE_WINDOW_FULLSCREEN and "
+                         "WAFFLE_WINDOW_SURFACELESS are mutually exclusive");
+            goto done;
+        }
+
+        need_size = false;
+        width = height = 0;
+    } else if (wc_config->attrs.no_config) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "a config chosen with WAFFLE_NO_CONFIG has no "
+                     "framebuffer format to create a window with");
+        goto done;
+    }
+
     if (!wcore_attrib_list_pop(attrib_list_filtered,
                                WAFFLE_WINDOW_WIDTH, &width) && need_size) {
         wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
@@ -85,7 +117,14 @@ waffle_window_create2(
         goto done;
     }
 
-    if (width <= 0) {
+    if (surfaceless == true) {
+        if (width != 0 || height != 0) {
+            wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                         "a WAFFLE_WINDOW_SURFACELESS window must have "
+                         "zero size");
+            goto done;
+        }
+    } else if (width <= 0) {
         wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
                      "WAFFLE_WINDOW_WIDTH is not positive");
         goto done;
@@ -95,7 +134,9 @@ waffle_window_create2(
         goto done;
     }
 
-    if (height <= 0) {
+    if (surfaceless == true) {
+        // Checked above.
+    } else if (height <= 0) {
         wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
                      "WAFFLE_WINDOW_HEIGHT is not positive");
         goto done;
@@ -105,6 +146,106 @@ waffle_window_create2(
         goto done;
     }
 
+    has_swap_interval = wcore_attrib_list_pop(attrib_list_filtered,
+                                              WAFFLE_WINDOW_SWAP_INTERVAL,
+                                              &swap_interval);
+    if (has_swap_interval &&
+        (swap_interval < INT32_MIN || swap_interval > INT32_MAX)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_WINDOW_SWAP_INTERVAL is out of range");
+        goto done;
+    }
+
+    if (has_swap_interval && !api_platform->vtbl->window.set_swap_interval) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "WAFFLE_WINDOW_SWAP_INTERVAL is not supported");
+        goto done;
+    }
+
+    wcore_attrib_list_pop(attrib_list_filtered,
+                          WAFFLE_WINDOW_ASYNC_PRESENT, &async_present);
+    if (async_present != true && async_present != false) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_WINDOW_ASYNC_PRESENT has bad value 0x%x. "
+                     "Must be true(1) or false(0)",
+                     async_present);
+        goto done;
+    }
+
+    // The present thread blits the frame to the window's surface, and
+    // neither GL nor GLES can blit to a multisampled framebuffer from
+    // renderbuffers whose format differs from the surface's.
+    if (async_present && wc_config->attrs.sample_buffers) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_WINDOW_ASYNC_PRESENT requires a config without "
+                     "WAFFLE_SAMPLE_BUFFERS");
+        goto done;
+    }
+
+    if (async_present && api_platform->native_display_is_single_threaded) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "WAFFLE_WINDOW_ASYNC_PRESENT needs a native display "
+                     "that is safe to use from another thread");
+        goto done;
+    }
+
+    has_queue_depth = wcore_attrib_list_pop(attrib_list_filtered,
+                                            WAFFLE_WINDOW_PRESENT_QUEUE_DEPTH,
+                                            &queue_depth);
+    if (has_queue_depth && !async_present) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_WINDOW_PRESENT_QUEUE_DEPTH requires "
+                     "WAFFLE_WINDOW_ASYNC_PRESENT");
+        goto done;
+    }
+
+    if (queue_depth <= 0 || queue_depth >= INT32_MAX) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_WINDOW_PRESENT_QUEUE_DEPTH must be positive");
+        goto done;
+    }
+
+    // The present thread blits frames of the size the window was given.
+    if (async_present && (fullscreen || surfaceless == true)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_WINDOW_ASYNC_PRESENT requires a window of "
+                     "explicit, nonzero size");
+        goto done;
+    }
+
+    wcore_attrib_list_pop(attrib_list_filtered,
+                          WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT, &max_frames);
+    if (max_frames != WAFFLE_DONT_CARE &&
+        (max_frames <= 0 || max_frames > INT32_MAX)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT must be positive "
+                     "or WAFFLE_DONT_CARE(-1)");
+        goto done;
+    }
+
+    // The present queue already bounds the frames in flight.
+    if (max_frames != WAFFLE_DONT_CARE && async_present) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT and "
+                     "WAFFLE_WINDOW_ASYNC_PRESENT are mutually exclusive");
+        goto done;
+    }
+
+    if (max_frames != WAFFLE_DONT_CARE &&
+        !api_platform->vtbl->fence.create) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT is not supported");
+        goto done;
+    }
+
+    // Platforms whose fences depend on the context check it when the
+    // window is first made current.
+    if (max_frames != WAFFLE_DONT_CARE &&
+        api_platform->vtbl->fence.check_display &&
+        !api_platform->vtbl->fence.check_display(api_platform,
+                                                 wc_config->display))
+        goto done;
+
     if (fullscreen)
         width = height = -1;
 
@@ -114,6 +255,43 @@ waffle_window_create2(
                                                 (int32_t) height,
                                                 attrib_list_filtered);
 
+    if (wc_self && async_present) {
+        wc_self->present = wcore_present_create(api_platform, wc_self,
+                                                wc_config,
+                                                (int32_t) queue_depth,
+                                                (int32_t) width,
+                                                (int32_t) height);
+        if (!wc_self->present) {
+            WCORE_ERROR_DISABLED({
+                api_platform->vtbl->window.destroy(wc_self);
+            });
+            wc_self = NULL;
+        }
+    }
+
+    if (wc_self && max_frames != WAFFLE_DONT_CARE) {
+        wc_self->limiter = wcore_frame_limiter_create(api_platform,
+                                                      (int32_t) max_frames);
+        if (!wc_self->limiter) {
+            WCORE_ERROR_DISABLED({
+                api_platform->vtbl->window.destroy(wc_self);
+            });
+            wc_self = NULL;
+        }
+    }
+
+    if (wc_self && has_swap_interval &&
+        !api_platform->vtbl->window.set_swap_interval(wc_self,
+                                                      (int32_t) swap_interval)) {
+        WCORE_ERROR_DISABLED({
+            if (wc_self->present)
+                wcore_present_destroy(wc_self->present);
+            wcore_frame_limiter_destroy(wc_self->limiter);
+            api_platform->vtbl->window.destroy(wc_self);
+        });
+        wc_self = NULL;
+    }
+
 done:
     free(attrib_list_filtered);
 
@@ -142,6 +320,7 @@ WAFFLE_API bool
 waffle_window_destroy(struct waffle_window *self)
 {
     struct wcore_window *wc_self = wcore_window(self);
+    bool ok = true;
 
     const struct api_object *obj_list[] = {
         wc_self ? &wc_self->api : NULL,
@@ -150,7 +329,15 @@ waffle_window_destroy(struct waffle_window *self)
     if (!api_check_entry(obj_list, 1))
         return false;
 
-    return api_platform->vtbl->window.destroy(wc_self);
+    // Stop presenting before the surface goes away.
+    if (wc_self->present)
+        ok &= wcore_present_destroy(wc_self->present);
+
+    ok &= wcore_frame_limiter_destroy(wc_self->limiter);
+
+    wcore_tinfo_forget_current(wcore_tinfo_get(), wc_self);
+    ok &= api_platform->vtbl->window.destroy(wc_self);
+    return ok;
 }
 
 WAFFLE_API bool
@@ -184,7 +371,235 @@ waffle_window_resize(
         return false;
 
     if (api_platform->vtbl->window.resize) {
-        return api_platform->vtbl->window.resize(wc_self, width, height);
+        if (!api_platform->vtbl->window.resize(wc_self, width, height))
+            return false;
+
+        if (wc_self->present)
+            wcore_present_resize(wc_self->present, width, height);
+
+        return true;
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+WAFFLE_API bool
+waffle_window_set_swap_interval(
+        struct waffle_window *self,
+        int32_t interval)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (api_platform->vtbl->window.set_swap_interval) {
+        if (wc_self->present)
+            return wcore_present_set_swap_interval(wc_self->present,
+                                                   interval);
+
+        return api_platform->vtbl->window.set_swap_interval(wc_self, interval);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+WAFFLE_API bool
+waffle_window_query(
+        struct waffle_window *self,
+        int32_t attrib,
+        intptr_t *value)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (value == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "value is null");
+        return false;
+    }
+
+    // These are the same on every platform.
+    switch (attrib) {
+        case WAFFLE_WINDOW_ASYNC_PRESENT:
+            *value = wc_self->present != NULL;
+            return true;
+        case WAFFLE_WINDOW_PRESENT_QUEUE_DEPTH:
+            *value = wc_self->present ? wc_self->present->depth : 0;
+            return true;
+        case WAFFLE_WINDOW_FRAMEBUFFER:
+            *value = wc_self->present ? wc_self->present->fbo : 0;
+            return true;
+        case WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT:
+            *value = wc_self->limiter ? wc_self->limiter->max_frames
+                                      : WAFFLE_DONT_CARE;
+            return true;
+        default:
+            break;
+    }
+
+    if (api_platform->vtbl->window.query) {
+        return api_platform->vtbl->window.query(wc_self, attrib, value);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+static bool
+check_rects(const int32_t *rects, int32_t n_rects)
+{
+    if (n_rects < 0) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "n_rects is negative: %d", n_rects);
+        return false;
+    }
+
+    if (n_rects > 0 && rects == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "rects is null");
+        return false;
+    }
+
+    for (int32_t i = 0; i < n_rects; ++i) {
+        if (rects[4 * i + 2] < 0 || rects[4 * i + 3] < 0) {
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                         "rect %d has negative size", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Fence the frame about to be swapped, after waiting for the frames beyond
+/// the window's WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT. This runs before the
+/// swap, so that a failure never reports a frame that was presented.
+static bool
+limit_frames(struct wcore_window *wc_self)
+{
+    struct wcore_tinfo *tinfo = wcore_tinfo_get();
+
+    // A fence goes into the current context, so only frames drawn on the
+    // calling thread can be limited.
+    if (!wc_self->limiter || tinfo->current_window != wc_self ||
+        !tinfo->current_context)
+        return true;
+
+    return wcore_frame_limiter_end_frame(wc_self->limiter, wc_self->display,
+                                         tinfo->current_context);
+}
+
+WAFFLE_API bool
+waffle_window_swap_buffers_with_damage(
+        struct waffle_window *self,
+        const int32_t *rects,
+        int32_t n_rects)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (!check_rects(rects, n_rects))
+        return false;
+
+    // The whole frame is blitted to the surface regardless.
+    if (wc_self->present)
+        return wcore_present_swap(wc_self->present);
+
+    if (api_platform->vtbl->window.swap_buffers_with_damage) {
+        if (!limit_frames(wc_self))
+            return false;
+
+        return api_platform->vtbl->window.swap_buffers_with_damage(wc_self,
+                                                                   rects,
+                                                                   n_rects);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+WAFFLE_API bool
+waffle_window_get_buffer_age(
+        struct waffle_window *self,
+        int32_t *age)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (age == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "age is null");
+        return false;
+    }
+
+    // Frames rotate through buffers that the application cannot track.
+    if (wc_self->present) {
+        *age = 0;
+        return true;
+    }
+
+    if (api_platform->vtbl->window.get_buffer_age) {
+        return api_platform->vtbl->window.get_buffer_age(wc_self, age);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+WAFFLE_API bool
+waffle_window_set_damage_region(
+        struct waffle_window *self,
+        const int32_t *rects,
+        int32_t n_rects)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (!check_rects(rects, n_rects))
+        return false;
+
+    // The region only lets the driver skip work, and the present thread
+    // blits the whole frame.
+    if (wc_self->present)
+        return true;
+
+    if (api_platform->vtbl->window.set_damage_region) {
+        return api_platform->vtbl->window.set_damage_region(wc_self,
+                                                            rects,
+                                                            n_rects);
     }
     else {
         wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
@@ -204,6 +619,12 @@ waffle_window_swap_buffers(struct waffle_window *self)
     if (!api_check_entry(obj_list, 1))
         return false;
 
+    if (wc_self->present)
+        return wcore_present_swap(wc_self->present);
+
+    if (!limit_frames(wc_self))
+        return false;
+
     return api_platform->vtbl->window.swap_buffers(wc_self);
 }
 
@@ -28,6 +28,7 @@
 #include <string.h>
 
 #include "wcore_config_attrs.h"
+#include "wcore_config_rank.h"
 #include "wcore_error.h"
 
 #include "cgl_config.h"
@@ -88,6 +89,32 @@ cgl_config_check_attrs(const struct cgl_platform *plat,
         return false;
     }
 
+    if (attrs->context_no_error) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "CGL does not support no-error contexts");
+        return false;
+    }
+
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "CGL does not support controlling the context release "
+                     "behavior");
+        return false;
+    }
+
+    if (attrs->no_config) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "CGL does not support WAFFLE_NO_CONFIG");
+        return false;
+    }
+
+    if (wcore_config_rank_needed(attrs)) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "CGL does not support WAFFLE_CONFIG_RANKING or "
+                     "WAFFLE_SAMPLES_FALLBACK");
+        return false;
+    }
+
     // Emulate EGL_KHR_create_context, which allows the implementation to
     // return a context of the latest supported flavor that is
     // backwards-compatibile with the requested flavor.
@@ -0,0 +1,533 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define _GNU_SOURCE // dl_iterate_phdr()
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <link.h>
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include "threads.h"
+
+#include "waffle.h"
+
+#include "wcore_caps_cache.h"
+#include "wcore_config_attrs.h"
+#include "wcore_error.h"
+#include "wcore_util.h"
+
+#define FILE_MAGIC "WAFFCAPS"
+
+enum {
+    FILE_VERSION = 1,
+
+    /// Records of other drivers beyond this many are dropped, oldest first.
+    MAX_RECORDS = 64,
+};
+
+struct file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t num_records;
+    uint32_t reserved;
+};
+
+// Serializes access to the file, and to the records of displays that are
+// shared between threads.
+static mtx_t mutex;
+
+static void
+wcore_caps_cache_init_once(void)
+{
+    mtx_init(&mutex, mtx_plain);
+}
+
+static void
+lock(void)
+{
+    static once_flag flag = ONCE_FLAG_INIT;
+
+    call_once(&flag, wcore_caps_cache_init_once);
+    mtx_lock(&mutex);
+}
+
+char*
+wcore_caps_cache_default_path(void)
+{
+    const char *file = getenv("WAFFLE_CAPABILITY_CACHE_FILE");
+    const char *xdg = getenv("XDG_CACHE_HOME");
+    const char *home = getenv("HOME");
+    char *path;
+    size_t len;
+
+    if (file && file[0])
+        return wcore_strdup(file);
+
+    if (xdg && xdg[0]) {
+        len = strlen(xdg) + sizeof("/waffle/capabilities");
+        path = wcore_malloc(len);
+        if (path)
+            snprintf(path, len, "%s/waffle/capabilities", xdg);
+        return path;
+    }
+
+    if (home && home[0]) {
+        len = strlen(home) + sizeof("/.cache/waffle/capabilities");
+        path = wcore_malloc(len);
+        if (path)
+            snprintf(path, len, "%s/.cache/waffle/capabilities", home);
+        return path;
+    }
+
+    wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                 "WAFFLE_CAPABILITY_CACHE requires "
+                 "WAFFLE_CAPABILITY_CACHE_FILE, XDG_CACHE_HOME or HOME "
+                 "to be set");
+    return NULL;
+}
+
+uint64_t
+wcore_caps_hash(uint64_t id, const void *data, size_t len)
+{
+    const uint64_t k = 0x9e3779b97f4a7c15ull;
+
+    return (id ^ wcore_hash_string(data, len)) * k + len;
+}
+
+uint64_t
+wcore_caps_hash_string(uint64_t id, const char *s)
+{
+    // Distinguish null from "".
+    if (!s)
+        return wcore_caps_hash(id, "\xff", 1);
+
+    return wcore_caps_hash(id, s, strlen(s));
+}
+
+#ifdef __linux__
+static bool
+is_driver_file(const char *path)
+{
+    static const char *const patterns[] = {
+        "EGL", "libGL", "_dri", "gallium", "mesa", "nvidia",
+    };
+    const char *base = strrchr(path, '/');
+
+    base = base ? base + 1 : path;
+
+    for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); ++i) {
+        if (strstr(base, patterns[i]))
+            return true;
+    }
+
+    return false;
+}
+
+static int
+hash_driver_file(struct dl_phdr_info *info, size_t size, void *data)
+{
+    uint64_t *sum = data;
+    struct stat st;
+    int64_t ident[4];
+
+    (void) size;
+
+    if (!info->dlpi_name || !is_driver_file(info->dlpi_name))
+        return 0;
+
+    if (stat(info->dlpi_name, &st) != 0)
+        return 0;
+
+    ident[0] = st.st_dev;
+    ident[1] = st.st_ino;
+    ident[2] = st.st_size;
+    ident[3] = st.st_mtime;
+
+    // Summed, so that the order in which the libraries were loaded does
+    // not matter.
+    *sum += wcore_caps_hash(0, ident, sizeof(ident));
+    return 0;
+}
+#endif
+
+uint64_t
+wcore_caps_hash_driver_files(uint64_t id)
+{
+#ifdef __linux__
+    uint64_t sum = 0;
+
+    dl_iterate_phdr(hash_driver_file, &sum);
+    id = wcore_caps_hash(id, &sum, sizeof(sum));
+#endif
+    return id;
+}
+
+#ifndef _WIN32
+/// @brief Map the file at @a path and return its records, or null if it is
+/// missing or malformed. Unmap with munmap(*map, *map_size).
+static const struct wcore_caps*
+map_records(const char *path, void **map, size_t *map_size,
+            uint32_t *num_records)
+{
+    const struct file_header *header;
+    struct stat st;
+    void *m;
+    int fd;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return NULL;
+
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(*header)) {
+        close(fd);
+        return NULL;
+    }
+
+    m = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (m == MAP_FAILED)
+        return NULL;
+
+    header = m;
+    if (memcmp(header->magic, FILE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != FILE_VERSION ||
+        header->record_size != sizeof(struct wcore_caps) ||
+        header->num_records > MAX_RECORDS ||
+        (size_t) st.st_size != sizeof(*header) +
+                               header->num_records * sizeof(struct wcore_caps)) {
+        munmap(m, st.st_size);
+        return NULL;
+    }
+
+    *map = m;
+    *map_size = st.st_size;
+    *num_records = header->num_records;
+    return (const struct wcore_caps*) (header + 1);
+}
+
+/// @brief Create the directories leading to @a path.
+static void
+make_parent_dirs(const char *path)
+{
+    char *dir = wcore_strdup(path);
+
+    if (!dir)
+        return;
+
+    for (char *p = strchr(dir + 1, '/'); p; p = strchr(p + 1, '/')) {
+        *p = '\0';
+        mkdir(dir, 0755);
+        *p = '/';
+    }
+
+    free(dir);
+}
+
+static bool
+write_all(int fd, const void *data, size_t size)
+{
+    const char *p = data;
+
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        size -= n;
+    }
+
+    return true;
+}
+
+/// @brief Replace the file with one that holds @a caps and the most recent
+/// records of other drivers.
+static void
+store(const char *path, const struct wcore_caps *caps)
+{
+    struct file_header header = {
+        .magic = FILE_MAGIC,
+        .version = FILE_VERSION,
+        .record_size = sizeof(*caps),
+    };
+    const struct wcore_caps *old;
+    void *map = NULL;
+    size_t map_size = 0;
+    uint32_t num_old = 0;
+    uint32_t first = 0;
+    uint32_t num_kept = 0;
+    size_t tmp_len = strlen(path) + sizeof(".XXXXXX");
+    char *tmp;
+    bool ok;
+    int fd;
+
+    tmp = wcore_malloc(tmp_len);
+    if (!tmp)
+        return;
+    snprintf(tmp, tmp_len, "%s.XXXXXX", path);
+
+    make_parent_dirs(path);
+    fd = mkstemp(tmp);
+    if (fd < 0) {
+        free(tmp);
+        return;
+    }
+
+    old = map_records(path, &map, &map_size, &num_old);
+
+    for (uint32_t i = 0; i < num_old; ++i) {
+        if (old[i].driver_id != caps->driver_id)
+            num_kept++;
+    }
+
+    if (num_kept > MAX_RECORDS - 1) {
+        first = num_kept - (MAX_RECORDS - 1);
+        num_kept = MAX_RECORDS - 1;
+    }
+
+    header.num_records = num_kept + 1;
+    ok = write_all(fd, &header, sizeof(header));
+
+    // The record just written goes last, as the most recently used.
+    for (uint32_t i = 0, j = 0; ok && i < num_old; ++i) {
+        if (old[i].driver_id == caps->driver_id)
+            continue;
+        if (j++ >= first)
+            ok &= write_all(fd, &old[i], sizeof(old[i]));
+    }
+
+    ok = ok && write_all(fd, caps, sizeof(*caps));
+    ok &= close(fd) == 0;
+
+    if (map)
+        munmap(map, map_size);
+
+    if (!ok || rename(tmp, path) != 0)
+        unlink(tmp);
+
+    free(tmp);
+}
+#else
+static const struct wcore_caps*
+map_records(const char *path, void **map, size_t *map_size,
+            uint32_t *num_records)
+{
+    return NULL;
+}
+
+static void
+store(const char *path, const struct wcore_caps *caps)
+{
+}
+#endif
+
+void
+wcore_caps_cache_load(struct wcore_caps_cache *self,
+                      const char *path,
+                      uint64_t driver_id)
+{
+    const struct wcore_caps *records;
+    void *map = NULL;
+    size_t map_size = 0;
+    uint32_t num_records = 0;
+
+    memset(self, 0, sizeof(*self));
+    self->path = path;
+    self->caps.driver_id = driver_id;
+
+    lock();
+    records = map_records(path, &map, &map_size, &num_records);
+    for (uint32_t i = 0; i < num_records; ++i) {
+        if (records[i].driver_id == driver_id) {
+            memcpy(&self->caps, &records[i], sizeof(self->caps));
+            break;
+        }
+    }
+    mtx_unlock(&mutex);
+
+    if (map)
+        munmap(map, map_size);
+
+    // Guard against a record that is well formed but nonsensical.
+    if (self->caps.num_configs < 0 ||
+        self->caps.num_configs > WCORE_CAPS_MAX_CONFIGS)
+        self->caps.num_configs = 0;
+}
+
+void
+wcore_caps_cache_finish(struct wcore_caps_cache *self)
+{
+    if (!self->path)
+        return;
+
+    lock();
+    if (self->dirty)
+        store(self->path, &self->caps);
+    mtx_unlock(&mutex);
+
+    memset(self, 0, sizeof(*self));
+}
+
+static int
+version_index(int32_t context_api, int32_t context_profile)
+{
+    switch (context_api) {
+        case WAFFLE_CONTEXT_OPENGL:
+            switch (context_profile) {
+                case WAFFLE_CONTEXT_CORE_PROFILE:
+                    return 1;
+                case WAFFLE_CONTEXT_COMPATIBILITY_PROFILE:
+                    return 2;
+                default:
+                    return 0;
+            }
+        case WAFFLE_CONTEXT_OPENGL_ES1:
+            return 3;
+        case WAFFLE_CONTEXT_OPENGL_ES2:
+            return 4;
+        case WAFFLE_CONTEXT_OPENGL_ES3:
+            return 5;
+        default:
+            return -1;
+    }
+}
+
+int32_t
+wcore_caps_cache_get_version(struct wcore_caps_cache *self,
+                             int32_t context_api,
+                             int32_t context_profile)
+{
+    int i = version_index(context_api, context_profile);
+    int32_t version;
+
+    if (!self->path || i < 0)
+        return 0;
+
+    lock();
+    version = self->caps.max_version[i];
+    mtx_unlock(&mutex);
+
+    return version;
+}
+
+void
+wcore_caps_cache_note_version(struct wcore_caps_cache *self,
+                              const struct wcore_config_attrs *attrs)
+{
+    int i = version_index(attrs->context_api, attrs->context_profile);
+    int32_t version = 10 * attrs->context_major_version +
+                      attrs->context_minor_version;
+
+    if (!self->path || i < 0)
+        return;
+
+    lock();
+    if (version > self->caps.max_version[i]) {
+        self->caps.max_version[i] = version;
+        self->dirty = true;
+    }
+    mtx_unlock(&mutex);
+}
+
+bool
+wcore_caps_cache_get_config_id(struct wcore_caps_cache *self,
+                               const struct wcore_config_attrs *attrs,
+                               int32_t *id)
+{
+    uint64_t hash;
+    bool found = false;
+
+    if (!self->path)
+        return false;
+
+    // wcore_config_attrs_parse() zero-fills the attributes, so the padding
+    // hashes equal too.
+    hash = wcore_caps_hash(0, attrs, sizeof(*attrs));
+
+    lock();
+    for (int32_t i = 0; i < self->caps.num_configs; ++i) {
+        if (self->caps.configs[i].attrs_hash == hash) {
+            *id = self->caps.configs[i].id;
+            found = true;
+            break;
+        }
+    }
+    mtx_unlock(&mutex);
+
+    return found;
+}
+
+void
+wcore_caps_cache_put_config_id(struct wcore_caps_cache *self,
+                               const struct wcore_config_attrs *attrs,
+                               int32_t id)
+{
+    struct wcore_caps *caps = &self->caps;
+    uint64_t hash;
+    int32_t i;
+
+    if (!self->path)
+        return;
+
+    hash = wcore_caps_hash(0, attrs, sizeof(*attrs));
+
+    lock();
+    for (i = 0; i < caps->num_configs; ++i) {
+        if (caps->configs[i].attrs_hash == hash)
+            break;
+    }
+
+    if (i == caps->num_configs) {
+        if (caps->num_configs == WCORE_CAPS_MAX_CONFIGS) {
+            memmove(&caps->configs[0], &caps->configs[1],
+                    (WCORE_CAPS_MAX_CONFIGS - 1) * sizeof(caps->configs[0]));
+            i = WCORE_CAPS_MAX_CONFIGS - 1;
+        } else {
+            caps->num_configs++;
+        }
+        caps->configs[i].attrs_hash = hash;
+        caps->configs[i].id = id;
+        self->dirty = true;
+    } else if (caps->configs[i].id != id) {
+        caps->configs[i].id = id;
+        self->dirty = true;
+    }
+    mtx_unlock(&mutex);
+}
@@ -0,0 +1,145 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file
+/// @brief What a driver is known to support, remembered across processes.
+///
+/// A display's record is keyed by an identity of its driver and is loaded
+/// from a memory-mapped file at connect. It is written back at disconnect,
+/// if the display learned something new, by replacing the file whole, so
+/// readers never see a partial write. Concurrent writers may lose each
+/// other's updates, which only costs a later process some probing.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct wcore_config_attrs;
+
+enum {
+    /// One per context API, plus one per desktop OpenGL profile.
+    WCORE_CAPS_NUM_VERSIONS = 6,
+    WCORE_CAPS_MAX_CONFIGS = 32,
+};
+
+/// @brief One driver's record, laid out as it is in the file.
+struct wcore_caps {
+    uint64_t driver_id;
+
+    /// @brief Highest version, as 10 * major + minor, that a context was
+    /// created with. 0 if unknown.
+    int32_t max_version[WCORE_CAPS_NUM_VERSIONS];
+
+    /// @brief Native config IDs chosen for hashed wcore_config_attrs, oldest
+    /// first.
+    int32_t num_configs;
+    struct wcore_caps_config {
+        uint64_t attrs_hash;
+        int32_t id;
+    } configs[WCORE_CAPS_MAX_CONFIGS];
+};
+
+/// @brief A display's record and where it came from.
+///
+/// A zero-filled struct is a valid, disabled cache, on which every function
+/// below does nothing.
+struct wcore_caps_cache {
+    /// Owned by the platform.
+    const char *path;
+    struct wcore_caps caps;
+    bool dirty;
+};
+
+/// @brief Return the file named by $WAFFLE_CAPABILITY_CACHE_FILE, else
+/// waffle/capabilities under $XDG_CACHE_HOME or $HOME/.cache.
+///
+/// Return null, and emit an error, if none of the variables is set.
+char*
+wcore_caps_cache_default_path(void);
+
+/// @brief Mix @a len bytes at @a data into the driver identity @a id.
+uint64_t
+wcore_caps_hash(uint64_t id, const void *data, size_t len);
+
+/// @brief Mix a string, which may be null, into the driver identity @a id.
+uint64_t
+wcore_caps_hash_string(uint64_t id, const char *s);
+
+/// @brief Mix in the file identity of every GL, EGL and DRI library loaded
+/// into the process, so that updating the driver invalidates its record.
+///
+/// On systems that cannot list loaded libraries, @a id is returned as is.
+uint64_t
+wcore_caps_hash_driver_files(uint64_t id);
+
+/// @brief Enable the cache and load the record of @a driver_id from
+/// @a path.
+///
+/// A missing or malformed file is not an error; the record then starts
+/// empty.
+void
+wcore_caps_cache_load(struct wcore_caps_cache *self,
+                      const char *path,
+                      uint64_t driver_id);
+
+/// @brief Write the record back if it changed, and disable the cache.
+///
+/// Failure to write is not an error; the cache is only an optimization.
+void
+wcore_caps_cache_finish(struct wcore_caps_cache *self);
+
+/// @brief Return the highest version, as 10 * major + minor, known to work
+/// for the context API and profile, or 0 if unknown.
+int32_t
+wcore_caps_cache_get_version(struct wcore_caps_cache *self,
+                             int32_t context_api,
+                             int32_t context_profile);
+
+/// @brief Record that a context was created with @a attrs.
+void
+wcore_caps_cache_note_version(struct wcore_caps_cache *self,
+                              const struct wcore_config_attrs *attrs);
+
+/// @brief Find the native config ID chosen for @a attrs.
+bool
+wcore_caps_cache_get_config_id(struct wcore_caps_cache *self,
+                               const struct wcore_config_attrs *attrs,
+                               int32_t *id);
+
+/// @brief Record the native config ID chosen for @a attrs.
+void
+wcore_caps_cache_put_config_id(struct wcore_caps_cache *self,
+                               const struct wcore_config_attrs *attrs,
+                               int32_t id);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,300 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cmocka.h>
+
+#include "waffle.h"
+
+#include "wcore_caps_cache.h"
+#include "wcore_config_attrs.h"
+
+struct test_state {
+    char dir[64];
+    char path[128];
+};
+
+static int
+setup(void **state) {
+    struct test_state *ts = calloc(1, sizeof(*ts));
+
+    if (!ts)
+        return -1;
+
+    strcpy(ts->dir, "/tmp/wcore_caps_cache_unittest.XXXXXX");
+    if (!mkdtemp(ts->dir)) {
+        free(ts);
+        return -1;
+    }
+
+    // A subdirectory that does not exist yet.
+    snprintf(ts->path, sizeof(ts->path), "%s/waffle/capabilities", ts->dir);
+    *state = ts;
+    return 0;
+}
+
+static int
+teardown(void **state) {
+    struct test_state *ts = *state;
+    char dir[96];
+
+    unlink(ts->path);
+    snprintf(dir, sizeof(dir), "%s/waffle", ts->dir);
+    rmdir(dir);
+    rmdir(ts->dir);
+    free(ts);
+    return 0;
+}
+
+static void
+make_attrs(struct wcore_config_attrs *attrs,
+           int32_t context_api, int32_t profile, int32_t major, int32_t minor)
+{
+    memset(attrs, 0, sizeof(*attrs));
+    attrs->context_api = context_api;
+    attrs->context_profile = profile;
+    attrs->context_major_version = major;
+    attrs->context_minor_version = minor;
+}
+
+static void
+test_wcore_caps_cache_disabled(void **state) {
+    struct wcore_caps_cache cache;
+    struct wcore_config_attrs attrs;
+    int32_t id;
+
+    (void) state;
+    memset(&cache, 0, sizeof(cache));
+    make_attrs(&attrs, WAFFLE_CONTEXT_OPENGL_ES2, WAFFLE_NONE, 2, 0);
+
+    wcore_caps_cache_note_version(&cache, &attrs);
+    wcore_caps_cache_put_config_id(&cache, &attrs, 7);
+
+    assert_int_equal(wcore_caps_cache_get_version(&cache,
+                        WAFFLE_CONTEXT_OPENGL_ES2, WAFFLE_NONE), 0);
+    assert_false(wcore_caps_cache_get_config_id(&cache, &attrs, &id));
+    assert_false(cache.dirty);
+    wcore_caps_cache_finish(&cache);
+}
+
+static void
+test_wcore_caps_cache_versions_persist(void **state) {
+    struct test_state *ts = *state;
+    struct wcore_caps_cache cache;
+    struct wcore_config_attrs attrs;
+
+    wcore_caps_cache_load(&cache, ts->path, 42);
+    assert_int_equal(wcore_caps_cache_get_version(&cache,
+                        WAFFLE_CONTEXT_OPENGL,
+                        WAFFLE_CONTEXT_CORE_PROFILE), 0);
+
+    make_attrs(&attrs, WAFFLE_CONTEXT_OPENGL,
+               WAFFLE_CONTEXT_CORE_PROFILE, 4, 4);
+    wcore_caps_cache_note_version(&cache, &attrs);
+
+    // A lower version does not replace a higher one.
+    make_attrs(&attrs, WAFFLE_CONTEXT_OPENGL,
+               WAFFLE_CONTEXT_CORE_PROFILE, 3, 2);
+    wcore_caps_cache_note_version(&cache, &attrs);
+
+    make_attrs(&attrs, WAFFLE_CONTEXT_OPENGL_ES3, WAFFLE_NONE, 3, 1);
+    wcore_caps_cache_note_version(&cache, &attrs);
+    wcore_caps_cache_finish(&cache);
+
+    wcore_caps_cache_load(&cache, ts->path, 42);
+    assert_int_equal(wcore_caps_cache_get_version(&cache,
+                        WAFFLE_CONTEXT_OPENGL,
+                        WAFFLE_CONTEXT_CORE_PROFILE), 44);
+    assert_int_equal(wcore_caps_cache_get_version(&cache,
+                        WAFFLE_CONTEXT_OPENGL,
+                        WAFFLE_CONTEXT_COMPATIBILITY_PROFILE), 0);
+    assert_int_equal(wcore_caps_cache_get_version(&cache,
+                        WAFFLE_CONTEXT_OPENGL_ES3, WAFFLE_NONE), 31);
+    assert_false(cache.dirty);
+    wcore_caps_cache_finish(&cache);
+}
+
+static void
+test_wcore_caps_cache_drivers_are_separate(void **state) {
+    struct test_state *ts = *state;
+    struct wcore_caps_cache cache;
+    struct wcore_config_attrs attrs;
+
+    make_attrs(&attrs, WAFFLE_CONTEXT_OPENGL_ES2, WAFFLE_NONE, 2, 0);
+
+    wcore_caps_cache_load(&cache, ts->path, 1);
+    wcore_caps_cache_note_version(&cache, &attrs);
+    wcore_caps_cache_finish(&cache);
+
+    wcore_caps_cache_load(&cache, ts->path, 2);
+    assert_int_equal(wcore_caps_cache_get_version(&cache,
+                        WAFFLE_CONTEXT_OPENGL_ES2, WAFFLE_NONE), 0);
+    make_attrs(&attrs, WAFFLE_CONTEXT_OPENGL_ES1, WAFFLE_NONE, 1, 1);
+    wcore_caps_cache_note_version(&cache, &attrs);
+    wcore_caps_cache_finish(&cache);
+
+    // Writing the second driver kept the first.
+    wcore_caps_cache_load(&cache, ts->path, 1);
+    assert_int_equal(wcore_caps_cache_get_version(&cache,
+                        WAFFLE_CONTEXT_OPENGL_ES2, WAFFLE_NONE), 20);
+    wcore_caps_cache_finish(&cache);
+
+    wcore_caps_cache_load(&cache, ts->path, 2);
+    assert_int_equal(wcore_caps_cache_get_version(&cache,
+                        WAFFLE_CONTEXT_OPENGL_ES1, WAFFLE_NONE), 11);
+    wcore_caps_cache_finish(&cache);
+}
+
+static void
+test_wcore_caps_cache_config_ids(void **state) {
+    struct test_state *ts = *state;
+    struct wcore_caps_cache cache;
+    struct wcore_config_attrs attrs;
+    int32_t id;
+
+    wcore_caps_cache_load(&cache, ts->path, 42);
+
+    for (int32_t i = 0; i < WCORE_CAPS_MAX_CONFIGS + 1; ++i) {
+        make_attrs(&attrs, WAFFLE_CONTEXT_OPENGL_ES2, WAFFLE_NONE, 2, 0);
+        attrs.samples = i;
+        wcore_caps_cache_put_config_id(&cache, &attrs, 100 + i);
+    }
+
+    wcore_caps_cache_finish(&cache);
+    wcore_caps_cache_load(&cache, ts->path, 42);
+
+    // The oldest was dropped to make room.
+    make_attrs(&attrs, WAFFLE_CONTEXT_OPENGL_ES2, WAFFLE_NONE, 2, 0);
+    assert_false(wcore_caps_cache_get_config_id(&cache, &attrs, &id));
+
+    for (int32_t i = 1; i < WCORE_CAPS_MAX_CONFIGS + 1; ++i) {
+        attrs.samples = i;
+        assert_true(wcore_caps_cache_get_config_id(&cache, &attrs, &id));
+        assert_int_equal(id, 100 + i);
+    }
+
+    // Recording the same ID again changes nothing.
+    wcore_caps_cache_put_config_id(&cache, &attrs, 100 + attrs.samples);
+    assert_false(cache.dirty);
+    wcore_caps_cache_finish(&cache);
+}
+
+static void
+test_wcore_caps_cache_malformed_file(void **state) {
+    struct test_state *ts = *state;
+    struct wcore_caps_cache cache;
+    struct wcore_config_attrs attrs;
+    FILE *f;
+
+    make_attrs(&attrs, WAFFLE_CONTEXT_OPENGL_ES2, WAFFLE_NONE, 2, 0);
+    wcore_caps_cache_load(&cache, ts->path, 42);
+    wcore_caps_cache_note_version(&cache, &attrs);
+    wcore_caps_cache_finish(&cache);
+
+    f = fopen(ts->path, "w");
+    assert_non_null(f);
+    fputs("WAFFCAPS and then some garbage", f);
+    fclose(f);
+
+    wcore_caps_cache_load(&cache, ts->path, 42);
+    assert_int_equal(wcore_caps_cache_get_version(&cache,
+                        WAFFLE_CONTEXT_OPENGL_ES2, WAFFLE_NONE), 0);
+
+    // The next write replaces the garbage.
+    wcore_caps_cache_note_version(&cache, &attrs);
+    wcore_caps_cache_finish(&cache);
+
+    wcore_caps_cache_load(&cache, ts->path, 42);
+    assert_int_equal(wcore_caps_cache_get_version(&cache,
+                        WAFFLE_CONTEXT_OPENGL_ES2, WAFFLE_NONE), 20);
+    wcore_caps_cache_finish(&cache);
+}
+
+static void
+test_wcore_caps_cache_default_path(void **state) {
+    char *path;
+
+    (void) state;
+
+    setenv("WAFFLE_CAPABILITY_CACHE_FILE", "/a/b", 1);
+    setenv("XDG_CACHE_HOME", "/xdg", 1);
+    setenv("HOME", "/home/u", 1);
+    path = wcore_caps_cache_default_path();
+    assert_string_equal(path, "/a/b");
+    free(path);
+
+    unsetenv("WAFFLE_CAPABILITY_CACHE_FILE");
+    path = wcore_caps_cache_default_path();
+    assert_string_equal(path, "/xdg/waffle/capabilities");
+    free(path);
+
+    unsetenv("XDG_CACHE_HOME");
+    path = wcore_caps_cache_default_path();
+    assert_string_equal(path, "/home/u/.cache/waffle/capabilities");
+    free(path);
+
+    unsetenv("HOME");
+    assert_null(wcore_caps_cache_default_path());
+}
+
+static void
+test_wcore_caps_cache_hash(void **state) {
+    (void) state;
+
+    assert_int_not_equal(wcore_caps_hash_string(0, NULL),
+                         wcore_caps_hash_string(0, ""));
+    assert_int_not_equal(wcore_caps_hash_string(0, "Mesa"),
+                         wcore_caps_hash_string(0, "NVIDIA"));
+    assert_int_equal(wcore_caps_hash_string(7, "Mesa"),
+                     wcore_caps_hash_string(7, "Mesa"));
+    assert_int_equal(wcore_caps_hash_driver_files(7),
+                     wcore_caps_hash_driver_files(7));
+}
+
+int
+main(void) {
+    const struct CMUnitTest tests[] = {
+        #define unit_test_make(name) cmocka_unit_test_setup_teardown(name, setup, teardown)
+
+        unit_test_make(test_wcore_caps_cache_disabled),
+        unit_test_make(test_wcore_caps_cache_versions_persist),
+        unit_test_make(test_wcore_caps_cache_drivers_are_separate),
+        unit_test_make(test_wcore_caps_cache_config_ids),
+        unit_test_make(test_wcore_caps_cache_malformed_file),
+        unit_test_make(test_wcore_caps_cache_default_path),
+        unit_test_make(test_wcore_caps_cache_hash),
+
+        #undef unit_test_make
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -47,6 +47,9 @@ struct wcore_config {
     struct api_object api;
     struct wcore_config_attrs attrs;
     struct wcore_display *display;
+
+    /// Guarded by the lock in wcore_config_cache.c.
+    int32_t refcount;
 };
 
 static inline struct waffle_config*
@@ -69,6 +72,7 @@ wcore_config_init(struct wcore_config *self,
 
     self->api.display_id = display->api.display_id;
     self->display = display;
+    self->refcount = 1;
     memcpy(&self->attrs, attrs, sizeof(*attrs));
 
     return true;
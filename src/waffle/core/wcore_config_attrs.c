@@ -36,6 +36,8 @@ enum {
     DEFAULT_ACCUM_BUFFER = false,
     DEFAULT_DOUBLE_BUFFERED = true,
     DEFAULT_SAMPLE_BUFFERS = false,
+    DEFAULT_NO_CONFIG = false,
+    DEFAULT_SAMPLES_FALLBACK = false,
 };
 
 static bool
@@ -55,6 +57,9 @@ check_keys(const int32_t attrib_list[])
             case WAFFLE_CONTEXT_FORWARD_COMPATIBLE:
             case WAFFLE_CONTEXT_DEBUG:
             case WAFFLE_CONTEXT_ROBUST_ACCESS:
+            case WAFFLE_CONTEXT_NO_ERROR:
+            case WAFFLE_CONTEXT_RELEASE_BEHAVIOR:
+            case WAFFLE_CONTEXT_PRIORITY:
             case WAFFLE_RED_SIZE:
             case WAFFLE_GREEN_SIZE:
             case WAFFLE_BLUE_SIZE:
@@ -65,6 +70,9 @@ check_keys(const int32_t attrib_list[])
             case WAFFLE_SAMPLE_BUFFERS:
             case WAFFLE_DOUBLE_BUFFERED:
             case WAFFLE_ACCUM_BUFFER:
+            case WAFFLE_NO_CONFIG:
+            case WAFFLE_CONFIG_RANKING:
+            case WAFFLE_SAMPLES_FALLBACK:
                 break;
             default:
                 wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
@@ -282,6 +290,95 @@ parse_context_forward_compatible(struct wcore_config_attrs *attrs,
     return true;
 }
 
+static bool
+parse_context_release_behavior(struct wcore_config_attrs *attrs,
+                               const int32_t attrib_list[])
+{
+    int32_t value = WAFFLE_DONT_CARE;
+
+    wcore_attrib_list32_get(attrib_list, WAFFLE_CONTEXT_RELEASE_BEHAVIOR,
+                            &value);
+
+    switch (value) {
+        case WAFFLE_DONT_CARE:
+        case WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH:
+            // Flushing on release is what every native platform does when
+            // the application does not ask otherwise.
+            attrs->context_release_behavior = WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH;
+            break;
+        case WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE:
+            attrs->context_release_behavior = value;
+            break;
+        default:
+            wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                         "WAFFLE_CONTEXT_RELEASE_BEHAVIOR has bad value 0x%x. "
+                         "Must be WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH, "
+                         "WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE, or "
+                         "WAFFLE_DONT_CARE", value);
+            return false;
+    }
+
+    return true;
+}
+
+static bool
+parse_context_priority(struct wcore_config_attrs *attrs,
+                       const int32_t attrib_list[])
+{
+    int32_t value = WAFFLE_DONT_CARE;
+
+    wcore_attrib_list32_get(attrib_list, WAFFLE_CONTEXT_PRIORITY, &value);
+
+    switch (value) {
+        case WAFFLE_DONT_CARE:
+            attrs->context_priority = WAFFLE_CONTEXT_PRIORITY_MEDIUM;
+            break;
+        case WAFFLE_CONTEXT_PRIORITY_LOW:
+        case WAFFLE_CONTEXT_PRIORITY_MEDIUM:
+        case WAFFLE_CONTEXT_PRIORITY_HIGH:
+            attrs->context_priority = value;
+            break;
+        default:
+            wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                         "WAFFLE_CONTEXT_PRIORITY has bad value 0x%x. "
+                         "Must be WAFFLE_CONTEXT_PRIORITY_LOW, "
+                         "WAFFLE_CONTEXT_PRIORITY_MEDIUM, "
+                         "WAFFLE_CONTEXT_PRIORITY_HIGH, or "
+                         "WAFFLE_DONT_CARE", value);
+            return false;
+    }
+
+    return true;
+}
+
+static bool
+parse_config_ranking(struct wcore_config_attrs *attrs,
+                     const int32_t attrib_list[])
+{
+    int32_t value = WAFFLE_DONT_CARE;
+
+    wcore_attrib_list32_get(attrib_list, WAFFLE_CONFIG_RANKING, &value);
+
+    switch (value) {
+        case WAFFLE_DONT_CARE:
+            attrs->config_ranking = WAFFLE_CONFIG_PREFER_NATIVE_ORDER;
+            break;
+        case WAFFLE_CONFIG_PREFER_NATIVE_ORDER:
+        case WAFFLE_CONFIG_PREFER_SMALLEST:
+            attrs->config_ranking = value;
+            break;
+        default:
+            wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                         "WAFFLE_CONFIG_RANKING has bad value 0x%x. "
+                         "Must be WAFFLE_CONFIG_PREFER_NATIVE_ORDER, "
+                         "WAFFLE_CONFIG_PREFER_SMALLEST, or "
+                         "WAFFLE_DONT_CARE", value);
+            return false;
+    }
+
+    return true;
+}
+
 static bool
 set_misc_defaults(struct wcore_config_attrs *attrs)
 {
@@ -293,6 +390,7 @@ set_misc_defaults(struct wcore_config_attrs *attrs)
 
     attrs->context_debug        = false;
     attrs->context_robust       = false;
+    attrs->context_no_error     = false;
 
     attrs->rgba_size            = 0;
     attrs->red_size             = 0;
@@ -305,6 +403,8 @@ set_misc_defaults(struct wcore_config_attrs *attrs)
     attrs->samples              = 0;
     attrs->double_buffered      = true;
     attrs->accum_buffer         = false;
+    attrs->no_config            = false;
+    attrs->samples_fallback     = false;
 
     return true;
 }
@@ -356,6 +456,9 @@ parse_misc(struct wcore_config_attrs *attrs,
             case WAFFLE_CONTEXT_MINOR_VERSION:
             case WAFFLE_CONTEXT_PROFILE:
             case WAFFLE_CONTEXT_FORWARD_COMPATIBLE:
+            case WAFFLE_CONTEXT_RELEASE_BEHAVIOR:
+            case WAFFLE_CONTEXT_PRIORITY:
+            case WAFFLE_CONFIG_RANKING:
                 // These keys have already been parsed.
                 break;
 
@@ -369,9 +472,12 @@ parse_misc(struct wcore_config_attrs *attrs,
 
             CASE_BOOL(WAFFLE_CONTEXT_DEBUG, context_debug, false);
             CASE_BOOL(WAFFLE_CONTEXT_ROBUST_ACCESS, context_robust, false);
+            CASE_BOOL(WAFFLE_CONTEXT_NO_ERROR, context_no_error, false);
             CASE_BOOL(WAFFLE_SAMPLE_BUFFERS, sample_buffers, DEFAULT_SAMPLE_BUFFERS);
             CASE_BOOL(WAFFLE_DOUBLE_BUFFERED, double_buffered, DEFAULT_DOUBLE_BUFFERED);
             CASE_BOOL(WAFFLE_ACCUM_BUFFER, accum_buffer, DEFAULT_ACCUM_BUFFER);
+            CASE_BOOL(WAFFLE_NO_CONFIG, no_config, DEFAULT_NO_CONFIG);
+            CASE_BOOL(WAFFLE_SAMPLES_FALLBACK, samples_fallback, DEFAULT_SAMPLES_FALLBACK);
 
             default:
                 wcore_error_internal("%s", "bad attribute key should have "
@@ -414,6 +520,52 @@ check_final(struct wcore_config_attrs *attrs)
         return false;
     }
 
+    // KHR_no_error and GLX_ARB_create_context_no_error both make context
+    // creation fail if a no-error context is also a debug or robust access
+    // context, so reject the combination here on every platform.
+    if (attrs->context_no_error && attrs->context_debug) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "%s", "WAFFLE_CONTEXT_NO_ERROR and WAFFLE_CONTEXT_DEBUG "
+                     "are mutually exclusive");
+        return false;
+    }
+
+    if (attrs->context_no_error && attrs->context_robust) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "%s", "WAFFLE_CONTEXT_NO_ERROR and "
+                     "WAFFLE_CONTEXT_ROBUST_ACCESS are mutually exclusive");
+        return false;
+    }
+
+    // A config-less config selects no framebuffer, so it cannot honor any
+    // framebuffer attribute.
+    if (attrs->no_config &&
+        (attrs->rgba_size > 0 || attrs->depth_size > 0 ||
+         attrs->stencil_size > 0 || attrs->samples > 0 ||
+         attrs->sample_buffers || attrs->accum_buffer ||
+         !attrs->double_buffered)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "%s", "WAFFLE_NO_CONFIG cannot be combined with "
+                     "framebuffer attributes");
+        return false;
+    }
+
+    if (attrs->no_config &&
+        (attrs->samples_fallback ||
+         attrs->config_ranking != WAFFLE_CONFIG_PREFER_NATIVE_ORDER)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "%s", "WAFFLE_NO_CONFIG leaves no configs to rank");
+        return false;
+    }
+
+    // GL_KHR_no_error is written against OpenGL 2.0 and OpenGL ES 2.0.
+    if (attrs->context_no_error && wcore_config_attrs_version_lt(attrs, 20)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "%s", "WAFFLE_CONTEXT_NO_ERROR requires a context "
+                     "version of 2.0 or greater");
+        return false;
+    }
+
     return true;
 }
 
@@ -445,6 +597,15 @@ wcore_config_attrs_parse(
     if (!parse_context_forward_compatible(attrs, waffle_attrib_list))
         return false;
 
+    if (!parse_context_release_behavior(attrs, waffle_attrib_list))
+        return false;
+
+    if (!parse_context_priority(attrs, waffle_attrib_list))
+        return false;
+
+    if (!parse_config_ranking(attrs, waffle_attrib_list))
+        return false;
+
     if (!set_misc_defaults(attrs))
         return false;
 
@@ -38,6 +38,14 @@ struct wcore_config_attrs {
     int32_t context_major_version;
     int32_t context_minor_version;
     int32_t context_profile;
+    int32_t context_release_behavior;
+
+    /// A hint. Platforms that cannot honor it create the context anyway;
+    /// waffle_context_query() reports the priority actually granted.
+    int32_t context_priority;
+
+    /// WAFFLE_CONFIG_PREFER_NATIVE_ORDER or WAFFLE_CONFIG_PREFER_SMALLEST.
+    int32_t config_ranking;
 
     int32_t rgb_size;
     int32_t rgba_size;
@@ -55,9 +63,19 @@ struct wcore_config_attrs {
     bool context_forward_compatible;
     bool context_debug;
     bool context_robust;
+    bool context_no_error;
     bool double_buffered;
     bool sample_buffers;
     bool accum_buffer;
+
+    /// The config carries only the context attributes and selects no
+    /// framebuffer format, so its contexts may be bound to any compatible
+    /// window.
+    bool no_config;
+
+    /// If no config has `samples` samples, accept the largest halving of it
+    /// that some config has, down to single-sampled.
+    bool samples_fallback;
 };
 
 bool
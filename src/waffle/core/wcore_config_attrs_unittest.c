@@ -49,6 +49,9 @@ setup(void **state) {
         .context_major_version  = 1,
         .context_minor_version  = 0,
         .context_profile        = WAFFLE_NONE,
+        .context_release_behavior = WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH,
+        .context_priority       = WAFFLE_CONTEXT_PRIORITY_MEDIUM,
+        .config_ranking         = WAFFLE_CONFIG_PREFER_NATIVE_ORDER,
         .context_debug          = false,
         .context_forward_compatible = false,
 
@@ -1089,6 +1092,314 @@ test_wcore_config_attrs_debug_gles3(void **state) {
     assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
 }
 
+static void
+test_wcore_config_attrs_no_error_gl20(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_MAJOR_VERSION,           2,
+        WAFFLE_CONTEXT_MINOR_VERSION,           0,
+        WAFFLE_CONTEXT_NO_ERROR,                true,
+        0,
+    };
+
+    ts->expect_attrs.context_api = WAFFLE_CONTEXT_OPENGL;
+    ts->expect_attrs.context_major_version = 2;
+    ts->expect_attrs.context_no_error = true;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_no_error_gles2(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL_ES2,
+        WAFFLE_CONTEXT_NO_ERROR,                true,
+        0,
+    };
+
+    ts->expect_attrs.context_api = WAFFLE_CONTEXT_OPENGL_ES2;
+    ts->expect_attrs.context_major_version = 2;
+    ts->expect_attrs.context_no_error = true;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_no_error_gl_emits_bad_attribute(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_NO_ERROR,                true,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+static void
+test_wcore_config_attrs_no_error_gles1_emits_bad_attribute(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL_ES1,
+        WAFFLE_CONTEXT_NO_ERROR,                true,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+static void
+test_wcore_config_attrs_no_error_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_NO_ERROR,                0x31415926,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_CONTEXT_NO_ERROR"));
+    assert_true(strstr(wcore_error_get_info()->message, "0x31415926"));
+}
+
+static void
+test_wcore_config_attrs_no_error_and_debug(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_MAJOR_VERSION,           3,
+        WAFFLE_CONTEXT_MINOR_VERSION,           0,
+        WAFFLE_CONTEXT_NO_ERROR,                true,
+        WAFFLE_CONTEXT_DEBUG,                   true,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_CONTEXT_DEBUG"));
+}
+
+static void
+test_wcore_config_attrs_no_error_and_robust(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL_ES2,
+        WAFFLE_CONTEXT_ROBUST_ACCESS,           true,
+        WAFFLE_CONTEXT_NO_ERROR,                true,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_CONTEXT_ROBUST_ACCESS"));
+}
+
+static void
+test_wcore_config_attrs_release_behavior_none(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_RELEASE_BEHAVIOR,        WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE,
+        0,
+    };
+
+    ts->expect_attrs.context_api = WAFFLE_CONTEXT_OPENGL;
+    ts->expect_attrs.context_release_behavior = WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_release_behavior_dont_care(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_RELEASE_BEHAVIOR,        WAFFLE_DONT_CARE,
+        0,
+    };
+
+    ts->expect_attrs.context_api = WAFFLE_CONTEXT_OPENGL;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_release_behavior_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_RELEASE_BEHAVIOR,        0x31415926,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_CONTEXT_RELEASE_BEHAVIOR"));
+    assert_true(strstr(wcore_error_get_info()->message, "0x31415926"));
+}
+
+static void
+test_wcore_config_attrs_priority_high(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL_ES2,
+        WAFFLE_CONTEXT_PRIORITY,                WAFFLE_CONTEXT_PRIORITY_HIGH,
+        0,
+    };
+
+    ts->expect_attrs.context_api = WAFFLE_CONTEXT_OPENGL_ES2;
+    ts->expect_attrs.context_major_version = 2;
+    ts->expect_attrs.context_priority = WAFFLE_CONTEXT_PRIORITY_HIGH;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_priority_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_PRIORITY,                0x31415926,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_CONTEXT_PRIORITY"));
+    assert_true(strstr(wcore_error_get_info()->message, "0x31415926"));
+}
+
+static void
+test_wcore_config_attrs_no_config(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL_ES2,
+        WAFFLE_NO_CONFIG,                       true,
+        WAFFLE_RED_SIZE,                        WAFFLE_DONT_CARE,
+        0,
+    };
+
+    ts->expect_attrs.context_api = WAFFLE_CONTEXT_OPENGL_ES2;
+    ts->expect_attrs.context_major_version = 2;
+    ts->expect_attrs.red_size = WAFFLE_DONT_CARE;
+    ts->expect_attrs.no_config = true;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_no_config_and_depth(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_NO_CONFIG,                       true,
+        WAFFLE_DEPTH_SIZE,                      24,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_NO_CONFIG"));
+}
+
+static void
+test_wcore_config_attrs_no_config_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_NO_CONFIG,                       0x31415926,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_NO_CONFIG"));
+}
+
+static void
+test_wcore_config_attrs_prefer_smallest(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONFIG_RANKING,                  WAFFLE_CONFIG_PREFER_SMALLEST,
+        WAFFLE_SAMPLES,                         8,
+        WAFFLE_SAMPLES_FALLBACK,                true,
+        0,
+    };
+
+    ts->expect_attrs.config_ranking = WAFFLE_CONFIG_PREFER_SMALLEST;
+    ts->expect_attrs.samples = 8;
+    ts->expect_attrs.samples_fallback = true;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_config_ranking_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONFIG_RANKING,                  0x31415926,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_CONFIG_RANKING"));
+    assert_true(strstr(wcore_error_get_info()->message, "0x31415926"));
+}
+
+static void
+test_wcore_config_attrs_no_config_and_ranking(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_NO_CONFIG,                       true,
+        WAFFLE_CONFIG_RANKING,                  WAFFLE_CONFIG_PREFER_SMALLEST,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
 int
 main(void) {
     const struct CMUnitTest tests[] = {
@@ -1151,6 +1462,24 @@ main(void) {
         unit_test_make(test_wcore_config_attrs_debug_gles1),
         unit_test_make(test_wcore_config_attrs_debug_gles2),
         unit_test_make(test_wcore_config_attrs_debug_gles3),
+        unit_test_make(test_wcore_config_attrs_no_error_gl20),
+        unit_test_make(test_wcore_config_attrs_no_error_gles2),
+        unit_test_make(test_wcore_config_attrs_no_error_gl_emits_bad_attribute),
+        unit_test_make(test_wcore_config_attrs_no_error_gles1_emits_bad_attribute),
+        unit_test_make(test_wcore_config_attrs_no_error_is_bad),
+        unit_test_make(test_wcore_config_attrs_no_error_and_debug),
+        unit_test_make(test_wcore_config_attrs_no_error_and_robust),
+        unit_test_make(test_wcore_config_attrs_release_behavior_none),
+        unit_test_make(test_wcore_config_attrs_release_behavior_dont_care),
+        unit_test_make(test_wcore_config_attrs_release_behavior_is_bad),
+        unit_test_make(test_wcore_config_attrs_priority_high),
+        unit_test_make(test_wcore_config_attrs_priority_is_bad),
+        unit_test_make(test_wcore_config_attrs_no_config),
+        unit_test_make(test_wcore_config_attrs_no_config_and_depth),
+        unit_test_make(test_wcore_config_attrs_no_config_is_bad),
+        unit_test_make(test_wcore_config_attrs_prefer_smallest),
+        unit_test_make(test_wcore_config_attrs_config_ranking_is_bad),
+        unit_test_make(test_wcore_config_attrs_no_config_and_ranking),
 
         #undef unit_test_make
     };
@@ -0,0 +1,152 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "threads.h"
+
+#include "wcore_config.h"
+#include "wcore_config_cache.h"
+
+// Guards every cache and every config's refcount. A config may outlive its
+// display, so the lock cannot belong to the display.
+static mtx_t mutex;
+
+static void
+wcore_config_cache_init_once(void)
+{
+    mtx_init(&mutex, mtx_plain);
+}
+
+static void
+lock(void)
+{
+    static once_flag flag = ONCE_FLAG_INIT;
+
+    call_once(&flag, wcore_config_cache_init_once);
+    mtx_lock(&mutex);
+}
+
+// wcore_config_attrs_parse() zero-fills the attributes and
+// wcore_config_init() copies them whole, so the padding compares equal too.
+static struct wcore_config*
+find(const struct wcore_config_cache *self,
+     const struct wcore_config_attrs *attrs)
+{
+    for (size_t i = 0; i < self->count; ++i) {
+        if (memcmp(&self->configs[i]->attrs, attrs, sizeof(*attrs)) == 0)
+            return self->configs[i];
+    }
+
+    return NULL;
+}
+
+struct wcore_config*
+wcore_config_cache_lookup(struct wcore_config_cache *self,
+                          const struct wcore_config_attrs *attrs)
+{
+    struct wcore_config *config;
+
+    lock();
+    config = find(self, attrs);
+    if (config)
+        config->refcount++;
+    mtx_unlock(&mutex);
+
+    return config;
+}
+
+struct wcore_config*
+wcore_config_cache_insert(struct wcore_config_cache *self,
+                          struct wcore_config *config)
+{
+    struct wcore_config *found;
+
+    lock();
+
+    found = find(self, &config->attrs);
+    if (found) {
+        found->refcount++;
+        mtx_unlock(&mutex);
+        return found;
+    }
+
+    if (self->count == self->capacity) {
+        size_t capacity = self->capacity ? 2 * self->capacity : 8;
+        struct wcore_config **configs =
+            realloc(self->configs, capacity * sizeof(*configs));
+
+        if (!configs) {
+            mtx_unlock(&mutex);
+            return config;
+        }
+
+        self->configs = configs;
+        self->capacity = capacity;
+    }
+
+    config->refcount++;
+    self->configs[self->count++] = config;
+
+    mtx_unlock(&mutex);
+    return config;
+}
+
+bool
+wcore_config_cache_finish(struct wcore_config_cache *self,
+                          bool (*destroy)(struct wcore_config *config))
+{
+    bool ok = true;
+
+    for (size_t i = 0; i < self->count; ++i) {
+        if (wcore_config_unref(self->configs[i]))
+            ok &= destroy(self->configs[i]);
+    }
+
+    free(self->configs);
+    memset(self, 0, sizeof(*self));
+    return ok;
+}
+
+void
+wcore_config_ref(struct wcore_config *config)
+{
+    lock();
+    config->refcount++;
+    mtx_unlock(&mutex);
+}
+
+bool
+wcore_config_unref(struct wcore_config *config)
+{
+    bool last;
+
+    lock();
+    last = --config->refcount == 0;
+    mtx_unlock(&mutex);
+
+    return last;
+}
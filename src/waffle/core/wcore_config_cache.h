@@ -0,0 +1,88 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct wcore_config;
+struct wcore_config_attrs;
+
+/// @brief The configs chosen on one display, keyed by their attributes.
+///
+/// waffle_config_choose() hands out another reference to a cached config
+/// instead of asking the platform again. The cache holds a reference of its
+/// own, so a config stays cached after its last user destroys it, until
+/// the display is disconnected.
+///
+/// Thread-safe. A zero-filled struct is a valid, empty cache.
+struct wcore_config_cache {
+    /// Displays see few distinct requests, so a linear scan suffices.
+    struct wcore_config **configs;
+    size_t count;
+    size_t capacity;
+};
+
+/// @brief Return a new reference to the config chosen with @a attrs, or
+/// null if there is none.
+struct wcore_config*
+wcore_config_cache_lookup(struct wcore_config_cache *self,
+                          const struct wcore_config_attrs *attrs);
+
+/// @brief Cache a config that was just chosen.
+///
+/// If another thread cached a config with the same attributes first,
+/// return a new reference to that one instead, and the caller must release
+/// @a config. Failure to grow the cache is not an error; @a config is then
+/// simply not cached.
+struct wcore_config*
+wcore_config_cache_insert(struct wcore_config_cache *self,
+                          struct wcore_config *config);
+
+/// @brief Drop all cached references, destroying the configs that no
+/// caller still holds.
+bool
+wcore_config_cache_finish(struct wcore_config_cache *self,
+                          bool (*destroy)(struct wcore_config *config));
+
+/// @brief Take a reference to @a config.
+void
+wcore_config_ref(struct wcore_config *config);
+
+/// @brief Drop a reference to @a config.
+///
+/// @return true if it was the last, in which case the caller must destroy
+/// the config.
+bool
+wcore_config_unref(struct wcore_config *config);
+
+#ifdef __cplusplus
+}
+#endif
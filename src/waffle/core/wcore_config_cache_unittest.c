@@ -0,0 +1,201 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "waffle.h"
+
+#include "wcore_config.h"
+#include "wcore_config_attrs.h"
+#include "wcore_config_cache.h"
+#include "wcore_display.h"
+
+static int num_destroyed;
+
+static bool
+destroy(struct wcore_config *config)
+{
+    ++num_destroyed;
+    free(config);
+    return true;
+}
+
+static struct wcore_config*
+create(struct wcore_display *dpy, int32_t red_size)
+{
+    struct wcore_config_attrs attrs;
+    struct wcore_config *config = calloc(1, sizeof(*config));
+
+    memset(&attrs, 0, sizeof(attrs));
+    attrs.context_api = WAFFLE_CONTEXT_OPENGL_ES2;
+    attrs.red_size = red_size;
+
+    assert_non_null(config);
+    assert_true(wcore_config_init(config, dpy, &attrs));
+    return config;
+}
+
+static int
+setup(void **state) {
+    num_destroyed = 0;
+    *state = calloc(1, sizeof(struct wcore_display));
+    return *state ? 0 : -1;
+}
+
+static int
+teardown(void **state) {
+    free(*state);
+    return 0;
+}
+
+static void
+test_wcore_config_cache_empty(void **state) {
+    struct wcore_display *dpy = *state;
+    struct wcore_config *config = create(dpy, 8);
+
+    assert_null(wcore_config_cache_lookup(&dpy->config_cache, &config->attrs));
+    assert_true(wcore_config_cache_finish(&dpy->config_cache, destroy));
+    assert_int_equal(num_destroyed, 0);
+
+    assert_true(wcore_config_unref(config));
+    destroy(config);
+}
+
+static void
+test_wcore_config_cache_hit(void **state) {
+    struct wcore_display *dpy = *state;
+    struct wcore_config *a = create(dpy, 8);
+    struct wcore_config *b = create(dpy, 8);
+
+    assert_ptr_equal(wcore_config_cache_insert(&dpy->config_cache, a), a);
+    assert_int_equal(a->refcount, 2);
+
+    // Same attributes, different object.
+    assert_ptr_equal(wcore_config_cache_lookup(&dpy->config_cache, &b->attrs), a);
+    assert_int_equal(a->refcount, 3);
+
+    // The caller loses the race and must release its own config.
+    assert_ptr_equal(wcore_config_cache_insert(&dpy->config_cache, b), a);
+    assert_int_equal(a->refcount, 4);
+    assert_int_equal(b->refcount, 1);
+    assert_true(wcore_config_unref(b));
+    destroy(b);
+
+    assert_false(wcore_config_unref(a));
+    assert_false(wcore_config_unref(a));
+    assert_false(wcore_config_unref(a));
+
+    // Still cached after its users are done with it.
+    assert_int_equal(num_destroyed, 1);
+    assert_true(wcore_config_cache_finish(&dpy->config_cache, destroy));
+    assert_int_equal(num_destroyed, 2);
+}
+
+static void
+test_wcore_config_cache_miss(void **state) {
+    struct wcore_display *dpy = *state;
+    struct wcore_config *a = create(dpy, 8);
+    struct wcore_config *b = create(dpy, 5);
+
+    wcore_config_cache_insert(&dpy->config_cache, a);
+    assert_null(wcore_config_cache_lookup(&dpy->config_cache, &b->attrs));
+    assert_ptr_equal(wcore_config_cache_insert(&dpy->config_cache, b), b);
+    assert_ptr_equal(wcore_config_cache_lookup(&dpy->config_cache, &b->attrs), b);
+
+    assert_false(wcore_config_unref(a));
+    assert_false(wcore_config_unref(b));
+    assert_false(wcore_config_unref(b));
+    assert_true(wcore_config_cache_finish(&dpy->config_cache, destroy));
+    assert_int_equal(num_destroyed, 2);
+}
+
+static void
+test_wcore_config_cache_outlives_display(void **state) {
+    struct wcore_display *dpy = *state;
+    struct wcore_config *a = create(dpy, 8);
+
+    wcore_config_cache_insert(&dpy->config_cache, a);
+
+    // A caller still holds the config at disconnect.
+    assert_true(wcore_config_cache_finish(&dpy->config_cache, destroy));
+    assert_int_equal(num_destroyed, 0);
+    assert_int_equal(dpy->config_cache.count, 0);
+
+    assert_true(wcore_config_unref(a));
+    destroy(a);
+}
+
+static void
+test_wcore_config_cache_many(void **state) {
+    struct wcore_display *dpy = *state;
+
+    for (int32_t i = 0; i < 100; ++i) {
+        struct wcore_config *config = create(dpy, i);
+
+        assert_ptr_equal(wcore_config_cache_insert(&dpy->config_cache, config),
+                         config);
+        assert_false(wcore_config_unref(config));
+    }
+
+    for (int32_t i = 0; i < 100; ++i) {
+        struct wcore_config_attrs attrs;
+        struct wcore_config *config;
+
+        memset(&attrs, 0, sizeof(attrs));
+        attrs.context_api = WAFFLE_CONTEXT_OPENGL_ES2;
+        attrs.red_size = i;
+
+        config = wcore_config_cache_lookup(&dpy->config_cache, &attrs);
+        assert_non_null(config);
+        assert_int_equal(config->attrs.red_size, i);
+        assert_false(wcore_config_unref(config));
+    }
+
+    assert_true(wcore_config_cache_finish(&dpy->config_cache, destroy));
+    assert_int_equal(num_destroyed, 100);
+}
+
+int
+main(void) {
+    const struct CMUnitTest tests[] = {
+        #define unit_test_make(name) cmocka_unit_test_setup_teardown(name, setup, teardown)
+
+        unit_test_make(test_wcore_config_cache_empty),
+        unit_test_make(test_wcore_config_cache_hit),
+        unit_test_make(test_wcore_config_cache_miss),
+        unit_test_make(test_wcore_config_cache_outlives_display),
+        unit_test_make(test_wcore_config_cache_many),
+
+        #undef unit_test_make
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,125 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "waffle.h"
+
+#include "wcore_config_attrs.h"
+#include "wcore_config_rank.h"
+
+void
+wcore_config_rank_query_attrs(const struct wcore_config_attrs *attrs,
+                              struct wcore_config_attrs *query_attrs)
+{
+    *query_attrs = *attrs;
+
+    if (attrs->samples_fallback) {
+        query_attrs->sample_buffers = false;
+        query_attrs->samples = 0;
+    }
+}
+
+bool
+wcore_config_rank_needed(const struct wcore_config_attrs *attrs)
+{
+    return attrs->samples_fallback ||
+           attrs->config_ranking != WAFFLE_CONFIG_PREFER_NATIVE_ORDER;
+}
+
+/// The bits that one pixel costs in memory and bandwidth.
+static int64_t
+candidate_cost(const struct wcore_config_candidate *c)
+{
+    int64_t bits = (int64_t) c->rgba_size + c->depth_size + c->stencil_size;
+    return c->samples > 1 ? bits * c->samples : bits;
+}
+
+/// Keep the candidates with at least @a min_samples samples, in order.
+static int32_t
+filter_samples(struct wcore_config_candidate *candidates,
+               int32_t num_candidates,
+               int32_t min_samples)
+{
+    int32_t n = 0;
+
+    for (int32_t i = 0; i < num_candidates; ++i) {
+        if (candidates[i].samples >= min_samples)
+            candidates[n++] = candidates[i];
+    }
+
+    return n;
+}
+
+static bool
+has_samples(const struct wcore_config_candidate *candidates,
+            int32_t num_candidates,
+            int32_t min_samples)
+{
+    for (int32_t i = 0; i < num_candidates; ++i) {
+        if (candidates[i].samples >= min_samples)
+            return true;
+    }
+
+    return false;
+}
+
+int32_t
+wcore_config_rank(const struct wcore_config_attrs *attrs,
+                  struct wcore_config_candidate *candidates,
+                  int32_t num_candidates)
+{
+    int32_t n = num_candidates;
+
+    // Step down 8, 4, 2, 0. A single sample is not multisampling, so the
+    // step after 2 is 0, which keeps every config.
+    if (attrs->samples_fallback && attrs->samples > 0) {
+        int32_t min_samples = attrs->samples;
+
+        while (min_samples > 0 && !has_samples(candidates, n, min_samples)) {
+            min_samples /= 2;
+            if (min_samples < 2)
+                min_samples = 0;
+        }
+
+        n = filter_samples(candidates, n, min_samples);
+    }
+
+    // Insertion sort, because it is stable and the lists are short.
+    if (attrs->config_ranking == WAFFLE_CONFIG_PREFER_SMALLEST) {
+        for (int32_t i = 1; i < n; ++i) {
+            struct wcore_config_candidate c = candidates[i];
+            int64_t cost = candidate_cost(&c);
+            int32_t j = i;
+
+            while (j > 0 && candidate_cost(&candidates[j - 1]) > cost) {
+                candidates[j] = candidates[j - 1];
+                --j;
+            }
+
+            candidates[j] = c;
+        }
+    }
+
+    return n;
+}
@@ -0,0 +1,79 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct wcore_config_attrs;
+
+/// @brief The framebuffer sizes of one native config, as needed to rank it.
+struct wcore_config_candidate {
+    /// The platform's handle for the config, such as an EGLConfig.
+    void *native;
+
+    int32_t rgba_size;
+    int32_t depth_size;
+    int32_t stencil_size;
+    int32_t samples;
+};
+
+/// @brief Return the attributes with which to query the native configs.
+///
+/// With WAFFLE_SAMPLES_FALLBACK the multisample attributes are relaxed to 0,
+/// so that one native query returns every config that some step of the
+/// fallback could pick. wcore_config_rank() then applies the fallback.
+void
+wcore_config_rank_query_attrs(const struct wcore_config_attrs *attrs,
+                              struct wcore_config_attrs *query_attrs);
+
+/// @brief Return true if wcore_config_rank() may reorder or drop configs.
+///
+/// If false, the native order is final and the platform may ask the native
+/// API for only the first config.
+bool
+wcore_config_rank_needed(const struct wcore_config_attrs *attrs);
+
+/// @brief Filter and sort the configs returned by the native query.
+///
+/// @a candidates must be in the native order. Configs that a step of the
+/// MSAA fallback rules out are dropped, and, for
+/// WAFFLE_CONFIG_PREFER_SMALLEST, the rest are stably sorted by their
+/// per-pixel size.
+///
+/// @return the number of configs kept at the front of @a candidates.
+int32_t
+wcore_config_rank(const struct wcore_config_attrs *attrs,
+                  struct wcore_config_candidate *candidates,
+                  int32_t num_candidates);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,214 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "waffle.h"
+
+#include "wcore_config_attrs.h"
+#include "wcore_config_rank.h"
+
+#define ID(i) ((void *) (intptr_t) (i))
+
+// In the order the EGL and GLX specs sort them: deepest color first, then
+// smallest depth, then fewest samples.
+static const struct wcore_config_candidate native_order[] = {
+    { ID(0), 32, 24, 8, 0 },
+    { ID(1), 32, 24, 8, 4 },
+    { ID(2), 32, 24, 8, 8 },
+    { ID(3), 24,  0, 0, 0 },
+    { ID(4), 24, 16, 0, 2 },
+    { ID(5), 16,  0, 0, 0 },
+};
+
+enum { NUM_NATIVE = sizeof(native_order) / sizeof(native_order[0]) };
+
+static void
+init_attrs(struct wcore_config_attrs *attrs)
+{
+    memset(attrs, 0, sizeof(*attrs));
+    attrs->config_ranking = WAFFLE_CONFIG_PREFER_NATIVE_ORDER;
+}
+
+static void
+test_wcore_config_rank_native_order(void **state) {
+    struct wcore_config_candidate c[NUM_NATIVE];
+    struct wcore_config_attrs attrs;
+
+    init_attrs(&attrs);
+    memcpy(c, native_order, sizeof(c));
+
+    assert_false(wcore_config_rank_needed(&attrs));
+    assert_int_equal(wcore_config_rank(&attrs, c, NUM_NATIVE), NUM_NATIVE);
+    assert_memory_equal(c, native_order, sizeof(c));
+}
+
+static void
+test_wcore_config_rank_prefer_smallest(void **state) {
+    struct wcore_config_candidate c[NUM_NATIVE];
+    struct wcore_config_attrs attrs;
+
+    init_attrs(&attrs);
+    attrs.config_ranking = WAFFLE_CONFIG_PREFER_SMALLEST;
+    memcpy(c, native_order, sizeof(c));
+
+    assert_true(wcore_config_rank_needed(&attrs));
+    assert_int_equal(wcore_config_rank(&attrs, c, NUM_NATIVE), NUM_NATIVE);
+    assert_ptr_equal(c[0].native, ID(5));
+    assert_ptr_equal(c[1].native, ID(3));
+    assert_ptr_equal(c[2].native, ID(0));
+    assert_ptr_equal(c[3].native, ID(4));
+    assert_ptr_equal(c[4].native, ID(1));
+    assert_ptr_equal(c[5].native, ID(2));
+}
+
+static void
+test_wcore_config_rank_prefer_smallest_is_stable(void **state) {
+    struct wcore_config_candidate c[] = {
+        { ID(0), 32, 0, 0, 0 },
+        { ID(1), 24, 8, 0, 0 },
+        { ID(2), 16, 0, 0, 0 },
+        { ID(3), 32, 0, 0, 0 },
+    };
+    struct wcore_config_attrs attrs;
+
+    init_attrs(&attrs);
+    attrs.config_ranking = WAFFLE_CONFIG_PREFER_SMALLEST;
+
+    assert_int_equal(wcore_config_rank(&attrs, c, 4), 4);
+    assert_ptr_equal(c[0].native, ID(2));
+    assert_ptr_equal(c[1].native, ID(0));
+    assert_ptr_equal(c[2].native, ID(1));
+    assert_ptr_equal(c[3].native, ID(3));
+}
+
+static void
+test_wcore_config_rank_query_attrs(void **state) {
+    struct wcore_config_attrs attrs, query;
+
+    init_attrs(&attrs);
+    attrs.sample_buffers = true;
+    attrs.samples = 8;
+
+    wcore_config_rank_query_attrs(&attrs, &query);
+    assert_true(query.sample_buffers);
+    assert_int_equal(query.samples, 8);
+
+    attrs.samples_fallback = true;
+    wcore_config_rank_query_attrs(&attrs, &query);
+    assert_false(query.sample_buffers);
+    assert_int_equal(query.samples, 0);
+    assert_true(query.samples_fallback);
+}
+
+static void
+test_wcore_config_rank_samples_exact(void **state) {
+    struct wcore_config_candidate c[NUM_NATIVE];
+    struct wcore_config_attrs attrs;
+
+    init_attrs(&attrs);
+    attrs.samples = 8;
+    attrs.samples_fallback = true;
+    memcpy(c, native_order, sizeof(c));
+
+    assert_int_equal(wcore_config_rank(&attrs, c, NUM_NATIVE), 1);
+    assert_ptr_equal(c[0].native, ID(2));
+}
+
+static void
+test_wcore_config_rank_samples_fall_back(void **state) {
+    struct wcore_config_candidate c[NUM_NATIVE];
+    struct wcore_config_attrs attrs;
+
+    // No config has 16 samples, so fall back to 8.
+    init_attrs(&attrs);
+    attrs.samples = 16;
+    attrs.samples_fallback = true;
+    memcpy(c, native_order, sizeof(c));
+
+    assert_int_equal(wcore_config_rank(&attrs, c, NUM_NATIVE), 1);
+    assert_ptr_equal(c[0].native, ID(2));
+
+    // Without the 8 and 4 sample configs, fall back to 2.
+    c[0] = native_order[0];
+    c[1] = native_order[3];
+    c[2] = native_order[4];
+    c[3] = native_order[5];
+    attrs.samples = 8;
+
+    assert_int_equal(wcore_config_rank(&attrs, c, 4), 1);
+    assert_ptr_equal(c[0].native, ID(4));
+}
+
+static void
+test_wcore_config_rank_samples_fall_back_to_zero(void **state) {
+    struct wcore_config_candidate c[] = {
+        { ID(0), 32, 24, 8, 0 },
+        { ID(1), 24,  0, 0, 0 },
+    };
+    struct wcore_config_attrs attrs;
+
+    init_attrs(&attrs);
+    attrs.samples = 8;
+    attrs.samples_fallback = true;
+    attrs.config_ranking = WAFFLE_CONFIG_PREFER_SMALLEST;
+
+    assert_int_equal(wcore_config_rank(&attrs, c, 2), 2);
+    assert_ptr_equal(c[0].native, ID(1));
+    assert_ptr_equal(c[1].native, ID(0));
+}
+
+static void
+test_wcore_config_rank_empty(void **state) {
+    struct wcore_config_attrs attrs;
+
+    init_attrs(&attrs);
+    attrs.samples = 4;
+    attrs.samples_fallback = true;
+    attrs.config_ranking = WAFFLE_CONFIG_PREFER_SMALLEST;
+
+    assert_int_equal(wcore_config_rank(&attrs, NULL, 0), 0);
+}
+
+int
+main(void) {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_wcore_config_rank_native_order),
+        cmocka_unit_test(test_wcore_config_rank_prefer_smallest),
+        cmocka_unit_test(test_wcore_config_rank_prefer_smallest_is_stable),
+        cmocka_unit_test(test_wcore_config_rank_query_attrs),
+        cmocka_unit_test(test_wcore_config_rank_samples_exact),
+        cmocka_unit_test(test_wcore_config_rank_samples_fall_back),
+        cmocka_unit_test(test_wcore_config_rank_samples_fall_back_to_zero),
+        cmocka_unit_test(test_wcore_config_rank_empty),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
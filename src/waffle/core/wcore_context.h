@@ -32,16 +32,37 @@
 #include "api_object.h"
 
 #include "wcore_config.h"
+#include "wcore_tinfo.h"
 #include "wcore_util.h"
 
 struct wcore_context;
+struct wcore_context_pool;
 struct wcore_display;
+struct waffle_gl_dispatch;
 union waffle_native_context;
 
 struct wcore_context {
     struct api_object api;
     enum waffle_enum context_api; // WAFFLE_CONTEXT_*
     struct wcore_display *display;
+
+    /// Unique in the process, so that a context at a reused address is not
+    /// taken for the one that was current there.
+    uint64_t serial;
+
+    /// Filled at the first waffle_make_current() if the platform was
+    /// initialized with WAFFLE_GL_DISPATCH. Null until then.
+    struct waffle_gl_dispatch *dispatch;
+
+    /// The pool that owns the context, or null. Whether the context is
+    /// checked out is guarded by the pool's lock.
+    struct wcore_context_pool *pool;
+    bool pool_checked_out;
+
+    /// The windows with WAFFLE_WINDOW_ASYNC_PRESENT that render with the
+    /// context. They keep its framebuffer and dispatch table, so the
+    /// context outlives them.
+    int32_t present_windows;
 };
 
 static inline struct waffle_context*
@@ -64,6 +85,7 @@ wcore_context_init(struct wcore_context *self,
     self->api.display_id = config->display->api.display_id;
     self->context_api = config->attrs.context_api;
     self->display = config->display;
+    self->serial = wcore_tinfo_next_serial();
 
     return true;
 }
@@ -71,7 +93,7 @@ wcore_context_init(struct wcore_context *self,
 static inline bool
 wcore_context_teardown(struct wcore_context *self)
 {
-    (void) self;
     assert(self);
+    free(self->dispatch);
     return true;
 }
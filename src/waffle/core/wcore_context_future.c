@@ -0,0 +1,149 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "wcore_caps_cache.h"
+#include "wcore_config.h"
+#include "wcore_context.h"
+#include "wcore_context_future.h"
+#include "wcore_error.h"
+#include "wcore_platform.h"
+
+static void
+wcore_context_future_run(struct wcore_worker_job *job)
+{
+    struct wcore_context_future *self = wcore_context_future_from_job(job);
+    struct wcore_platform *platform = self->platform;
+    struct wcore_config *config = self->config;
+    struct wcore_context *context;
+    const struct waffle_error_info *info;
+
+    // The worker's error state is its own, so start clean.
+    wcore_error_reset();
+
+    context = platform->vtbl->context.create(platform, config,
+                                             self->shared_ctx);
+
+    mtx_lock(&self->mutex);
+
+    if (context) {
+        wcore_caps_cache_note_version(&config->display->caps_cache,
+                                      &config->attrs);
+        self->context = context;
+    }
+    else {
+        info = wcore_error_get_info();
+        self->error_code = info->code != WAFFLE_NO_ERROR
+                               ? info->code : WAFFLE_ERROR_UNKNOWN;
+        if (info->message_length > 0)
+            self->error_message = wcore_strdup(info->message);
+    }
+
+    self->done = true;
+    cnd_broadcast(&self->cond);
+    mtx_unlock(&self->mutex);
+}
+
+static void
+wcore_context_future_destroy(struct wcore_context_future *self)
+{
+    cnd_destroy(&self->cond);
+    mtx_destroy(&self->mutex);
+    free(self->error_message);
+    free(self);
+}
+
+struct wcore_context_future*
+wcore_context_future_create(struct wcore_platform *platform,
+                            struct wcore_config *config,
+                            struct wcore_context *shared_ctx)
+{
+    struct wcore_context_future *self;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    if (mtx_init(&self->mutex, mtx_plain) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "mtx_init failed");
+        free(self);
+        return NULL;
+    }
+
+    if (cnd_init(&self->cond) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "cnd_init failed");
+        mtx_destroy(&self->mutex);
+        free(self);
+        return NULL;
+    }
+
+    self->api.display_id = config->api.display_id;
+    self->job.run = wcore_context_future_run;
+    self->platform = platform;
+    self->config = config;
+    self->shared_ctx = shared_ctx;
+
+    if (!wcore_worker_post(&platform->worker, &self->job)) {
+        wcore_context_future_destroy(self);
+        return NULL;
+    }
+
+    return self;
+}
+
+bool
+wcore_context_future_is_ready(struct wcore_context_future *self)
+{
+    bool done;
+
+    mtx_lock(&self->mutex);
+    done = self->done;
+    mtx_unlock(&self->mutex);
+
+    return done;
+}
+
+struct wcore_context*
+wcore_context_future_wait(struct wcore_context_future *self)
+{
+    struct wcore_context *context;
+
+    mtx_lock(&self->mutex);
+    while (!self->done)
+        cnd_wait(&self->cond, &self->mutex);
+    mtx_unlock(&self->mutex);
+
+    context = self->context;
+    if (!context) {
+        if (self->error_message)
+            wcore_errorf(self->error_code, "%s", self->error_message);
+        else
+            wcore_error(self->error_code);
+    }
+
+    wcore_context_future_destroy(self);
+    return context;
+}
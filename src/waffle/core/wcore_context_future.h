@@ -0,0 +1,101 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+
+#include "api_object.h"
+#include "threads.h"
+
+#include "wcore_util.h"
+#include "wcore_worker.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct wcore_config;
+struct wcore_context;
+struct wcore_platform;
+
+/// @brief A context being created on the platform's worker thread.
+struct wcore_context_future {
+    struct api_object api;
+    struct wcore_worker_job job;
+
+    struct wcore_platform *platform;
+    struct wcore_config *config;
+    struct wcore_context *shared_ctx;
+
+    /// The fields below are guarded by @a mutex until @a done is set.
+    mtx_t mutex;
+    cnd_t cond;
+    bool done;
+    struct wcore_context *context;
+
+    /// The worker's error state, replayed to the thread that waits.
+    enum waffle_error error_code;
+    char *error_message;
+};
+
+DEFINE_CONTAINER_CAST_FUNC(wcore_context_future_from_job,
+                           struct wcore_context_future,
+                           struct wcore_worker_job,
+                           job)
+
+static inline struct waffle_context_future*
+waffle_context_future(struct wcore_context_future *self) {
+    return (struct waffle_context_future*) self;
+}
+
+static inline struct wcore_context_future*
+wcore_context_future(struct waffle_context_future *self) {
+    return (struct wcore_context_future*) self;
+}
+
+/// @brief Queue the creation of a context on the platform's worker.
+///
+/// @a config and @a shared_ctx must stay alive until the future is waited
+/// on.
+struct wcore_context_future*
+wcore_context_future_create(struct wcore_platform *platform,
+                            struct wcore_config *config,
+                            struct wcore_context *shared_ctx);
+
+/// @brief Return true if wcore_context_future_wait() would not block.
+bool
+wcore_context_future_is_ready(struct wcore_context_future *self);
+
+/// @brief Block until the context is created, then free the future.
+///
+/// On failure, return null and emit the worker's error on the calling
+/// thread.
+struct wcore_context*
+wcore_context_future_wait(struct wcore_context_future *self);
+
+#ifdef __cplusplus
+}
+#endif
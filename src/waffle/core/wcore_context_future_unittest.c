@@ -0,0 +1,119 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <cmocka.h>
+
+#include "waffle.h"
+
+#include "wcore_config.h"
+#include "wcore_context.h"
+#include "wcore_context_future.h"
+#include "wcore_display.h"
+#include "wcore_error.h"
+#include "wcore_fake_platform.h"
+#include "wcore_platform.h"
+
+static int
+setup(void **state) {
+    struct wcore_fake_platform *ts = wcore_fake_platform_create();
+
+    if (!ts)
+        return -1;
+
+    if (!wcore_worker_init(&ts->platform.worker)) {
+        wcore_fake_platform_destroy(ts);
+        return -1;
+    }
+
+    // Read by the worker thread. The worker post orders the write before
+    // the read.
+    ts->create_error = WAFFLE_ERROR_BAD_ATTRIBUTE;
+    *state = ts;
+    return 0;
+}
+
+static int
+teardown(void **state) {
+    struct wcore_fake_platform *ts = *state;
+
+    wcore_worker_teardown(&ts->platform.worker);
+    wcore_fake_platform_destroy(ts);
+    return 0;
+}
+
+static void
+test_wcore_context_future_replays_error(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_context_future *future;
+    const struct waffle_error_info *info;
+
+    future = wcore_context_future_create(&ts->platform, &ts->config, NULL);
+    assert_non_null(future);
+
+    assert_null(wcore_context_future_wait(future));
+
+    // The error was set on the worker thread, and is replayed here.
+    info = wcore_error_get_info();
+    assert_int_equal(info->code, WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_string_equal(info->message, "fake failure");
+}
+
+static void
+test_wcore_context_future_unknown_error(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_context_future *future;
+    const struct waffle_error_info *info;
+
+    ts->fail_silently = true;
+
+    future = wcore_context_future_create(&ts->platform, &ts->config, NULL);
+    assert_non_null(future);
+
+    assert_null(wcore_context_future_wait(future));
+
+    info = wcore_error_get_info();
+    assert_int_equal(info->code, WAFFLE_ERROR_UNKNOWN);
+    assert_int_equal(info->message_length, 0);
+}
+
+int
+main(void) {
+    const struct CMUnitTest tests[] = {
+        #define unit_test_make(name) cmocka_unit_test_setup_teardown(name, setup, teardown)
+
+        unit_test_make(test_wcore_context_future_replays_error),
+        unit_test_make(test_wcore_context_future_unknown_error),
+
+        #undef unit_test_make
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
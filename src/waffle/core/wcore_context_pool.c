@@ -0,0 +1,253 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "wcore_caps_cache.h"
+#include "wcore_config.h"
+#include "wcore_config_cache.h"
+#include "wcore_context.h"
+#include "wcore_context_pool.h"
+#include "wcore_error.h"
+#include "wcore_platform.h"
+#include "wcore_tinfo.h"
+
+static struct wcore_context*
+create_context(struct wcore_context_pool *self)
+{
+    struct wcore_platform *platform = self->platform;
+    struct wcore_config *config = self->config;
+    struct wcore_context *ctx;
+
+    ctx = platform->vtbl->context.create(platform, config, self->shared_ctx);
+    if (!ctx)
+        return NULL;
+
+    ctx->pool = self;
+    wcore_caps_cache_note_version(&config->display->caps_cache,
+                                  &config->attrs);
+    return ctx;
+}
+
+static bool
+destroy_context(struct wcore_context_pool *self, struct wcore_context *ctx)
+{
+    ctx->pool = NULL;
+    wcore_tinfo_forget_current(wcore_tinfo_get(), ctx);
+    return self->platform->vtbl->context.destroy(ctx);
+}
+
+struct wcore_context_pool*
+wcore_context_pool_create(struct wcore_platform *platform,
+                          struct wcore_config *config,
+                          struct wcore_context *shared_ctx,
+                          int32_t prewarm,
+                          int32_t max)
+{
+    struct wcore_context_pool *self;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    self->free = wcore_calloc(max * sizeof(self->free[0]));
+    if (!self->free) {
+        free(self);
+        return NULL;
+    }
+
+    if (mtx_init(&self->mutex, mtx_plain) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "mtx_init failed");
+        free(self->free);
+        free(self);
+        return NULL;
+    }
+
+    self->api.display_id = config->api.display_id;
+    self->platform = platform;
+    self->config = config;
+    self->shared_ctx = shared_ctx;
+    self->max = max;
+
+    // The contexts are created from the config for the pool's lifetime.
+    wcore_config_ref(config);
+
+    // No other thread knows the pool yet, so no lock is needed.
+    while (self->num_free < prewarm) {
+        struct wcore_context *ctx = create_context(self);
+        if (!ctx) {
+            WCORE_ERROR_DISABLED({
+                wcore_context_pool_destroy(self);
+            });
+            return NULL;
+        }
+
+        self->free[self->num_free++] = ctx;
+        self->num_created++;
+    }
+
+    return self;
+}
+
+bool
+wcore_context_pool_destroy(struct wcore_context_pool *self)
+{
+    bool ok = true;
+
+    mtx_lock(&self->mutex);
+    if (self->num_free != self->num_created) {
+        int32_t num_out = self->num_created - self->num_free;
+        mtx_unlock(&self->mutex);
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "%d contexts are still checked out of the pool",
+                     num_out);
+        return false;
+    }
+    mtx_unlock(&self->mutex);
+
+    for (int32_t i = 0; i < self->num_free; ++i) {
+        if (self->free[i]->present_windows > 0) {
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                         "a pooled context still renders to a window with "
+                         "WAFFLE_WINDOW_ASYNC_PRESENT");
+            return false;
+        }
+    }
+
+    for (int32_t i = 0; i < self->num_free; ++i)
+        ok &= destroy_context(self, self->free[i]);
+
+    if (wcore_config_unref(self->config))
+        ok &= self->platform->vtbl->config.destroy(self->config);
+
+    mtx_destroy(&self->mutex);
+    free(self->free);
+    free(self);
+    return ok;
+}
+
+struct wcore_context*
+wcore_context_pool_checkout(struct wcore_context_pool *self)
+{
+    struct wcore_context *ctx = NULL;
+    bool create = false;
+
+    mtx_lock(&self->mutex);
+    if (self->num_free > 0) {
+        ctx = self->free[--self->num_free];
+        ctx->pool_checked_out = true;
+        self->hits++;
+    }
+    else {
+        self->misses++;
+        if (self->num_created < self->max) {
+            // Reserve the slot before creating outside the lock.
+            self->num_created++;
+            create = true;
+        }
+    }
+    mtx_unlock(&self->mutex);
+
+    if (ctx)
+        return ctx;
+
+    if (!create) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "all %d contexts of the pool are checked out",
+                     self->max);
+        return NULL;
+    }
+
+    ctx = create_context(self);
+
+    mtx_lock(&self->mutex);
+    if (ctx)
+        ctx->pool_checked_out = true;
+    else
+        self->num_created--;
+    mtx_unlock(&self->mutex);
+
+    return ctx;
+}
+
+bool
+wcore_context_pool_return(struct wcore_context_pool *self,
+                          struct wcore_context *ctx)
+{
+    bool ok = false;
+
+    // Check under the lock, so that racing returns of one context cannot
+    // both succeed.
+    mtx_lock(&self->mutex);
+    if (ctx->pool == self && ctx->pool_checked_out) {
+        // A slot is reserved for each created context, so there is room.
+        ctx->pool_checked_out = false;
+        self->free[self->num_free++] = ctx;
+        ok = true;
+    }
+    mtx_unlock(&self->mutex);
+
+    if (!ok) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the context is not checked out of this pool");
+    }
+
+    return ok;
+}
+
+bool
+wcore_context_pool_query(struct wcore_context_pool *self,
+                         int32_t attrib,
+                         intptr_t *value)
+{
+    bool ok = true;
+
+    mtx_lock(&self->mutex);
+
+    switch (attrib) {
+        case WAFFLE_CONTEXT_POOL_MAX:
+            *value = self->max;
+            break;
+        case WAFFLE_CONTEXT_POOL_SIZE:
+            *value = self->num_created;
+            break;
+        case WAFFLE_CONTEXT_POOL_AVAILABLE:
+            *value = self->num_free;
+            break;
+        case WAFFLE_CONTEXT_POOL_HITS:
+            *value = (intptr_t) self->hits;
+            break;
+        case WAFFLE_CONTEXT_POOL_MISSES:
+            *value = (intptr_t) self->misses;
+            break;
+        default:
+            wcore_error_bad_attribute(attrib);
+            ok = false;
+            break;
+    }
+
+    mtx_unlock(&self->mutex);
+    return ok;
+}
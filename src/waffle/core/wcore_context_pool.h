@@ -0,0 +1,119 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "api_object.h"
+#include "threads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct wcore_config;
+struct wcore_context;
+struct wcore_platform;
+
+/// @brief Contexts of one config, created ahead of need and reused.
+struct wcore_context_pool {
+    struct api_object api;
+
+    struct wcore_platform *platform;
+    struct wcore_config *config;
+    struct wcore_context *shared_ctx;
+    int32_t max;
+
+    /// Guards the fields below. Contexts are created and destroyed outside
+    /// it, so checkout and return only ever wait for a few stores.
+    mtx_t mutex;
+
+    /// The checked-in contexts, used as a stack so that the most recently
+    /// returned, and so likely still warm, context is handed out first.
+    /// Has room for @a max.
+    struct wcore_context **free;
+    int32_t num_free;
+
+    /// Includes the contexts being created.
+    int32_t num_created;
+
+    int64_t hits;
+    int64_t misses;
+};
+
+static inline struct waffle_context_pool*
+waffle_context_pool(struct wcore_context_pool *self) {
+    return (struct waffle_context_pool*) self;
+}
+
+static inline struct wcore_context_pool*
+wcore_context_pool(struct waffle_context_pool *self) {
+    return (struct wcore_context_pool*) self;
+}
+
+/// @brief Create a pool and fill it with @a prewarm contexts.
+///
+/// The pool holds a reference to @a config. @a shared_ctx must outlive the
+/// pool.
+struct wcore_context_pool*
+wcore_context_pool_create(struct wcore_platform *platform,
+                          struct wcore_config *config,
+                          struct wcore_context *shared_ctx,
+                          int32_t prewarm,
+                          int32_t max);
+
+/// @brief Destroy the pool and its contexts.
+///
+/// Fails if any context is still checked out.
+bool
+wcore_context_pool_destroy(struct wcore_context_pool *self);
+
+/// @brief Hand out a checked-in context, else create one if the pool holds
+/// fewer than @a max.
+///
+/// Thread-safe.
+struct wcore_context*
+wcore_context_pool_checkout(struct wcore_context_pool *self);
+
+/// @brief Check in a context that wcore_context_pool_checkout() handed out.
+///
+/// Thread-safe. The context must not be current to any thread.
+bool
+wcore_context_pool_return(struct wcore_context_pool *self,
+                          struct wcore_context *ctx);
+
+/// @brief Query a WAFFLE_CONTEXT_POOL_* statistic.
+///
+/// Thread-safe.
+bool
+wcore_context_pool_query(struct wcore_context_pool *self,
+                         int32_t attrib,
+                         intptr_t *value);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,278 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <cmocka.h>
+
+#include "waffle.h"
+
+#include "wcore_config.h"
+#include "wcore_config_cache.h"
+#include "wcore_context.h"
+#include "wcore_context_pool.h"
+#include "wcore_display.h"
+#include "wcore_error.h"
+#include "wcore_fake_platform.h"
+#include "wcore_platform.h"
+#include "wcore_tinfo.h"
+
+static int num_configs_destroyed;
+
+static bool
+fake_config_destroy(struct wcore_config *config)
+{
+    ++num_configs_destroyed;
+    return true;
+}
+
+static int
+setup(void **state) {
+    struct wcore_fake_platform *ts = wcore_fake_platform_create();
+
+    if (!ts)
+        return -1;
+
+    num_configs_destroyed = 0;
+
+    ts->vtbl.config.destroy = fake_config_destroy;
+    *state = ts;
+    return 0;
+}
+
+static int
+teardown(void **state) {
+    wcore_fake_platform_destroy(*state);
+    return 0;
+}
+
+static intptr_t
+query(struct wcore_context_pool *pool, int32_t attrib)
+{
+    intptr_t value = -1;
+    assert_true(wcore_context_pool_query(pool, attrib, &value));
+    return value;
+}
+
+static void
+test_wcore_context_pool_prewarm(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_context_pool *pool;
+
+    pool = wcore_context_pool_create(&ts->platform, &ts->config, NULL, 3, 5);
+    assert_non_null(pool);
+    assert_int_equal(ts->num_created, 3);
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_SIZE), 3);
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_AVAILABLE), 3);
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_MAX), 5);
+
+    assert_true(wcore_context_pool_destroy(pool));
+    assert_int_equal(ts->num_destroyed, 3);
+}
+
+static void
+test_wcore_context_pool_prewarm_fails(void **state) {
+    struct wcore_fake_platform *ts = *state;
+
+    ts->create_error = WAFFLE_ERROR_UNKNOWN;
+    assert_null(wcore_context_pool_create(&ts->platform, &ts->config,
+                                          NULL, 2, 2));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_UNKNOWN);
+}
+
+static void
+test_wcore_context_pool_holds_config(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_context_pool *pool;
+
+    pool = wcore_context_pool_create(&ts->platform, &ts->config, NULL, 1, 1);
+    assert_non_null(pool);
+
+    // The caller's reference goes, but the pool's keeps the config.
+    assert_false(wcore_config_unref(&ts->config));
+    assert_int_equal(num_configs_destroyed, 0);
+
+    assert_true(wcore_context_pool_destroy(pool));
+    assert_int_equal(num_configs_destroyed, 1);
+}
+
+static void
+test_wcore_context_pool_forgets_current(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_context_pool *pool;
+    struct wcore_tinfo *tinfo = wcore_tinfo_get();
+    struct wcore_context *ctx;
+
+    pool = wcore_context_pool_create(&ts->platform, &ts->config, NULL, 1, 1);
+    assert_non_null(pool);
+
+    ctx = wcore_context_pool_checkout(pool);
+    assert_non_null(ctx);
+    wcore_tinfo_set_current(tinfo, &ts->display, NULL, ctx);
+    assert_true(wcore_context_pool_return(pool, ctx));
+
+    assert_true(wcore_context_pool_destroy(pool));
+    assert_null(tinfo->current_context);
+    assert_false(tinfo->current_is_valid);
+}
+
+static void
+test_wcore_context_pool_hit_and_miss(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_context_pool *pool;
+    struct wcore_context *a, *b, *c;
+
+    pool = wcore_context_pool_create(&ts->platform, &ts->config, NULL, 1, 2);
+    assert_non_null(pool);
+
+    // The prewarmed context.
+    a = wcore_context_pool_checkout(pool);
+    assert_non_null(a);
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_HITS), 1);
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_MISSES), 0);
+
+    // Created lazily.
+    b = wcore_context_pool_checkout(pool);
+    assert_non_null(b);
+    assert_int_equal(ts->num_created, 2);
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_MISSES), 1);
+
+    // Beyond the maximum.
+    c = wcore_context_pool_checkout(pool);
+    assert_null(c);
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_PARAMETER);
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_MISSES), 2);
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_SIZE), 2);
+
+    // The most recently returned context comes out first.
+    assert_true(wcore_context_pool_return(pool, a));
+    assert_true(wcore_context_pool_return(pool, b));
+    assert_ptr_equal(wcore_context_pool_checkout(pool), b);
+    assert_true(wcore_context_pool_return(pool, b));
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_HITS), 2);
+    assert_int_equal(ts->num_created, 2);
+
+    assert_true(wcore_context_pool_destroy(pool));
+    assert_int_equal(ts->num_destroyed, 2);
+}
+
+static void
+test_wcore_context_pool_bad_return(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_context_pool *pool, *other;
+    struct wcore_context *ctx;
+
+    pool = wcore_context_pool_create(&ts->platform, &ts->config, NULL, 1, 1);
+    other = wcore_context_pool_create(&ts->platform, &ts->config, NULL, 0, 1);
+    assert_non_null(pool);
+    assert_non_null(other);
+
+    ctx = wcore_context_pool_checkout(pool);
+    assert_non_null(ctx);
+
+    assert_false(wcore_context_pool_return(other, ctx));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_PARAMETER);
+    wcore_error_reset();
+
+    // Not while a context is out.
+    assert_false(wcore_context_pool_destroy(pool));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_PARAMETER);
+
+    assert_true(wcore_context_pool_return(pool, ctx));
+    assert_false(wcore_context_pool_return(pool, ctx));
+
+    assert_true(wcore_context_pool_destroy(pool));
+    assert_true(wcore_context_pool_destroy(other));
+    assert_int_equal(ts->num_destroyed, 1);
+}
+
+static int
+borrow_many(void *arg)
+{
+    struct wcore_context_pool *pool = arg;
+
+    for (int i = 0; i < 10000; ++i) {
+        struct wcore_context *ctx = wcore_context_pool_checkout(pool);
+        if (!ctx)
+            return 1;
+        if (!wcore_context_pool_return(pool, ctx))
+            return 1;
+    }
+
+    return 0;
+}
+
+static void
+test_wcore_context_pool_threads(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_context_pool *pool;
+    thrd_t threads[4];
+
+    // As many contexts as threads, so a checkout can never fail.
+    pool = wcore_context_pool_create(&ts->platform, &ts->config, NULL, 1, 4);
+    assert_non_null(pool);
+
+    for (int i = 0; i < 4; ++i)
+        assert_int_equal(thrd_create(&threads[i], borrow_many, pool),
+                         thrd_success);
+
+    for (int i = 0; i < 4; ++i) {
+        int res = -1;
+        assert_int_equal(thrd_join(threads[i], &res), thrd_success);
+        assert_int_equal(res, 0);
+    }
+
+    assert_true(ts->num_created <= 4);
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_HITS) +
+                     query(pool, WAFFLE_CONTEXT_POOL_MISSES), 40000);
+    assert_int_equal(query(pool, WAFFLE_CONTEXT_POOL_AVAILABLE),
+                     ts->num_created);
+
+    assert_true(wcore_context_pool_destroy(pool));
+    assert_int_equal(ts->num_destroyed, ts->num_created);
+}
+
+int
+main(void) {
+    const struct CMUnitTest tests[] = {
+        #define unit_test_make(name) cmocka_unit_test_setup_teardown(name, setup, teardown)
+
+        unit_test_make(test_wcore_context_pool_prewarm),
+        unit_test_make(test_wcore_context_pool_prewarm_fails),
+        unit_test_make(test_wcore_context_pool_holds_config),
+        unit_test_make(test_wcore_context_pool_forgets_current),
+        unit_test_make(test_wcore_context_pool_hit_and_miss),
+        unit_test_make(test_wcore_context_pool_bad_return),
+        unit_test_make(test_wcore_context_pool_threads),
+
+        #undef unit_test_make
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -31,6 +31,9 @@
 
 #include "api_object.h"
 
+#include "wcore_caps_cache.h"
+#include "wcore_config_cache.h"
+#include "wcore_ext_set.h"
 #include "wcore_util.h"
 
 #ifdef __cplusplus
@@ -44,6 +47,32 @@ union waffle_native_display;
 struct wcore_display {
     struct api_object api;
     struct wcore_platform *platform;
+
+    /// @brief The display's extensions, for waffle_display_has_extension().
+    ///
+    /// Platforms that are able to query the native extension strings fill
+    /// this during connect. It is empty for the others.
+    struct wcore_ext_set extensions;
+
+    /// @brief True if vtbl->get_proc_address() returns core GL functions.
+    ///
+    /// Set for GLX, and for EGL 1.5 or EGL_KHR_get_all_proc_addresses.
+    /// Otherwise core functions must be looked up with vtbl->dl_sym().
+    bool proc_address_includes_core;
+
+    /// @brief Configs chosen on this display, released at disconnect.
+    struct wcore_config_cache config_cache;
+
+    /// @brief Identifies the driver behind the display, for the capability
+    /// cache.
+    ///
+    /// Platforms that are able to identify their driver set this during
+    /// connect. It is 0 for the others, which disables the cache.
+    uint64_t driver_id;
+
+    /// @brief What the driver is known to support, if WAFFLE_CAPABILITY_CACHE
+    /// is enabled.
+    struct wcore_caps_cache caps_cache;
 };
 
 static inline struct waffle_display*
@@ -64,8 +93,8 @@ wcore_display_init(struct wcore_display *self,
 static inline bool
 wcore_display_teardown(struct wcore_display *self)
 {
-    (void) self;
     assert(self);
+    wcore_ext_set_finish(&self->extensions);
     return true;
 }
 
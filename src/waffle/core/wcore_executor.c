@@ -0,0 +1,440 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "wcore_caps_cache.h"
+#include "wcore_config.h"
+#include "wcore_context.h"
+#include "wcore_display.h"
+#include "wcore_error.h"
+#include "wcore_executor.h"
+#include "wcore_gl_dispatch.h"
+#include "wcore_platform.h"
+#include "wcore_tinfo.h"
+
+/// Record the error left on the calling thread, for replay on another.
+static void
+capture_error(int32_t *code, char **message)
+{
+    const struct waffle_error_info *info = wcore_error_get_info();
+
+    *code = info->code != WAFFLE_NO_ERROR ? info->code : WAFFLE_ERROR_UNKNOWN;
+    if (info->message_length > 0)
+        *message = wcore_strdup(info->message);
+}
+
+static void
+replay_error(int32_t code, const char *message)
+{
+    if (message)
+        wcore_errorf(code, "%s", message);
+    else
+        wcore_error(code);
+}
+
+static bool
+bind_context(struct wcore_executor_thread *self)
+{
+    struct wcore_platform *platform = self->executor->platform;
+    struct wcore_display *display = self->executor->display;
+    struct wcore_tinfo *tinfo = wcore_tinfo_get();
+
+    if (!platform->vtbl->make_current(platform, display, NULL, self->ctx))
+        return false;
+
+    wcore_tinfo_set_current(tinfo, display, NULL, self->ctx);
+
+    // Jobs may call through waffle_get_current_dispatch(), like any thread
+    // that made the context current with waffle_make_current().
+    if (platform->gl_dispatch) {
+        self->ctx->dispatch = wcore_gl_dispatch_create(platform, self->ctx);
+        if (!self->ctx->dispatch)
+            return false;
+
+        tinfo->current_dispatch = self->ctx->dispatch;
+    }
+
+    return true;
+}
+
+static void
+unbind_context(struct wcore_executor_thread *self)
+{
+    struct wcore_platform *platform = self->executor->platform;
+    struct wcore_tinfo *tinfo = wcore_tinfo_get();
+
+    // Nothing can act on a failure here; the context is destroyed next.
+    platform->vtbl->make_current(platform, self->executor->display,
+                                 NULL, NULL);
+
+    tinfo->current_window = NULL;
+    tinfo->current_context = NULL;
+    tinfo->current_dispatch = NULL;
+}
+
+static struct wcore_executor_future*
+pop(struct wcore_executor_thread *self)
+{
+    struct wcore_executor_future *future;
+
+    mtx_lock(&self->mutex);
+    future = self->head;
+    if (future) {
+        self->head = future->next;
+        if (!self->head)
+            self->tail = NULL;
+        future->next = NULL;
+    }
+    mtx_unlock(&self->mutex);
+
+    return future;
+}
+
+static void
+push(struct wcore_executor_thread *self,
+     struct wcore_executor_future *future)
+{
+    mtx_lock(&self->mutex);
+    if (self->tail)
+        self->tail->next = future;
+    else
+        self->head = future;
+    self->tail = future;
+    mtx_unlock(&self->mutex);
+}
+
+static void
+run(struct wcore_executor_future *future)
+{
+    bool ok;
+
+    // Each job starts with a clean error state, so that a failure reports
+    // its own error and not one left by an earlier job.
+    wcore_error_reset();
+
+    ok = future->func(future->data);
+
+    mtx_lock(&future->mutex);
+    future->ok = ok;
+    if (!ok)
+        capture_error(&future->error_code, &future->error_message);
+    future->done = true;
+    cnd_broadcast(&future->cond);
+    mtx_unlock(&future->mutex);
+}
+
+static int
+wcore_executor_thread_main(void *arg)
+{
+    struct wcore_executor_thread *self = arg;
+    struct wcore_executor *executor = self->executor;
+    struct wcore_executor_future *future;
+    int32_t n = executor->num_threads;
+    bool ok;
+
+    ok = bind_context(self);
+
+    mtx_lock(&executor->mutex);
+    if (!ok && !executor->start_failed) {
+        executor->start_failed = true;
+        capture_error(&executor->start_error_code,
+                      &executor->start_error_message);
+    }
+    executor->num_started++;
+    cnd_broadcast(&executor->cond);
+    mtx_unlock(&executor->mutex);
+
+    if (!ok) {
+        unbind_context(self);
+        return 0;
+    }
+
+    for (;;) {
+        mtx_lock(&executor->mutex);
+        while (executor->num_queued == 0 && !executor->stopping)
+            cnd_wait(&executor->cond, &executor->mutex);
+
+        // Stopping still drains the queues.
+        if (executor->num_queued == 0) {
+            mtx_unlock(&executor->mutex);
+            break;
+        }
+
+        executor->num_queued--;
+        mtx_unlock(&executor->mutex);
+
+        // The claim guarantees a job in some queue, but another thread may
+        // take the one seen on a first pass, so keep looking.
+        future = NULL;
+        while (!future) {
+            future = pop(self);
+            for (int32_t i = 1; !future && i < n; ++i)
+                future = pop(&executor->threads[(self->index + i) % n]);
+        }
+
+        run(future);
+    }
+
+    unbind_context(self);
+    return 0;
+}
+
+static struct wcore_executor_thread*
+current_thread(struct wcore_executor *self)
+{
+    thrd_t current = thrd_current();
+
+    for (int32_t i = 0; i < self->num_threads; ++i) {
+        if (self->threads[i].ctx &&
+            thrd_equal(self->threads[i].thread, current))
+            return &self->threads[i];
+    }
+
+    return NULL;
+}
+
+/// Stop and join the first @a num_running threads, then free everything.
+static bool
+wcore_executor_teardown(struct wcore_executor *self, int32_t num_running)
+{
+    struct wcore_platform *platform = self->platform;
+    bool ok = true;
+
+    mtx_lock(&self->mutex);
+    self->stopping = true;
+    cnd_broadcast(&self->cond);
+    mtx_unlock(&self->mutex);
+
+    for (int32_t i = 0; i < num_running; ++i)
+        thrd_join(self->threads[i].thread, NULL);
+
+    for (int32_t i = self->num_threads - 1; i >= 0; --i) {
+        struct wcore_executor_thread *thread = &self->threads[i];
+
+        if (thread->ctx)
+            ok &= platform->vtbl->context.destroy(thread->ctx);
+        mtx_destroy(&thread->mutex);
+    }
+
+    cnd_destroy(&self->cond);
+    mtx_destroy(&self->mutex);
+    free(self->start_error_message);
+    free(self->threads);
+    free(self);
+    return ok;
+}
+
+struct wcore_executor*
+wcore_executor_create(struct wcore_platform *platform,
+                      struct wcore_config *config,
+                      struct wcore_context *shared_ctx,
+                      int32_t num_threads)
+{
+    struct wcore_executor *self;
+    int32_t num_running = 0;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    self->threads = wcore_calloc(num_threads * sizeof(self->threads[0]));
+    if (!self->threads) {
+        free(self);
+        return NULL;
+    }
+
+    if (mtx_init(&self->mutex, mtx_plain) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "mtx_init failed");
+        free(self->threads);
+        free(self);
+        return NULL;
+    }
+
+    if (cnd_init(&self->cond) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "cnd_init failed");
+        mtx_destroy(&self->mutex);
+        free(self->threads);
+        free(self);
+        return NULL;
+    }
+
+    self->api.display_id = config->api.display_id;
+    self->platform = platform;
+    self->display = config->display;
+    self->num_threads = num_threads;
+
+    for (int32_t i = 0; i < num_threads; ++i) {
+        struct wcore_executor_thread *thread = &self->threads[i];
+
+        thread->executor = self;
+        thread->index = i;
+        mtx_init(&thread->mutex, mtx_plain);
+    }
+
+    // Create the contexts here rather than on their threads, so that the
+    // share group exists before any thread uses it.
+    for (int32_t i = 0; i < num_threads; ++i) {
+        struct wcore_context *share =
+            shared_ctx ? shared_ctx : self->threads[0].ctx;
+
+        self->threads[i].ctx =
+            platform->vtbl->context.create(platform, config, share);
+        if (!self->threads[i].ctx)
+            goto fail;
+    }
+
+    wcore_caps_cache_note_version(&config->display->caps_cache,
+                                  &config->attrs);
+
+    for (; num_running < num_threads; ++num_running) {
+        struct wcore_executor_thread *thread = &self->threads[num_running];
+
+        if (thrd_create(&thread->thread, wcore_executor_thread_main,
+                        thread) != thrd_success) {
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN, "thrd_create failed");
+            goto fail;
+        }
+    }
+
+    mtx_lock(&self->mutex);
+    while (self->num_started < num_threads)
+        cnd_wait(&self->cond, &self->mutex);
+    mtx_unlock(&self->mutex);
+
+    if (self->start_failed) {
+        replay_error(self->start_error_code, self->start_error_message);
+        goto fail;
+    }
+
+    return self;
+
+fail:
+    WCORE_ERROR_DISABLED({
+        wcore_executor_teardown(self, num_running);
+    });
+    return NULL;
+}
+
+bool
+wcore_executor_destroy(struct wcore_executor *self)
+{
+    if (current_thread(self)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "an executor cannot be destroyed from its own thread");
+        return false;
+    }
+
+    return wcore_executor_teardown(self, self->num_threads);
+}
+
+struct wcore_executor_future*
+wcore_executor_submit(struct wcore_executor *self,
+                      bool (*func)(void *data),
+                      void *data)
+{
+    struct wcore_executor_future *future;
+    struct wcore_executor_thread *thread;
+
+    future = wcore_calloc(sizeof(*future));
+    if (!future)
+        return NULL;
+
+    if (mtx_init(&future->mutex, mtx_plain) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "mtx_init failed");
+        free(future);
+        return NULL;
+    }
+
+    if (cnd_init(&future->cond) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "cnd_init failed");
+        mtx_destroy(&future->mutex);
+        free(future);
+        return NULL;
+    }
+
+    future->api.display_id = self->api.display_id;
+    future->func = func;
+    future->data = data;
+
+    // Work that a job spawns stays with the thread that spawned it, whose
+    // caches are warm with the job's data. Other threads steal it only if
+    // they run dry.
+    thread = current_thread(self);
+
+    mtx_lock(&self->mutex);
+    if (!thread) {
+        thread = &self->threads[self->next_thread];
+        self->next_thread = (self->next_thread + 1) % self->num_threads;
+    }
+
+    // Queue before publishing the claimable count, so that a thread that
+    // claims the job finds it.
+    push(thread, future);
+    self->num_queued++;
+    cnd_signal(&self->cond);
+    mtx_unlock(&self->mutex);
+
+    return future;
+}
+
+static void
+wcore_executor_future_destroy(struct wcore_executor_future *self)
+{
+    cnd_destroy(&self->cond);
+    mtx_destroy(&self->mutex);
+    free(self->error_message);
+    free(self);
+}
+
+bool
+wcore_executor_future_is_ready(struct wcore_executor_future *self)
+{
+    bool done;
+
+    mtx_lock(&self->mutex);
+    done = self->done;
+    mtx_unlock(&self->mutex);
+
+    return done;
+}
+
+bool
+wcore_executor_future_wait(struct wcore_executor_future *self)
+{
+    bool ok;
+
+    mtx_lock(&self->mutex);
+    while (!self->done)
+        cnd_wait(&self->cond, &self->mutex);
+    mtx_unlock(&self->mutex);
+
+    ok = self->ok;
+    if (!ok)
+        replay_error(self->error_code, self->error_message);
+
+    wcore_executor_future_destroy(self);
+    return ok;
+}
@@ -0,0 +1,178 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "api_object.h"
+#include "threads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct wcore_config;
+struct wcore_context;
+struct wcore_display;
+struct wcore_executor;
+struct wcore_platform;
+
+/// @brief A submitted closure and the promise of its result.
+///
+/// The future outlives the executor, so it has its own lock.
+struct wcore_executor_future {
+    struct api_object api;
+
+    bool (*func)(void *data);
+    void *data;
+
+    /// Link in a thread's queue, guarded by that thread's lock.
+    struct wcore_executor_future *next;
+
+    mtx_t mutex;
+    cnd_t cond;
+    bool done;
+    bool ok;
+    int32_t error_code;
+    char *error_message;
+};
+
+/// @brief A render thread of a wcore_executor.
+struct wcore_executor_thread {
+    struct wcore_executor *executor;
+    int32_t index;
+    thrd_t thread;
+
+    /// Current to the thread for its whole life.
+    struct wcore_context *ctx;
+
+    /// Guards the queue. The owner and thieves both take from the head, so
+    /// that the oldest job runs first wherever it runs.
+    mtx_t mutex;
+    struct wcore_executor_future *head;
+    struct wcore_executor_future *tail;
+};
+
+/// @brief Threads that each keep a context current and run submitted
+/// closures.
+///
+/// Each thread has its own queue. Submissions are spread over the queues,
+/// and a thread whose queue is empty steals from the others, so a long job
+/// never holds up the ones queued behind it while another thread is idle.
+struct wcore_executor {
+    struct api_object api;
+
+    struct wcore_platform *platform;
+    struct wcore_display *display;
+
+    int32_t num_threads;
+    struct wcore_executor_thread *threads;
+
+    /// Guards the fields below.
+    mtx_t mutex;
+    cnd_t cond;
+
+    /// Jobs in the queues that no thread has claimed yet. A thread claims a
+    /// job here before looking for it, so it never sleeps while work waits
+    /// and never searches for work that is not there.
+    int32_t num_queued;
+
+    /// Where the next submission from outside the executor goes.
+    int32_t next_thread;
+
+    bool stopping;
+
+    /// Start-up handshake. A thread that cannot make its context current
+    /// records why and exits.
+    int32_t num_started;
+    bool start_failed;
+    int32_t start_error_code;
+    char *start_error_message;
+};
+
+static inline struct waffle_executor*
+waffle_executor(struct wcore_executor *self) {
+    return (struct waffle_executor*) self;
+}
+
+static inline struct wcore_executor*
+wcore_executor(struct waffle_executor *self) {
+    return (struct wcore_executor*) self;
+}
+
+static inline struct waffle_executor_future*
+waffle_executor_future(struct wcore_executor_future *self) {
+    return (struct waffle_executor_future*) self;
+}
+
+static inline struct wcore_executor_future*
+wcore_executor_future(struct waffle_executor_future *self) {
+    return (struct wcore_executor_future*) self;
+}
+
+/// @brief Start @a num_threads threads, each with a context of @a config
+/// made current.
+///
+/// The contexts share with @a shared_ctx, or with each other if it is
+/// null. @a config and @a shared_ctx must outlive the executor. Fails if
+/// any thread cannot make its context current.
+struct wcore_executor*
+wcore_executor_create(struct wcore_platform *platform,
+                      struct wcore_config *config,
+                      struct wcore_context *shared_ctx,
+                      int32_t num_threads);
+
+/// @brief Run the jobs already submitted, then stop the threads and
+/// destroy their contexts.
+///
+/// Must not be called from one of the executor's threads.
+bool
+wcore_executor_destroy(struct wcore_executor *self);
+
+/// @brief Queue a call of @a func(@a data) on one of the threads.
+///
+/// Thread-safe. A job submitted from one of the executor's threads is
+/// queued on that thread.
+struct wcore_executor_future*
+wcore_executor_submit(struct wcore_executor *self,
+                      bool (*func)(void *data),
+                      void *data);
+
+/// @brief Return true if the job has run. Never blocks.
+bool
+wcore_executor_future_is_ready(struct wcore_executor_future *self);
+
+/// @brief Wait for the job, free the future, and return the job's result.
+///
+/// If the job returned false, replay on the calling thread the error that
+/// it left on the executor's thread.
+bool
+wcore_executor_future_wait(struct wcore_executor_future *self);
+
+#ifdef __cplusplus
+}
+#endif
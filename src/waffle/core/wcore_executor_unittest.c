@@ -0,0 +1,311 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "waffle.h"
+
+#include "wcore_config.h"
+#include "wcore_context.h"
+#include "wcore_display.h"
+#include "wcore_error.h"
+#include "wcore_executor.h"
+#include "wcore_fake_platform.h"
+#include "wcore_platform.h"
+#include "wcore_tinfo.h"
+
+// Contexts are bound on the executor's threads, so num_bound is guarded by
+// count_mutex.
+static mtx_t count_mutex;
+static int num_bound;
+static bool fail_bind;
+
+static bool
+fake_make_current(struct wcore_platform *platform,
+                  struct wcore_display *display,
+                  struct wcore_window *window,
+                  struct wcore_context *ctx)
+{
+    bool ok = true;
+
+    mtx_lock(&count_mutex);
+    if (ctx && fail_bind) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "fake bind failure");
+        ok = false;
+    }
+    else if (ctx) {
+        ++num_bound;
+    }
+    else {
+        --num_bound;
+    }
+    mtx_unlock(&count_mutex);
+
+    return ok;
+}
+
+static int
+setup(void **state) {
+    struct wcore_fake_platform *ts = wcore_fake_platform_create();
+
+    if (!ts)
+        return -1;
+
+    num_bound = 0;
+    fail_bind = false;
+    mtx_init(&count_mutex, mtx_plain);
+
+    ts->vtbl.make_current = fake_make_current;
+    *state = ts;
+    return 0;
+}
+
+static int
+teardown(void **state) {
+    mtx_destroy(&count_mutex);
+    wcore_fake_platform_destroy(*state);
+    return 0;
+}
+
+struct bound_job {
+    struct wcore_executor *executor;
+    bool bound;
+};
+
+static bool
+check_bound(void *data)
+{
+    struct bound_job *job = data;
+    struct wcore_context *ctx = wcore_tinfo_get()->current_context;
+
+    for (int32_t i = 0; i < job->executor->num_threads; ++i)
+        job->bound |= ctx == job->executor->threads[i].ctx;
+
+    return true;
+}
+
+static void
+test_wcore_executor_bound(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_executor *executor;
+    struct wcore_executor_future *futures[100];
+    struct bound_job jobs[100];
+
+    executor = wcore_executor_create(&ts->platform, &ts->config, NULL, 4);
+    assert_non_null(executor);
+    assert_int_equal(ts->num_created, 4);
+    assert_int_equal(num_bound, 4);
+
+    for (int i = 0; i < 100; ++i) {
+        jobs[i].executor = executor;
+        jobs[i].bound = false;
+        futures[i] = wcore_executor_submit(executor, check_bound, &jobs[i]);
+        assert_non_null(futures[i]);
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        assert_true(wcore_executor_future_wait(futures[i]));
+        assert_true(jobs[i].bound);
+    }
+
+    assert_true(wcore_executor_destroy(executor));
+    assert_int_equal(num_bound, 0);
+    assert_int_equal(ts->num_destroyed, 4);
+}
+
+static void
+test_wcore_executor_bind_fails(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_executor *executor;
+
+    fail_bind = true;
+    executor = wcore_executor_create(&ts->platform, &ts->config, NULL, 3);
+    assert_null(executor);
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_UNKNOWN);
+    assert_string_equal(wcore_error_get_info()->message, "fake bind failure");
+    assert_int_equal(ts->num_destroyed, 3);
+}
+
+static bool
+fail_job(void *data)
+{
+    wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "job %d failed", *(int *) data);
+    return false;
+}
+
+static void
+test_wcore_executor_error(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_executor *executor;
+    struct wcore_executor_future *future;
+    int id = 7;
+
+    executor = wcore_executor_create(&ts->platform, &ts->config, NULL, 1);
+    assert_non_null(executor);
+
+    future = wcore_executor_submit(executor, fail_job, &id);
+    assert_non_null(future);
+    assert_false(wcore_executor_future_wait(future));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_PARAMETER);
+    assert_string_equal(wcore_error_get_info()->message, "job 7 failed");
+
+    wcore_error_reset();
+    assert_true(wcore_executor_destroy(executor));
+}
+
+struct steal_state {
+    mtx_t mutex;
+    bool done;
+};
+
+static bool
+block_until_done(void *data)
+{
+    struct steal_state *s = data;
+    const xtime ms = { .sec = 0, .nsec = 1000 * 1000 };
+    bool done = false;
+
+    // Give up after about ten seconds rather than hang the test.
+    for (int i = 0; i < 10000 && !done; ++i) {
+        mtx_lock(&s->mutex);
+        done = s->done;
+        mtx_unlock(&s->mutex);
+        if (!done)
+            thrd_sleep(&ms);
+    }
+
+    return done;
+}
+
+static bool
+set_done(void *data)
+{
+    struct steal_state *s = data;
+
+    mtx_lock(&s->mutex);
+    s->done = true;
+    mtx_unlock(&s->mutex);
+    return true;
+}
+
+static bool
+nop(void *data)
+{
+    return true;
+}
+
+static void
+test_wcore_executor_steal(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_executor *executor;
+    struct wcore_executor_future *a, *b, *c;
+    struct steal_state s = { .done = false };
+
+    mtx_init(&s.mutex, mtx_plain);
+
+    executor = wcore_executor_create(&ts->platform, &ts->config, NULL, 2);
+    assert_non_null(executor);
+
+    // Submissions alternate between the two queues, so set_done lands
+    // behind block_until_done. Whichever thread runs block_until_done,
+    // only the other one can run set_done.
+    a = wcore_executor_submit(executor, block_until_done, &s);
+    b = wcore_executor_submit(executor, nop, NULL);
+    c = wcore_executor_submit(executor, set_done, &s);
+
+    assert_true(wcore_executor_future_wait(a));
+    assert_true(wcore_executor_future_wait(b));
+    assert_true(wcore_executor_future_wait(c));
+
+    assert_true(wcore_executor_destroy(executor));
+    mtx_destroy(&s.mutex);
+}
+
+struct count_state {
+    mtx_t mutex;
+    int count;
+};
+
+static bool
+count(void *data)
+{
+    struct count_state *s = data;
+
+    mtx_lock(&s->mutex);
+    ++s->count;
+    mtx_unlock(&s->mutex);
+    return true;
+}
+
+static void
+test_wcore_executor_destroy_drains(void **state) {
+    struct wcore_fake_platform *ts = *state;
+    struct wcore_executor *executor;
+    struct wcore_executor_future *futures[1000];
+    struct count_state s = { .count = 0 };
+
+    mtx_init(&s.mutex, mtx_plain);
+
+    executor = wcore_executor_create(&ts->platform, &ts->config, NULL, 3);
+    assert_non_null(executor);
+
+    for (int i = 0; i < 1000; ++i)
+        futures[i] = wcore_executor_submit(executor, count, &s);
+
+    assert_true(wcore_executor_destroy(executor));
+    assert_int_equal(s.count, 1000);
+
+    // The futures outlive the executor.
+    for (int i = 0; i < 1000; ++i) {
+        assert_true(wcore_executor_future_is_ready(futures[i]));
+        assert_true(wcore_executor_future_wait(futures[i]));
+    }
+
+    mtx_destroy(&s.mutex);
+}
+
+int
+main(void) {
+    const struct CMUnitTest tests[] = {
+        #define unit_test_make(name) cmocka_unit_test_setup_teardown(name, setup, teardown)
+
+        unit_test_make(test_wcore_executor_bound),
+        unit_test_make(test_wcore_executor_bind_fails),
+        unit_test_make(test_wcore_executor_error),
+        unit_test_make(test_wcore_executor_steal),
+        unit_test_make(test_wcore_executor_destroy_drains),
+
+        #undef unit_test_make
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,179 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "wcore_error.h"
+#include "wcore_ext_set.h"
+#include "wcore_util.h"
+
+static struct wcore_ext_set_slot *
+find_slot(struct wcore_ext_set_slot *slots, size_t num_slots,
+          const char *name, size_t len)
+{
+    size_t mask = num_slots - 1;
+    size_t i = wcore_hash_string(name, len) & mask;
+
+    while (slots[i].name) {
+        if (slots[i].len == len && memcmp(slots[i].name, name, len) == 0)
+            break;
+
+        i = (i + 1) & mask;
+    }
+
+    return &slots[i];
+}
+
+static bool
+grow(struct wcore_ext_set *self, size_t min_count)
+{
+    size_t num_slots = self->num_slots ? self->num_slots : 64;
+    struct wcore_ext_set_slot *slots;
+    size_t size;
+
+    while (num_slots / 2 < min_count) {
+        if (!wcore_imul_size(&num_slots, 2)) {
+            wcore_error(WAFFLE_ERROR_BAD_ALLOC);
+            return false;
+        }
+    }
+
+    if (num_slots == self->num_slots)
+        return true;
+
+    if (!wcore_mul_size(&size, num_slots, sizeof(*slots))) {
+        wcore_error(WAFFLE_ERROR_BAD_ALLOC);
+        return false;
+    }
+
+    slots = wcore_calloc(size);
+    if (!slots)
+        return false;
+
+    for (size_t i = 0; i < self->num_slots; ++i) {
+        const struct wcore_ext_set_slot *old = &self->slots[i];
+        if (old->name)
+            *find_slot(slots, num_slots, old->name, old->len) = *old;
+    }
+
+    free(self->slots);
+    self->slots = slots;
+    self->num_slots = num_slots;
+    return true;
+}
+
+bool
+wcore_ext_set_add_string(struct wcore_ext_set *self,
+                         const char *extension_string)
+{
+    size_t num_names = 0;
+    char **strings;
+    char *copy;
+
+    if (!extension_string || !extension_string[0])
+        return true;
+
+    // Upper bound on the number of names. One more than the number of
+    // spaces.
+    for (const char *c = extension_string; *c; ++c) {
+        if (*c == ' ')
+            ++num_names;
+    }
+    ++num_names;
+
+    if (!grow(self, self->count + num_names))
+        return false;
+
+    copy = wcore_strdup(extension_string);
+    if (!copy)
+        return false;
+
+    strings = wcore_realloc(self->strings,
+                            (self->num_strings + 1) * sizeof(*strings));
+    if (!strings) {
+        free(copy);
+        return false;
+    }
+
+    self->strings = strings;
+    self->strings[self->num_strings++] = copy;
+
+    for (char *name = copy; *name; ) {
+        char *end = strchr(name, ' ');
+        struct wcore_ext_set_slot *slot;
+        size_t len;
+
+        if (end) {
+            *end = '\0';
+            len = end - name;
+        }
+        else {
+            len = strlen(name);
+        }
+
+        if (len > 0) {
+            slot = find_slot(self->slots, self->num_slots, name, len);
+            if (!slot->name) {
+                slot->name = name;
+                slot->len = len;
+                ++self->count;
+            }
+        }
+
+        if (!end)
+            break;
+
+        name = end + 1;
+    }
+
+    return true;
+}
+
+bool
+wcore_ext_set_has(const struct wcore_ext_set *self, const char *name)
+{
+    size_t len;
+
+    if (!name || self->count == 0)
+        return false;
+
+    len = strlen(name);
+    if (len == 0)
+        return false;
+
+    return find_slot(self->slots, self->num_slots, name, len)->name != NULL;
+}
+
+void
+wcore_ext_set_finish(struct wcore_ext_set *self)
+{
+    for (size_t i = 0; i < self->num_strings; ++i)
+        free(self->strings[i]);
+
+    free(self->strings);
+    free(self->slots);
+    memset(self, 0, sizeof(*self));
+}
@@ -0,0 +1,74 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct wcore_ext_set_slot {
+    const char *name;
+    size_t len;
+};
+
+/// @brief A set of extension names, hashed for constant-time lookup.
+///
+/// Each display parses its extension strings once, at connect time, instead
+/// of scanning them with waffle_is_extension_in_string() on each query.
+///
+/// A zero-filled struct is a valid, empty set.
+struct wcore_ext_set {
+    /// Open-addressed table of names that point into @a strings. Its size is
+    /// a power of two, and it is never more than half full.
+    struct wcore_ext_set_slot *slots;
+    size_t num_slots;
+    size_t count;
+
+    /// Owned copies of the parsed extension strings, in which the separating
+    /// spaces are replaced with '\0'.
+    char **strings;
+    size_t num_strings;
+};
+
+/// @brief Add each space-separated name in @a extension_string.
+///
+/// A null @a extension_string is treated as empty.
+bool
+wcore_ext_set_add_string(struct wcore_ext_set *self,
+                         const char *extension_string);
+
+bool
+wcore_ext_set_has(const struct wcore_ext_set *self, const char *name);
+
+void
+wcore_ext_set_finish(struct wcore_ext_set *self);
+
+#ifdef __cplusplus
+}
+#endif
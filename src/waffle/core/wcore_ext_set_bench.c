@@ -0,0 +1,190 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Compare waffle_is_extension_in_string() with wcore_ext_set_has() on
+// extension strings captured from Mesa, looking up the names that Waffle
+// itself queries at display connect.
+//
+// Usage: wcore_ext_set_bench [iterations]
+
+#define _POSIX_C_SOURCE 199309L // clock_gettime()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "waffle.h"
+#include "wcore_ext_set.h"
+
+// Mesa 23, EGL_NO_DISPLAY.
+static const char egl_client_extensions[] =
+    "EGL_EXT_device_base EGL_EXT_device_enumeration EGL_EXT_device_query "
+    "EGL_EXT_platform_base EGL_KHR_client_get_all_proc_addresses "
+    "EGL_EXT_client_extensions EGL_KHR_debug EGL_EXT_platform_device "
+    "EGL_EXT_platform_wayland EGL_KHR_platform_wayland EGL_EXT_platform_x11 "
+    "EGL_KHR_platform_x11 EGL_EXT_platform_xcb EGL_MESA_platform_gbm "
+    "EGL_KHR_platform_gbm EGL_MESA_platform_surfaceless";
+
+// Mesa 23, llvmpipe, EGL_PLATFORM_SURFACELESS_MESA.
+static const char egl_display_extensions[] =
+    "EGL_EXT_create_context_robustness EGL_KHR_cl_event2 "
+    "EGL_KHR_config_attribs EGL_KHR_context_flush_control "
+    "EGL_KHR_create_context EGL_KHR_create_context_no_error "
+    "EGL_KHR_fence_sync EGL_KHR_get_all_proc_addresses EGL_KHR_gl_colorspace "
+    "EGL_KHR_gl_renderbuffer_image EGL_KHR_gl_texture_2D_image "
+    "EGL_KHR_gl_texture_3D_image EGL_KHR_gl_texture_cubemap_image "
+    "EGL_KHR_image_base EGL_KHR_no_config_context EGL_KHR_reusable_sync "
+    "EGL_KHR_surfaceless_context EGL_EXT_pixel_format_float "
+    "EGL_KHR_wait_sync EGL_MESA_configless_context EGL_MESA_drm_image "
+    "EGL_MESA_query_driver ";
+
+// Mesa 23, glXQueryExtensionsString().
+static const char glx_extensions[] =
+    "GLX_ARB_context_flush_control GLX_ARB_create_context "
+    "GLX_ARB_create_context_no_error GLX_ARB_create_context_profile "
+    "GLX_ARB_create_context_robustness GLX_ARB_fbconfig_float "
+    "GLX_ARB_framebuffer_sRGB GLX_ARB_get_proc_address GLX_ARB_multisample "
+    "GLX_EXT_buffer_age GLX_EXT_create_context_es2_profile "
+    "GLX_EXT_create_context_es_profile GLX_EXT_fbconfig_packed_float "
+    "GLX_EXT_framebuffer_sRGB GLX_EXT_import_context "
+    "GLX_EXT_no_config_context GLX_EXT_swap_control "
+    "GLX_EXT_swap_control_tear GLX_EXT_texture_from_pixmap "
+    "GLX_EXT_visual_info GLX_EXT_visual_rating GLX_INTEL_swap_event "
+    "GLX_MESA_copy_sub_buffer GLX_MESA_query_renderer GLX_MESA_swap_control "
+    "GLX_OML_swap_method GLX_OML_sync_control GLX_SGIS_multisample "
+    "GLX_SGIX_fbconfig GLX_SGIX_pbuffer GLX_SGIX_visual_select_group "
+    "GLX_SGI_make_current_read GLX_SGI_swap_control GLX_SGI_video_sync";
+
+static const char *egl_names[] = {
+    "EGL_KHR_platform_gbm",
+    "EGL_KHR_platform_wayland",
+    "EGL_KHR_platform_x11",
+    "EGL_MESA_platform_surfaceless",
+    "EGL_EXT_create_context_robustness",
+    "EGL_KHR_create_context",
+    "EGL_EXT_image_dma_buf_import_modifiers",
+    NULL,
+};
+
+static const char *glx_names[] = {
+    "GLX_ARB_create_context",
+    "GLX_ARB_create_context_profile",
+    "GLX_ARB_create_context_robustness",
+    "GLX_EXT_create_context_es_profile",
+    "GLX_EXT_create_context_es2_profile",
+    "GLX_EXT_swap_control",
+    "GLX_EXT_swap_control_tear",
+    "GLX_MESA_swap_control",
+    NULL,
+};
+
+static double
+now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void
+bench(const char *label, const char *strings[], const char *names[],
+      long iterations)
+{
+    struct wcore_ext_set set = {0};
+    volatile unsigned hits = 0;
+    unsigned num_names = 0;
+    double t0, t1, t2, t3;
+
+    while (names[num_names])
+        ++num_names;
+
+    // The string scan reparses every string on each lookup, as Waffle did
+    // before the set was introduced.
+    t0 = now_ns();
+    for (long i = 0; i < iterations; ++i) {
+        for (unsigned n = 0; n < num_names; ++n) {
+            for (unsigned s = 0; strings[s]; ++s) {
+                if (waffle_is_extension_in_string(strings[s], names[n])) {
+                    ++hits;
+                    break;
+                }
+            }
+        }
+    }
+    t1 = now_ns();
+
+    // The set is built once per display connect; include that cost.
+    for (unsigned s = 0; strings[s]; ++s) {
+        if (!wcore_ext_set_add_string(&set, strings[s])) {
+            fprintf(stderr, "wcore_ext_set_add_string failed\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    t2 = now_ns();
+    for (long i = 0; i < iterations; ++i) {
+        for (unsigned n = 0; n < num_names; ++n)
+            hits += wcore_ext_set_has(&set, names[n]);
+    }
+    t3 = now_ns();
+
+    wcore_ext_set_finish(&set);
+
+    printf("%-4s %u names x %ld: "
+           "string scan %7.1f ns/lookup, "
+           "set %5.1f ns/lookup (build %.0f ns)\n",
+           label, num_names, iterations,
+           (t1 - t0) / (iterations * num_names),
+           (t3 - t2) / (iterations * num_names),
+           t2 - t1);
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *egl_strings[] = {
+        egl_display_extensions,
+        egl_client_extensions,
+        NULL,
+    };
+    const char *glx_strings[] = {
+        glx_extensions,
+        NULL,
+    };
+    long iterations = 100000;
+
+    if (argc > 1)
+        iterations = strtol(argv[1], NULL, 10);
+
+    if (iterations <= 0) {
+        fprintf(stderr, "usage: wcore_ext_set_bench [iterations]\n");
+        return EXIT_FAILURE;
+    }
+
+    bench("EGL", egl_strings, egl_names, iterations);
+    bench("GLX", glx_strings, glx_names, iterations);
+
+    return EXIT_SUCCESS;
+}
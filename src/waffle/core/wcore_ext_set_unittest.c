@@ -0,0 +1,151 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "wcore_ext_set.h"
+
+static void
+test_wcore_ext_set_empty(void **state) {
+    struct wcore_ext_set set = {0};
+
+    assert_false(wcore_ext_set_has(&set, "EGL_KHR_create_context"));
+    assert_false(wcore_ext_set_has(&set, ""));
+    assert_false(wcore_ext_set_has(&set, NULL));
+    wcore_ext_set_finish(&set);
+}
+
+static void
+test_wcore_ext_set_null_string(void **state) {
+    struct wcore_ext_set set = {0};
+
+    assert_true(wcore_ext_set_add_string(&set, NULL));
+    assert_true(wcore_ext_set_add_string(&set, ""));
+    assert_int_equal(set.count, 0);
+    wcore_ext_set_finish(&set);
+}
+
+static void
+test_wcore_ext_set_has(void **state) {
+    struct wcore_ext_set set = {0};
+
+    assert_true(wcore_ext_set_add_string(&set,
+        "EGL_KHR_create_context EGL_KHR_fence_sync EGL_KHR_wait_sync"));
+
+    assert_int_equal(set.count, 3);
+    assert_true(wcore_ext_set_has(&set, "EGL_KHR_create_context"));
+    assert_true(wcore_ext_set_has(&set, "EGL_KHR_fence_sync"));
+    assert_true(wcore_ext_set_has(&set, "EGL_KHR_wait_sync"));
+    assert_false(wcore_ext_set_has(&set, "EGL_KHR_image_base"));
+    wcore_ext_set_finish(&set);
+}
+
+static void
+test_wcore_ext_set_no_prefix_match(void **state) {
+    struct wcore_ext_set set = {0};
+
+    assert_true(wcore_ext_set_add_string(&set,
+        "GLX_EXT_swap_control_tear GLX_ARB_create_context_profile"));
+
+    assert_false(wcore_ext_set_has(&set, "GLX_EXT_swap_control"));
+    assert_false(wcore_ext_set_has(&set, "GLX_ARB_create_context"));
+    assert_false(wcore_ext_set_has(&set, "GLX_ARB_create_context_profile_x"));
+    assert_false(wcore_ext_set_has(&set, "GLX_EXT_swap_control_tear "));
+    wcore_ext_set_finish(&set);
+}
+
+static void
+test_wcore_ext_set_extra_spaces(void **state) {
+    struct wcore_ext_set set = {0};
+
+    // Mesa terminates EGL_EXTENSIONS with a space.
+    assert_true(wcore_ext_set_add_string(&set,
+        "  EGL_KHR_image_base   EGL_MESA_drm_image "));
+
+    assert_int_equal(set.count, 2);
+    assert_true(wcore_ext_set_has(&set, "EGL_KHR_image_base"));
+    assert_true(wcore_ext_set_has(&set, "EGL_MESA_drm_image"));
+    assert_false(wcore_ext_set_has(&set, ""));
+    wcore_ext_set_finish(&set);
+}
+
+static void
+test_wcore_ext_set_multiple_strings(void **state) {
+    struct wcore_ext_set set = {0};
+
+    assert_true(wcore_ext_set_add_string(&set,
+        "EGL_KHR_create_context EGL_KHR_image_base"));
+    assert_true(wcore_ext_set_add_string(&set,
+        "EGL_EXT_client_extensions EGL_KHR_create_context"));
+
+    // Duplicates are counted once.
+    assert_int_equal(set.count, 3);
+    assert_true(wcore_ext_set_has(&set, "EGL_KHR_image_base"));
+    assert_true(wcore_ext_set_has(&set, "EGL_EXT_client_extensions"));
+    wcore_ext_set_finish(&set);
+}
+
+static void
+test_wcore_ext_set_grow(void **state) {
+    struct wcore_ext_set set = {0};
+    char name[32];
+
+    // Add enough names, over several strings, to force rehashing.
+    for (int i = 0; i < 1000; ++i) {
+        snprintf(name, sizeof(name), "GL_TEST_ext_%d", i);
+        assert_true(wcore_ext_set_add_string(&set, name));
+    }
+
+    assert_int_equal(set.count, 1000);
+
+    for (int i = 0; i < 1000; ++i) {
+        snprintf(name, sizeof(name), "GL_TEST_ext_%d", i);
+        assert_true(wcore_ext_set_has(&set, name));
+    }
+
+    assert_false(wcore_ext_set_has(&set, "GL_TEST_ext_1000"));
+    wcore_ext_set_finish(&set);
+    assert_int_equal(set.count, 0);
+}
+
+int
+main(void) {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_wcore_ext_set_empty),
+        cmocka_unit_test(test_wcore_ext_set_null_string),
+        cmocka_unit_test(test_wcore_ext_set_has),
+        cmocka_unit_test(test_wcore_ext_set_no_prefix_match),
+        cmocka_unit_test(test_wcore_ext_set_extra_spaces),
+        cmocka_unit_test(test_wcore_ext_set_multiple_strings),
+        cmocka_unit_test(test_wcore_ext_set_grow),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
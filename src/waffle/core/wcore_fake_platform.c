@@ -0,0 +1,107 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "waffle.h"
+
+#include "wcore_context.h"
+#include "wcore_error.h"
+#include "wcore_fake_platform.h"
+
+static struct wcore_context*
+fake_context_create(struct wcore_platform *platform,
+                    struct wcore_config *config,
+                    struct wcore_context *share_ctx)
+{
+    struct wcore_fake_platform *self = wcore_fake_platform(platform);
+    struct wcore_context *ctx;
+
+    (void) share_ctx;
+
+    if (self->fail_silently)
+        return NULL;
+
+    if (self->create_error) {
+        wcore_errorf(self->create_error, "fake failure");
+        return NULL;
+    }
+
+    ctx = calloc(1, sizeof(*ctx));
+    if (!ctx)
+        return NULL;
+
+    wcore_context_init(ctx, config);
+
+    mtx_lock(&self->mutex);
+    ++self->num_created;
+    mtx_unlock(&self->mutex);
+    return ctx;
+}
+
+static bool
+fake_context_destroy(struct wcore_context *ctx)
+{
+    struct wcore_fake_platform *self =
+        wcore_fake_platform(ctx->display->platform);
+
+    mtx_lock(&self->mutex);
+    ++self->num_destroyed;
+    mtx_unlock(&self->mutex);
+    free(ctx);
+    return true;
+}
+
+struct wcore_fake_platform*
+wcore_fake_platform_create(void)
+{
+    struct wcore_fake_platform *self = calloc(1, sizeof(*self));
+
+    if (!self)
+        return NULL;
+
+    if (mtx_init(&self->mutex, mtx_plain) != thrd_success) {
+        free(self);
+        return NULL;
+    }
+
+    self->vtbl.context.create = fake_context_create;
+    self->vtbl.context.destroy = fake_context_destroy;
+
+    self->platform.vtbl = &self->vtbl;
+    self->display.platform = &self->platform;
+    self->config.display = &self->display;
+    self->config.refcount = 1;
+
+    wcore_error_reset();
+    return self;
+}
+
+void
+wcore_fake_platform_destroy(struct wcore_fake_platform *self)
+{
+    mtx_destroy(&self->mutex);
+    free(self);
+}
@@ -0,0 +1,70 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+
+#include "threads.h"
+
+#include "wcore_config.h"
+#include "wcore_display.h"
+#include "wcore_platform.h"
+#include "wcore_util.h"
+
+/// @brief A platform without a native layer, shared by the unit tests.
+///
+/// Its contexts are bare wcore_contexts, counted in @a num_created and
+/// @a num_destroyed. A test adds the hooks it needs to @a vtbl before it
+/// uses the platform.
+struct wcore_fake_platform {
+    struct wcore_platform platform;
+    struct wcore_platform_vtbl vtbl;
+    struct wcore_display display;
+    struct wcore_config config;
+
+    /// Guards the counts, as some tests create contexts on several threads.
+    mtx_t mutex;
+    int num_created;
+    int num_destroyed;
+
+    /// If nonzero, context creation fails with this error.
+    enum waffle_error create_error;
+
+    /// If set, context creation fails without an error.
+    bool fail_silently;
+};
+
+DEFINE_CONTAINER_CAST_FUNC(wcore_fake_platform,
+                           struct wcore_fake_platform,
+                           struct wcore_platform,
+                           platform)
+
+/// Also reset the calling thread's error state.
+struct wcore_fake_platform*
+wcore_fake_platform_create(void);
+
+void
+wcore_fake_platform_destroy(struct wcore_fake_platform *self);
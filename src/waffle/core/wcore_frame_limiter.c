@@ -0,0 +1,119 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "wcore_error.h"
+#include "wcore_fence.h"
+#include "wcore_frame_limiter.h"
+#include "wcore_platform.h"
+
+struct wcore_frame_limiter*
+wcore_frame_limiter_create(struct wcore_platform *platform,
+                           int32_t max_frames)
+{
+    struct wcore_frame_limiter *self;
+
+    assert(max_frames > 0);
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    self->fences = wcore_calloc(max_frames * sizeof(self->fences[0]));
+    if (!self->fences) {
+        free(self);
+        return NULL;
+    }
+
+    self->platform = platform;
+    self->max_frames = max_frames;
+    return self;
+}
+
+/// Destroy the @a n oldest fences.
+static bool
+drop_fences(struct wcore_frame_limiter *self, int32_t n)
+{
+    bool ok = true;
+
+    for (int32_t i = 0; i < n; ++i) {
+        ok &= self->platform->vtbl->fence.destroy(self->fences[self->head]);
+        self->fences[self->head] = NULL;
+        self->head = (self->head + 1) % self->max_frames;
+        self->count--;
+    }
+
+    return ok;
+}
+
+bool
+wcore_frame_limiter_destroy(struct wcore_frame_limiter *self)
+{
+    bool ok = true;
+
+    if (!self)
+        return true;
+
+    ok &= drop_fences(self, self->count);
+    free(self->fences);
+    free(self);
+    return ok;
+}
+
+bool
+wcore_frame_limiter_end_frame(struct wcore_frame_limiter *self,
+                              struct wcore_display *display,
+                              struct wcore_context *ctx)
+{
+    const struct wcore_fence_vtbl *vtbl = &self->platform->vtbl->fence;
+    struct wcore_fence *fence;
+
+    if (self->count > 0 && self->fences[self->head]->context != ctx) {
+        if (!drop_fences(self, self->count))
+            return false;
+    }
+
+    if (self->count == self->max_frames) {
+        bool signaled = false;
+
+        while (!signaled) {
+            if (!vtbl->client_wait(self->fences[self->head], UINT64_MAX,
+                                   &signaled))
+                return false;
+        }
+
+        if (!drop_fences(self, 1))
+            return false;
+    }
+
+    fence = vtbl->create(self->platform, display, ctx);
+    if (!fence)
+        return false;
+
+    self->fences[(self->head + self->count) % self->max_frames] = fence;
+    self->count++;
+    return true;
+}
@@ -0,0 +1,76 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct wcore_context;
+struct wcore_display;
+struct wcore_fence;
+struct wcore_platform;
+
+/// @brief Bounds the frames of a window that the GPU has yet to finish.
+///
+/// Used by windows created with WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT. Each
+/// swap first ends its frame with a fence, after waiting for the fence that
+/// ended the frame @a max_frames swaps earlier.
+struct wcore_frame_limiter {
+    struct wcore_platform *platform;
+    int32_t max_frames;
+
+    /// A ring of the fences of the last frames, oldest at @a head. They
+    /// all belong to the same context.
+    struct wcore_fence **fences;
+    int32_t head;
+    int32_t count;
+};
+
+struct wcore_frame_limiter*
+wcore_frame_limiter_create(struct wcore_platform *platform,
+                           int32_t max_frames);
+
+bool
+wcore_frame_limiter_destroy(struct wcore_frame_limiter *self);
+
+/// @brief End a frame rendered by @a ctx, which must be current to the
+/// calling thread.
+///
+/// Block until at most @a max_frames - 1 earlier frames are unfinished,
+/// then fence the new one. Fences left by another context are dropped,
+/// because they do not order the new frame.
+bool
+wcore_frame_limiter_end_frame(struct wcore_frame_limiter *self,
+                              struct wcore_display *display,
+                              struct wcore_context *ctx);
+
+#ifdef __cplusplus
+}
+#endif
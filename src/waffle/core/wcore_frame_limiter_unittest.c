@@ -0,0 +1,254 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <cmocka.h>
+
+#include "waffle.h"
+
+#include "wcore_context.h"
+#include "wcore_display.h"
+#include "wcore_error.h"
+#include "wcore_fake_platform.h"
+#include "wcore_fence.h"
+#include "wcore_frame_limiter.h"
+#include "wcore_platform.h"
+
+struct fake_fence {
+    struct wcore_fence wcore;
+    int id;
+};
+
+static int num_created;
+static int num_live;
+static int last_waited;
+static int num_timeouts;
+static bool fail_create;
+
+static struct wcore_fence*
+fake_fence_create(struct wcore_platform *platform,
+                  struct wcore_display *display,
+                  struct wcore_context *ctx)
+{
+    struct fake_fence *fence;
+
+    if (fail_create) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ALLOC, "fake fence failure");
+        return NULL;
+    }
+
+    fence = calloc(1, sizeof(*fence));
+    wcore_fence_init(&fence->wcore, display, ctx);
+    fence->id = num_created++;
+    ++num_live;
+    return &fence->wcore;
+}
+
+static bool
+fake_fence_destroy(struct wcore_fence *fence)
+{
+    --num_live;
+    free(fence);
+    return true;
+}
+
+static bool
+fake_fence_client_wait(struct wcore_fence *fence,
+                       uint64_t timeout,
+                       bool *signaled)
+{
+    // Time out once per wait, to check that the limiter waits again.
+    if (num_timeouts++ % 2 == 0) {
+        *signaled = false;
+        return true;
+    }
+
+    last_waited = ((struct fake_fence *) fence)->id;
+    *signaled = true;
+    return true;
+}
+
+struct test_state {
+    struct wcore_fake_platform *fake;
+    struct wcore_context ctx[2];
+};
+
+static int
+setup(void **state) {
+    struct test_state *ts = calloc(1, sizeof(*ts));
+
+    if (!ts)
+        return -1;
+
+    ts->fake = wcore_fake_platform_create();
+    if (!ts->fake) {
+        free(ts);
+        return -1;
+    }
+
+    ts->fake->vtbl.fence.create = fake_fence_create;
+    ts->fake->vtbl.fence.destroy = fake_fence_destroy;
+    ts->fake->vtbl.fence.client_wait = fake_fence_client_wait;
+
+    num_created = 0;
+    num_live = 0;
+    last_waited = -1;
+    num_timeouts = 0;
+    fail_create = false;
+    *state = ts;
+    return 0;
+}
+
+static int
+teardown(void **state) {
+    struct test_state *ts = *state;
+
+    wcore_fake_platform_destroy(ts->fake);
+    free(ts);
+    return 0;
+}
+
+static void
+test_wcore_frame_limiter_waits(void **state) {
+    struct test_state *ts = *state;
+    struct wcore_frame_limiter *limiter;
+
+    limiter = wcore_frame_limiter_create(&ts->fake->platform, 2);
+    assert_non_null(limiter);
+
+    // The first frames fill the ring without waiting.
+    assert_true(wcore_frame_limiter_end_frame(limiter, &ts->fake->display,
+                                              &ts->ctx[0]));
+    assert_true(wcore_frame_limiter_end_frame(limiter, &ts->fake->display,
+                                              &ts->ctx[0]));
+    assert_int_equal(last_waited, -1);
+    assert_int_equal(num_live, 2);
+
+    // Then each frame waits for the one two frames back.
+    for (int i = 2; i < 10; ++i) {
+        assert_true(wcore_frame_limiter_end_frame(limiter, &ts->fake->display,
+                                                  &ts->ctx[0]));
+        assert_int_equal(last_waited, i - 2);
+        assert_int_equal(num_live, 2);
+    }
+
+    assert_true(wcore_frame_limiter_destroy(limiter));
+    assert_int_equal(num_live, 0);
+}
+
+static void
+test_wcore_frame_limiter_one_frame(void **state) {
+    struct test_state *ts = *state;
+    struct wcore_frame_limiter *limiter;
+
+    limiter = wcore_frame_limiter_create(&ts->fake->platform, 1);
+    assert_non_null(limiter);
+
+    for (int i = 0; i < 5; ++i) {
+        assert_true(wcore_frame_limiter_end_frame(limiter, &ts->fake->display,
+                                                  &ts->ctx[0]));
+        assert_int_equal(last_waited, i - 1);
+        assert_int_equal(num_live, 1);
+    }
+
+    assert_true(wcore_frame_limiter_destroy(limiter));
+    assert_int_equal(num_live, 0);
+}
+
+static void
+test_wcore_frame_limiter_context_change(void **state) {
+    struct test_state *ts = *state;
+    struct wcore_frame_limiter *limiter;
+
+    limiter = wcore_frame_limiter_create(&ts->fake->platform, 2);
+    assert_non_null(limiter);
+
+    for (int i = 0; i < 3; ++i)
+        assert_true(wcore_frame_limiter_end_frame(limiter, &ts->fake->display,
+                                                  &ts->ctx[0]));
+    assert_int_equal(last_waited, 0);
+
+    // The other context's fences are dropped, not waited for.
+    assert_true(wcore_frame_limiter_end_frame(limiter, &ts->fake->display,
+                                              &ts->ctx[1]));
+    assert_int_equal(last_waited, 0);
+    assert_int_equal(num_live, 1);
+
+    assert_true(wcore_frame_limiter_end_frame(limiter, &ts->fake->display,
+                                              &ts->ctx[1]));
+    assert_true(wcore_frame_limiter_end_frame(limiter, &ts->fake->display,
+                                              &ts->ctx[1]));
+    assert_int_equal(last_waited, 3);
+
+    assert_true(wcore_frame_limiter_destroy(limiter));
+    assert_int_equal(num_live, 0);
+}
+
+static void
+test_wcore_frame_limiter_create_fails(void **state) {
+    struct test_state *ts = *state;
+    struct wcore_frame_limiter *limiter;
+
+    limiter = wcore_frame_limiter_create(&ts->fake->platform, 2);
+    assert_non_null(limiter);
+
+    fail_create = true;
+    assert_false(wcore_frame_limiter_end_frame(limiter, &ts->fake->display,
+                                               &ts->ctx[0]));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ALLOC);
+    assert_int_equal(num_live, 0);
+
+    // A later frame starts over.
+    wcore_error_reset();
+    fail_create = false;
+    assert_true(wcore_frame_limiter_end_frame(limiter, &ts->fake->display,
+                                              &ts->ctx[0]));
+    assert_int_equal(num_live, 1);
+
+    assert_true(wcore_frame_limiter_destroy(limiter));
+    assert_int_equal(num_live, 0);
+}
+
+int
+main(void) {
+    const struct CMUnitTest tests[] = {
+        #define unit_test_make(name) cmocka_unit_test_setup_teardown(name, setup, teardown)
+
+        unit_test_make(test_wcore_frame_limiter_waits),
+        unit_test_make(test_wcore_frame_limiter_one_frame),
+        unit_test_make(test_wcore_frame_limiter_context_change),
+        unit_test_make(test_wcore_frame_limiter_create_fails),
+
+        #undef unit_test_make
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
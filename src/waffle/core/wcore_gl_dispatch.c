@@ -0,0 +1,112 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "wcore_context.h"
+#include "wcore_display.h"
+#include "wcore_error.h"
+#include "wcore_gl_dispatch.h"
+#include "wcore_platform.h"
+#include "wcore_util.h"
+
+static const char *const entry_point_names[] = {
+#define NAME(name) "gl" #name,
+    WAFFLE_GL_DISPATCH_ENTRY_POINTS(NAME)
+#undef NAME
+};
+
+enum {
+    NUM_ENTRY_POINTS = sizeof(entry_point_names) / sizeof(entry_point_names[0]),
+};
+
+static int32_t
+wcore_gl_dispatch_get_dl(int32_t context_api)
+{
+    switch (context_api) {
+        case WAFFLE_CONTEXT_OPENGL:     return WAFFLE_DL_OPENGL;
+        case WAFFLE_CONTEXT_OPENGL_ES1: return WAFFLE_DL_OPENGL_ES1;
+        case WAFFLE_CONTEXT_OPENGL_ES2: return WAFFLE_DL_OPENGL_ES2;
+        case WAFFLE_CONTEXT_OPENGL_ES3: return WAFFLE_DL_OPENGL_ES3;
+        default:
+            assert(false);
+            return 0;
+    }
+}
+
+struct waffle_gl_dispatch*
+wcore_gl_dispatch_create(struct wcore_platform *platform,
+                         struct wcore_context *ctx)
+{
+    struct waffle_gl_dispatch *self;
+    const char *missing_names[NUM_ENTRY_POINTS];
+    void *missing_syms[NUM_ENTRY_POINTS];
+    void *syms[NUM_ENTRY_POINTS] = { NULL };
+    size_t num_missing = 0;
+    size_t i;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    // Where get_proc_address() is not guaranteed to return core functions
+    // (EGL 1.4 without EGL_KHR_get_all_proc_addresses, WGL, CGL), query the
+    // context API's library first, as the GL ABIs only promise the core
+    // entry points there. Missing symbols are expected, so discard the
+    // errors that dl_sym() emits for them.
+    if (!ctx->display->proc_address_includes_core) {
+        int32_t dl = wcore_gl_dispatch_get_dl(ctx->context_api);
+
+        if (platform->vtbl->dl_can_open(platform, dl))
+            wcore_platform_sym_batch(platform, dl, NUM_ENTRY_POINTS,
+                                     entry_point_names, syms);
+
+        wcore_error_reset();
+    }
+
+    for (i = 0; i < NUM_ENTRY_POINTS; ++i) {
+        if (!syms[i])
+            missing_names[num_missing++] = entry_point_names[i];
+    }
+
+    if (num_missing > 0) {
+        wcore_platform_sym_batch(platform, WCORE_SYM_CACHE_PROC_ADDRESS,
+                                 num_missing, missing_names, missing_syms);
+
+        num_missing = 0;
+        for (i = 0; i < NUM_ENTRY_POINTS; ++i) {
+            if (!syms[i])
+                syms[i] = missing_syms[num_missing++];
+        }
+    }
+
+    i = 0;
+#define ASSIGN(name) self->name = syms[i++];
+    WAFFLE_GL_DISPATCH_ENTRY_POINTS(ASSIGN)
+#undef ASSIGN
+
+    return self;
+}
@@ -0,0 +1,138 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "wcore_error.h"
+#include "wcore_platform.h"
+
+bool
+wcore_platform_init(struct wcore_platform *self)
+{
+    assert(self);
+
+    if (mtx_init(&self->sym_cache_mutex, mtx_plain) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "mtx_init failed");
+        return false;
+    }
+
+    if (!wcore_worker_init(&self->worker)) {
+        mtx_destroy(&self->sym_cache_mutex);
+        return false;
+    }
+
+    return true;
+}
+
+bool
+wcore_platform_teardown(struct wcore_platform *self)
+{
+    assert(self);
+
+    wcore_sym_cache_finish(&self->sym_cache);
+    mtx_destroy(&self->sym_cache_mutex);
+    wcore_worker_teardown(&self->worker);
+    free(self->caps_cache_path);
+    return true;
+}
+
+static void*
+wcore_platform_resolve(struct wcore_platform *self,
+                       int32_t dl,
+                       const char *name)
+{
+    if (dl == WCORE_SYM_CACHE_PROC_ADDRESS)
+        return self->vtbl->get_proc_address(self, name);
+    else
+        return self->vtbl->dl_sym(self, dl, name);
+}
+
+bool
+wcore_platform_sym_batch(struct wcore_platform *self,
+                         int32_t dl,
+                         size_t count,
+                         const char *const names[],
+                         void *syms[])
+{
+    bool use_cache = dl != WCORE_SYM_CACHE_PROC_ADDRESS ||
+                     !self->proc_address_is_context_dependent;
+    size_t num_missing = count;
+    bool ok = true;
+
+    if (use_cache) {
+        num_missing = 0;
+
+        mtx_lock(&self->sym_cache_mutex);
+        for (size_t i = 0; i < count; ++i) {
+            syms[i] = wcore_sym_cache_lookup(&self->sym_cache, dl, names[i]);
+            if (!syms[i])
+                ++num_missing;
+        }
+        mtx_unlock(&self->sym_cache_mutex);
+
+        if (num_missing == 0)
+            return true;
+    }
+    else {
+        for (size_t i = 0; i < count; ++i)
+            syms[i] = NULL;
+    }
+
+    // Resolve outside the lock; dlsym() and eglGetProcAddress() are slow
+    // and thread-safe. Keep the first failure's error.
+    for (size_t i = 0; i < count; ++i) {
+        if (syms[i])
+            continue;
+
+        if (ok) {
+            syms[i] = wcore_platform_resolve(self, dl, names[i]);
+        }
+        else {
+            WCORE_ERROR_DISABLED({
+                syms[i] = wcore_platform_resolve(self, dl, names[i]);
+            });
+        }
+
+        if (!syms[i] && dl != WCORE_SYM_CACHE_PROC_ADDRESS)
+            ok = false;
+    }
+
+    if (!use_cache)
+        return ok;
+
+    // The cache is only an optimization, so failing to grow it is not an
+    // error. Entries found in the first pass are skipped by insert.
+    mtx_lock(&self->sym_cache_mutex);
+    WCORE_ERROR_DISABLED({
+        for (size_t i = 0; i < count; ++i) {
+            if (syms[i])
+                wcore_sym_cache_insert(&self->sym_cache, dl, names[i], syms[i]);
+        }
+    });
+    mtx_unlock(&self->sym_cache_mutex);
+
+    return ok;
+}
@@ -29,11 +29,16 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "c99_compat.h"
+#include "threads.h"
+
+#include "wcore_sym_cache.h"
+#include "wcore_worker.h"
 
 struct wcore_config;
 struct wcore_config_attrs;
 struct wcore_context;
 struct wcore_display;
+struct wcore_fence;
 struct wcore_platform;
 struct wcore_window;
 
@@ -48,6 +53,17 @@ struct wcore_platform_vtbl {
             struct wcore_window *window,
             struct wcore_context *ctx);
 
+    /// @brief Ask the native API if the triple is current.
+    ///
+    /// Used by WAFFLE_VALIDATE_MAKE_CURRENT to detect bindings changed
+    /// behind waffle's back. May be null.
+    bool
+    (*is_current)(
+            struct wcore_platform *self,
+            struct wcore_display *dpy,
+            struct wcore_window *window,
+            struct wcore_context *ctx);
+
     void*
     (*get_proc_address)(
             struct wcore_platform *self,
@@ -77,6 +93,18 @@ struct wcore_platform_vtbl {
                 struct wcore_display *display,
                 int32_t context_api);
 
+        /// May be null.
+        bool
+        (*query)(struct wcore_display *display,
+                 int32_t attrib,
+                 intptr_t *value);
+
+        /// May be null. Answers WAFFLE_RENDERER_* without a context.
+        bool
+        (*query_renderer)(struct wcore_display *display,
+                          int32_t attrib,
+                          intptr_t *value);
+
         /// May be null.
         union waffle_native_display*
         (*get_native)(struct wcore_display *display);
@@ -91,6 +119,25 @@ struct wcore_platform_vtbl {
         bool
         (*destroy)(struct wcore_config *config);
 
+        /// May be null.
+        ///
+        /// Create up to @a max_configs configs, best first, in @a configs,
+        /// and set @a num_configs to the number created. If @a configs is
+        /// null, instead set @a num_configs to the number that match.
+        bool
+        (*enumerate)(struct wcore_platform *platform,
+                     struct wcore_display *display,
+                     const struct wcore_config_attrs *attrs,
+                     struct wcore_config *configs[],
+                     int32_t max_configs,
+                     int32_t *num_configs);
+
+        /// May be null.
+        bool
+        (*query)(struct wcore_config *config,
+                 int32_t attrib,
+                 intptr_t *value);
+
         /// May be null.
         union waffle_native_config*
         (*get_native)(struct wcore_config *config);
@@ -105,6 +152,12 @@ struct wcore_platform_vtbl {
         bool
         (*destroy)(struct wcore_context *ctx);
 
+        /// May be null.
+        bool
+        (*query)(struct wcore_context *ctx,
+                 int32_t attrib,
+                 intptr_t *value);
+
         /// May be null.
         union waffle_native_context*
         (*get_native)(struct wcore_context *ctx);
@@ -131,29 +184,160 @@ struct wcore_platform_vtbl {
                   int32_t height,
                   int32_t width);
 
+        /// May be null.
+        bool
+        (*set_swap_interval)(struct wcore_window *window,
+                             int32_t interval);
+
+        /// May be null.
+        bool
+        (*query)(struct wcore_window *window,
+                 int32_t attrib,
+                 intptr_t *value);
+
+        /// May be null. Each rect is {x, y, width, height}, with the origin
+        /// at the lower left corner of the window.
+        bool
+        (*swap_buffers_with_damage)(struct wcore_window *window,
+                                    const int32_t *rects,
+                                    int32_t n_rects);
+
+        /// May be null.
+        bool
+        (*get_buffer_age)(struct wcore_window *window,
+                          int32_t *age);
+
+        /// May be null. The rects are laid out as for
+        /// swap_buffers_with_damage.
+        bool
+        (*set_damage_region)(struct wcore_window *window,
+                             const int32_t *rects,
+                             int32_t n_rects);
+
         /// May be null.
         union waffle_native_window*
         (*get_native)(struct wcore_window *window);
     } window;
+
+    /// May be null, if the platform has no fences.
+    struct wcore_fence_vtbl {
+        /// Insert a fence after the commands issued so far to @a ctx, which
+        /// must be current to the calling thread.
+        struct wcore_fence*
+        (*create)(struct wcore_platform *platform,
+                  struct wcore_display *display,
+                  struct wcore_context *ctx);
+
+        /// May be null, if export_fd is. As create(), but the fence can
+        /// be exported if the display allows it. Such fences hold a file
+        /// descriptor, so only the application's fences are exportable.
+        struct wcore_fence*
+        (*create_exportable)(struct wcore_platform *platform,
+                             struct wcore_display *display,
+                             struct wcore_context *ctx);
+
+        bool
+        (*destroy)(struct wcore_fence *fence);
+
+        /// May be null. Emit an error and return false if @a display
+        /// cannot create fences in any context.
+        bool
+        (*check_display)(struct wcore_platform *platform,
+                         struct wcore_display *display);
+
+        /// May be null. Emit an error and return false if @a ctx, which
+        /// is current to the calling thread, cannot create fences.
+        bool
+        (*check_context)(struct wcore_platform *platform,
+                         struct wcore_context *ctx);
+
+        /// Flush the fence's context, then block until the fence is
+        /// signaled or @a timeout nanoseconds pass, and set @a signaled
+        /// accordingly. UINT64_MAX waits forever.
+        bool
+        (*client_wait)(struct wcore_fence *fence,
+                       uint64_t timeout,
+                       bool *signaled);
+
+        /// Make the GPU wait for the fence before running the commands
+        /// issued after this call to the context current to the calling
+        /// thread. Does not block the thread.
+        bool
+        (*server_wait)(struct wcore_fence *fence);
+
+        /// May be null. Flush the fence's context if it is current, and set
+        /// @a fd to a new file descriptor for the fence, owned by the
+        /// caller.
+        bool
+        (*export_fd)(struct wcore_fence *fence, int *fd);
+
+        /// May be null. Create a fence from the file descriptor @a fd for
+        /// @a ctx, which must be current to the calling thread. On success
+        /// the fence owns @a fd.
+        struct wcore_fence*
+        (*import_fd)(struct wcore_platform *platform,
+                     struct wcore_display *display,
+                     struct wcore_context *ctx,
+                     int fd);
+    } fence;
 };
 
 struct wcore_platform {
     const struct wcore_platform_vtbl *vtbl;
     enum waffle_enum waffle_platform; // WAFFLE_PLATFORM_*
+
+    /// If set, waffle_make_current() elides a redundant call only after
+    /// vtbl->is_current() confirms the native binding.
+    bool validate_make_current;
+
+    /// If set, waffle_make_current() fills each context's
+    /// struct waffle_gl_dispatch the first time it is made current.
+    bool gl_dispatch;
+
+    /// The capability cache file if WAFFLE_CAPABILITY_CACHE is enabled, or
+    /// null.
+    char *caps_cache_path;
+
+    /// Set by platforms whose get_proc_address() may return different
+    /// pointers for different current contexts, such as WGL. Those results
+    /// are not cached.
+    bool proc_address_is_context_dependent;
+
+    /// Set by platforms whose native display must not be used by two
+    /// threads at once, such as GLX with its shared Xlib Display and
+    /// process-wide X error handler. Waffle then starts no threads of its
+    /// own that call into the platform.
+    bool native_display_is_single_threaded;
+
+    /// Symbols resolved by wcore_platform_sym_batch(), guarded by
+    /// @a sym_cache_mutex because the API is callable from any thread.
+    struct wcore_sym_cache sym_cache;
+    mtx_t sym_cache_mutex;
+
+    /// Creates the contexts of waffle_context_create_async(). Stopped by
+    /// waffle_teardown() before the platform is destroyed, because its jobs
+    /// call into the platform.
+    struct wcore_worker worker;
 };
 
-static inline bool
-wcore_platform_init(struct wcore_platform *self)
-{
-    (void) self;
-    assert(self);
-    return true;
-}
-
-static inline bool
-wcore_platform_teardown(struct wcore_platform *self)
-{
-    (void) self;
-    assert(self);
-    return true;
-}
+bool
+wcore_platform_init(struct wcore_platform *self);
+
+bool
+wcore_platform_teardown(struct wcore_platform *self);
+
+/// @brief Resolve @a count symbols with vtbl->dl_sym(), or with
+/// vtbl->get_proc_address() if @a dl is WCORE_SYM_CACHE_PROC_ADDRESS.
+///
+/// Symbols found in the platform's cache skip the native lookup, and newly
+/// resolved ones are added to it. Unresolved entries of @a syms are null.
+///
+/// Return false if a WAFFLE_DL_* symbol was not found, in which case the
+/// error state describes the first failure. A null result from
+/// get_proc_address() is not an error.
+bool
+wcore_platform_sym_batch(struct wcore_platform *self,
+                         int32_t dl,
+                         size_t count,
+                         const char *const names[],
+                         void *syms[]);
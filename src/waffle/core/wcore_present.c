@@ -0,0 +1,673 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "waffle_gl_dispatch.h"
+
+#include "wcore_config.h"
+#include "wcore_context.h"
+#include "wcore_display.h"
+#include "wcore_error.h"
+#include "wcore_gl_dispatch.h"
+#include "wcore_platform.h"
+#include "wcore_present.h"
+#include "wcore_tinfo.h"
+#include "wcore_window.h"
+
+#ifndef _WIN32
+#define APIENTRY
+#else
+#ifndef APIENTRY
+#define APIENTRY __stdcall
+#endif
+#endif
+
+typedef unsigned int GLenum;
+typedef unsigned int GLbitfield;
+typedef unsigned int GLuint;
+typedef int GLint;
+typedef int GLsizei;
+typedef uint64_t GLuint64;
+typedef void *GLsync;
+
+enum {
+    // Copied from <GL/glcorearb.h>.
+    GL_MAJOR_VERSION                    = 0x821B,
+    GL_MINOR_VERSION                    = 0x821C,
+    GL_COLOR_BUFFER_BIT                 = 0x00004000,
+    GL_NEAREST                          = 0x2600,
+    GL_RGB8                             = 0x8051,
+    GL_RGBA8                            = 0x8058,
+    GL_DEPTH24_STENCIL8                 = 0x88F0,
+    GL_FRAMEBUFFER                      = 0x8D40,
+    GL_READ_FRAMEBUFFER                 = 0x8CA8,
+    GL_DRAW_FRAMEBUFFER                 = 0x8CA9,
+    GL_READ_FRAMEBUFFER_BINDING         = 0x8CAA,
+    GL_DRAW_FRAMEBUFFER_BINDING         = 0x8CA6,
+    GL_RENDERBUFFER                     = 0x8D41,
+    GL_RENDERBUFFER_BINDING             = 0x8CA7,
+    GL_COLOR_ATTACHMENT0                = 0x8CE0,
+    GL_DEPTH_STENCIL_ATTACHMENT         = 0x821A,
+    GL_SYNC_GPU_COMMANDS_COMPLETE       = 0x9117,
+};
+
+#define GL_TIMEOUT_IGNORED 0xFFFFFFFFFFFFFFFFull
+
+// The entry points used here, cast from the dispatch table.
+#define GL(gl, name, ret, params) ((ret (APIENTRY *) params) (gl)->name)
+
+#define glBindFramebuffer(gl, target, fbo) \
+    GL(gl, BindFramebuffer, void, (GLenum, GLuint))(target, fbo)
+#define glBindRenderbuffer(gl, target, rb) \
+    GL(gl, BindRenderbuffer, void, (GLenum, GLuint))(target, rb)
+#define glBlitFramebuffer(gl, w0, h0, w1, h1) \
+    GL(gl, BlitFramebuffer, void, \
+       (GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, \
+        GLbitfield, GLenum)) \
+      (0, 0, w0, h0, 0, 0, w1, h1, GL_COLOR_BUFFER_BIT, GL_NEAREST)
+#define glDeleteFramebuffers(gl, n, fbos) \
+    GL(gl, DeleteFramebuffers, void, (GLsizei, const GLuint *))(n, fbos)
+#define glDeleteRenderbuffers(gl, n, rbs) \
+    GL(gl, DeleteRenderbuffers, void, (GLsizei, const GLuint *))(n, rbs)
+#define glDeleteSync(gl, sync) \
+    GL(gl, DeleteSync, void, (GLsync))(sync)
+#define glFenceSync(gl) \
+    GL(gl, FenceSync, GLsync, (GLenum, GLbitfield)) \
+      (GL_SYNC_GPU_COMMANDS_COMPLETE, 0)
+#define glFlush(gl) \
+    GL(gl, Flush, void, (void))()
+#define glFramebufferRenderbuffer(gl, target, attachment, rb) \
+    GL(gl, FramebufferRenderbuffer, void, (GLenum, GLenum, GLenum, GLuint)) \
+      (target, attachment, GL_RENDERBUFFER, rb)
+#define glGenFramebuffers(gl, n, fbos) \
+    GL(gl, GenFramebuffers, void, (GLsizei, GLuint *))(n, fbos)
+#define glGenRenderbuffers(gl, n, rbs) \
+    GL(gl, GenRenderbuffers, void, (GLsizei, GLuint *))(n, rbs)
+#define glGetIntegerv(gl, pname, value) \
+    GL(gl, GetIntegerv, void, (GLenum, GLint *))(pname, value)
+#define glRenderbufferStorageMultisample(gl, samples, format, w, h) \
+    GL(gl, RenderbufferStorageMultisample, void, \
+       (GLenum, GLsizei, GLenum, GLsizei, GLsizei)) \
+      (GL_RENDERBUFFER, samples, format, w, h)
+#define glScissor(gl, w, h) \
+    GL(gl, Scissor, void, (GLint, GLint, GLsizei, GLsizei))(0, 0, w, h)
+#define glViewport(gl, w, h) \
+    GL(gl, Viewport, void, (GLint, GLint, GLsizei, GLsizei))(0, 0, w, h)
+#define glWaitSync(gl, sync) \
+    GL(gl, WaitSync, void, (GLsync, GLbitfield, GLuint64)) \
+      (sync, 0, GL_TIMEOUT_IGNORED)
+
+static void
+capture_error(struct wcore_present *self)
+{
+    const struct waffle_error_info *info = wcore_error_get_info();
+
+    if (self->error_code != WAFFLE_NO_ERROR)
+        return;
+
+    self->error_code = info->code != WAFFLE_NO_ERROR
+                           ? info->code : WAFFLE_ERROR_UNKNOWN;
+    if (info->message_length > 0)
+        self->error_message = wcore_strdup(info->message);
+}
+
+/// Move the present thread's first failure to the calling thread.
+static bool
+take_error(struct wcore_present *self)
+{
+    int32_t code;
+    char *message;
+
+    mtx_lock(&self->mutex);
+    code = self->error_code;
+    message = self->error_message;
+    self->error_code = WAFFLE_NO_ERROR;
+    self->error_message = NULL;
+    mtx_unlock(&self->mutex);
+
+    if (code == WAFFLE_NO_ERROR)
+        return true;
+
+    if (message)
+        wcore_errorf(code, "%s", message);
+    else
+        wcore_error(code);
+
+    free(message);
+    return false;
+}
+
+static bool
+check_version(struct wcore_present *self)
+{
+    struct waffle_gl_dispatch *gl = self->gl;
+    GLint major = 0, minor = 0;
+    bool ok;
+
+    // Both queries fail on versions that predate them, leaving zero.
+    glGetIntegerv(gl, GL_MAJOR_VERSION, &major);
+    glGetIntegerv(gl, GL_MINOR_VERSION, &minor);
+
+    if (self->ctx->context_api == WAFFLE_CONTEXT_OPENGL)
+        ok = major > 3 || (major == 3 && minor >= 2);
+    else
+        ok = major >= 3;
+
+    if (!ok) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "WAFFLE_WINDOW_ASYNC_PRESENT requires OpenGL 3.2 or "
+                     "OpenGL ES 3.0");
+    }
+
+    return ok;
+}
+
+/// Give @a rb storage of the window's size. The render context must be
+/// current. Multisampled configs are rejected at window creation, so the
+/// storage is single-sampled.
+static void
+alloc_storage(struct wcore_present *self, GLuint rb, GLenum format)
+{
+    struct waffle_gl_dispatch *gl = self->gl;
+    GLint saved;
+
+    glGetIntegerv(gl, GL_RENDERBUFFER_BINDING, &saved);
+    glBindRenderbuffer(gl, GL_RENDERBUFFER, rb);
+    glRenderbufferStorageMultisample(gl, 0, format,
+                                     self->width, self->height);
+    glBindRenderbuffer(gl, GL_RENDERBUFFER, saved);
+}
+
+/// Attach @a slot, and a depth-stencil buffer of its size, to the render
+/// framebuffer, without disturbing the application's bindings.
+static void
+attach_slot(struct wcore_present *self, int32_t slot)
+{
+    const struct wcore_config_attrs *attrs = &self->config->attrs;
+    struct waffle_gl_dispatch *gl = self->gl;
+    struct wcore_present_slot *s = &self->slots[slot];
+    GLint draw, read;
+
+    if (s->width != self->width || s->height != self->height) {
+        alloc_storage(self, s->color,
+                      attrs->alpha_size > 0 ? GL_RGBA8 : GL_RGB8);
+        s->width = self->width;
+        s->height = self->height;
+    }
+
+    if (self->depth_stencil &&
+        (self->depth_stencil_width != self->width ||
+         self->depth_stencil_height != self->height)) {
+        alloc_storage(self, self->depth_stencil, GL_DEPTH24_STENCIL8);
+        self->depth_stencil_width = self->width;
+        self->depth_stencil_height = self->height;
+    }
+
+    glGetIntegerv(gl, GL_DRAW_FRAMEBUFFER_BINDING, &draw);
+    glGetIntegerv(gl, GL_READ_FRAMEBUFFER_BINDING, &read);
+
+    glBindFramebuffer(gl, GL_FRAMEBUFFER, self->fbo);
+    glFramebufferRenderbuffer(gl, GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              s->color);
+    if (self->depth_stencil)
+        glFramebufferRenderbuffer(gl, GL_FRAMEBUFFER,
+                                  GL_DEPTH_STENCIL_ATTACHMENT,
+                                  self->depth_stencil);
+
+    glBindFramebuffer(gl, GL_DRAW_FRAMEBUFFER, draw);
+    glBindFramebuffer(gl, GL_READ_FRAMEBUFFER, read);
+
+    self->current = slot;
+}
+
+static bool
+bind_present_context(struct wcore_present *self,
+                     struct waffle_gl_dispatch **gl)
+{
+    struct wcore_platform *platform = self->platform;
+    struct wcore_display *display = self->window->display;
+    struct wcore_tinfo *tinfo = wcore_tinfo_get();
+
+    if (!platform->vtbl->make_current(platform, display, self->window,
+                                      self->present_ctx))
+        return false;
+
+    // Let the platform see the window as current here, so that it applies
+    // swap intervals to it at once.
+    wcore_tinfo_set_current(tinfo, display, self->window, self->present_ctx);
+
+    *gl = wcore_gl_dispatch_create(platform, self->present_ctx);
+    return *gl != NULL;
+}
+
+static int
+wcore_present_thread_main(void *arg)
+{
+    struct wcore_present *self = arg;
+    struct wcore_platform *platform = self->platform;
+    struct wcore_tinfo *tinfo;
+    struct waffle_gl_dispatch *gl = NULL;
+    struct wcore_present_frame frame;
+    GLuint read_fbo = 0;
+    bool has_interval;
+    int32_t interval;
+    bool ok;
+
+    ok = bind_present_context(self, &gl);
+    if (ok)
+        glGenFramebuffers(gl, 1, &read_fbo);
+
+    mtx_lock(&self->mutex);
+    if (!ok)
+        capture_error(self);
+    self->start_done = true;
+    cnd_broadcast(&self->cond);
+    mtx_unlock(&self->mutex);
+
+    if (!ok)
+        goto done;
+
+    for (;;) {
+        mtx_lock(&self->mutex);
+        while (self->queue_count == 0 && !self->stopping)
+            cnd_wait(&self->cond, &self->mutex);
+
+        // Stopping still presents the queued frames.
+        if (self->queue_count == 0) {
+            mtx_unlock(&self->mutex);
+            break;
+        }
+
+        frame = self->queue[self->queue_head];
+        self->queue_head = (self->queue_head + 1) % self->depth;
+        self->queue_count--;
+
+        has_interval = self->has_swap_interval;
+        interval = self->swap_interval;
+        self->has_swap_interval = false;
+        mtx_unlock(&self->mutex);
+
+        wcore_error_reset();
+        ok = true;
+
+        if (has_interval)
+            ok = platform->vtbl->window.set_swap_interval(self->window,
+                                                          interval);
+
+        // The wait is on the GPU, so this thread queues the blit at once
+        // and blocks only in the swap, if at all.
+        struct wcore_present_slot *s = &self->slots[frame.slot];
+        glWaitSync(gl, frame.fence);
+        glDeleteSync(gl, frame.fence);
+
+        glBindFramebuffer(gl, GL_READ_FRAMEBUFFER, read_fbo);
+        glFramebufferRenderbuffer(gl, GL_READ_FRAMEBUFFER,
+                                  GL_COLOR_ATTACHMENT0, s->color);
+        glBindFramebuffer(gl, GL_DRAW_FRAMEBUFFER, 0);
+        glBlitFramebuffer(gl, s->width, s->height, s->width, s->height);
+
+        GLsync release = glFenceSync(gl);
+
+        ok &= platform->vtbl->window.swap_buffers(self->window);
+
+        mtx_lock(&self->mutex);
+        s->release = release;
+        s->busy = false;
+        self->num_pending--;
+        if (!ok)
+            capture_error(self);
+        cnd_broadcast(&self->cond);
+        mtx_unlock(&self->mutex);
+
+        // A failed swap does not stop the thread; the next swap reports it.
+    }
+
+done:
+    if (gl) {
+        // Renderbuffers and syncs are shared, so they can go here, even if
+        // the render context is gone. Framebuffer objects are not.
+        for (int32_t i = 0; i <= self->depth; ++i) {
+            if (self->slots[i].release)
+                glDeleteSync(gl, self->slots[i].release);
+            self->slots[i].release = NULL;
+            glDeleteRenderbuffers(gl, 1, &self->slots[i].color);
+            self->slots[i].color = 0;
+        }
+
+        if (self->depth_stencil)
+            glDeleteRenderbuffers(gl, 1, &self->depth_stencil);
+        self->depth_stencil = 0;
+
+        glDeleteFramebuffers(gl, 1, &read_fbo);
+        free(gl);
+    }
+
+    platform->vtbl->make_current(platform, self->window->display,
+                                 NULL, NULL);
+
+    tinfo = wcore_tinfo_get();
+    tinfo->current_window = NULL;
+    tinfo->current_context = NULL;
+    return 0;
+}
+
+/// Set up the render side and start the present thread. The render
+/// context is current.
+static bool
+start(struct wcore_present *self, struct wcore_context *ctx)
+{
+    const struct wcore_config_attrs *attrs = &self->config->attrs;
+    struct wcore_platform *platform = self->platform;
+    struct waffle_gl_dispatch *gl;
+
+    self->gl = wcore_gl_dispatch_create(platform, ctx);
+    if (!self->gl)
+        return false;
+
+    self->ctx = ctx;
+    gl = self->gl;
+
+    if (!check_version(self))
+        goto fail;
+
+    for (int32_t i = 0; i <= self->depth; ++i)
+        glGenRenderbuffers(gl, 1, &self->slots[i].color);
+
+    if (attrs->depth_size > 0 || attrs->stencil_size > 0)
+        glGenRenderbuffers(gl, 1, &self->depth_stencil);
+
+    glGenFramebuffers(gl, 1, &self->fbo);
+    attach_slot(self, 0);
+
+    // Stand in for the default framebuffer, which EGL and GLX size the
+    // viewport and scissor box to at the first bind.
+    glBindFramebuffer(gl, GL_FRAMEBUFFER, self->fbo);
+    glViewport(gl, self->width, self->height);
+    glScissor(gl, self->width, self->height);
+
+    // The names must exist before the present thread uses them.
+    glFlush(gl);
+
+    self->present_ctx = platform->vtbl->context.create(platform,
+                                                       self->config, ctx);
+    if (!self->present_ctx)
+        goto fail;
+
+    if (thrd_create(&self->thread, wcore_present_thread_main,
+                    self) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "thrd_create failed");
+        goto fail;
+    }
+    self->started = true;
+
+    mtx_lock(&self->mutex);
+    while (!self->start_done)
+        cnd_wait(&self->cond, &self->mutex);
+    mtx_unlock(&self->mutex);
+
+    if (!take_error(self))
+        goto fail;
+
+    ctx->present_windows++;
+    return true;
+
+fail:
+    // Leave the window as it was, so that a later bind can try again.
+    WCORE_ERROR_DISABLED({
+        if (self->started) {
+            mtx_lock(&self->mutex);
+            self->stopping = true;
+            cnd_broadcast(&self->cond);
+            mtx_unlock(&self->mutex);
+            thrd_join(self->thread, NULL);
+            self->started = false;
+            self->stopping = false;
+            self->start_done = false;
+        }
+
+        // Unless the present thread got far enough to delete them.
+        for (int32_t i = 0; i <= self->depth; ++i) {
+            if (self->slots[i].color)
+                glDeleteRenderbuffers(gl, 1, &self->slots[i].color);
+        }
+        if (self->depth_stencil)
+            glDeleteRenderbuffers(gl, 1, &self->depth_stencil);
+
+        if (self->fbo)
+            glDeleteFramebuffers(gl, 1, &self->fbo);
+        if (self->present_ctx)
+            platform->vtbl->context.destroy(self->present_ctx);
+    });
+
+    for (int32_t i = 0; i <= self->depth; ++i) {
+        self->slots[i].color = 0;
+        self->slots[i].width = 0;
+        self->slots[i].height = 0;
+    }
+    self->depth_stencil = 0;
+    self->depth_stencil_width = 0;
+    self->depth_stencil_height = 0;
+    self->fbo = 0;
+    self->present_ctx = NULL;
+    self->ctx = NULL;
+    free(self->gl);
+    self->gl = NULL;
+    return false;
+}
+
+struct wcore_present*
+wcore_present_create(struct wcore_platform *platform,
+                     struct wcore_window *window,
+                     struct wcore_config *config,
+                     int32_t depth,
+                     int32_t width,
+                     int32_t height)
+{
+    struct wcore_present *self;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    self->slots = wcore_calloc((depth + 1) * sizeof(self->slots[0]));
+    self->queue = wcore_calloc(depth * sizeof(self->queue[0]));
+    if (!self->slots || !self->queue)
+        goto fail_alloc;
+
+    if (mtx_init(&self->mutex, mtx_plain) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "mtx_init failed");
+        goto fail_alloc;
+    }
+
+    if (cnd_init(&self->cond) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "cnd_init failed");
+        mtx_destroy(&self->mutex);
+        goto fail_alloc;
+    }
+
+    self->platform = platform;
+    self->window = window;
+    self->config = config;
+    self->depth = depth;
+    self->width = width;
+    self->height = height;
+    return self;
+
+fail_alloc:
+    free(self->queue);
+    free(self->slots);
+    free(self);
+    return NULL;
+}
+
+bool
+wcore_present_destroy(struct wcore_present *self)
+{
+    struct wcore_platform *platform = self->platform;
+    bool ok = true;
+
+    if (self->started) {
+        mtx_lock(&self->mutex);
+        self->stopping = true;
+        cnd_broadcast(&self->cond);
+        mtx_unlock(&self->mutex);
+        thrd_join(self->thread, NULL);
+
+        // The render framebuffer belongs to the render context, and can
+        // only be deleted while it is current. Otherwise it goes with the
+        // context.
+        if (wcore_tinfo_get()->current_context == self->ctx)
+            glDeleteFramebuffers(self->gl, 1, &self->fbo);
+
+        ok &= platform->vtbl->context.destroy(self->present_ctx);
+        self->ctx->present_windows--;
+    }
+
+    cnd_destroy(&self->cond);
+    mtx_destroy(&self->mutex);
+    free(self->error_message);
+    free(self->gl);
+    free(self->queue);
+    free(self->slots);
+    free(self);
+    return ok;
+}
+
+bool
+wcore_present_make_current(struct wcore_present *self,
+                           struct wcore_display *display,
+                           struct wcore_context *ctx)
+{
+    struct wcore_platform *platform = self->platform;
+
+    if (self->ctx && ctx != self->ctx) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "a window with WAFFLE_WINDOW_ASYNC_PRESENT can be made "
+                     "current only with the context it was first made "
+                     "current with");
+        return false;
+    }
+
+    if (!platform->vtbl->make_current(platform, display, NULL, ctx))
+        return false;
+
+    if (!self->ctx)
+        return start(self, ctx);
+
+    return true;
+}
+
+bool
+wcore_present_swap(struct wcore_present *self)
+{
+    struct waffle_gl_dispatch *gl = self->gl;
+    struct wcore_present_frame frame;
+    GLsync release = NULL;
+    int32_t next = -1;
+
+    if (!self->ctx || wcore_tinfo_get()->current_context != self->ctx) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "a window with WAFFLE_WINDOW_ASYNC_PRESENT must be "
+                     "current to the calling thread to be swapped");
+        return false;
+    }
+
+    if (!take_error(self))
+        return false;
+
+    frame.slot = self->current;
+    frame.fence = glFenceSync(gl);
+    glFlush(gl);
+
+    mtx_lock(&self->mutex);
+
+    // Backpressure: the render thread may run at most depth frames ahead
+    // of the display.
+    while (self->num_pending >= self->depth)
+        cnd_wait(&self->cond, &self->mutex);
+
+    self->queue[(self->queue_head + self->queue_count) % self->depth] = frame;
+    self->queue_count++;
+    self->num_pending++;
+    self->slots[frame.slot].busy = true;
+    cnd_broadcast(&self->cond);
+
+    for (int32_t i = 1; i <= self->depth; ++i) {
+        int32_t slot = (frame.slot + i) % (self->depth + 1);
+
+        if (!self->slots[slot].busy) {
+            next = slot;
+            break;
+        }
+    }
+
+    release = self->slots[next].release;
+    self->slots[next].release = NULL;
+    mtx_unlock(&self->mutex);
+
+    // Do not draw over the slot until the present thread's blit from it
+    // is done. The wait is on the GPU.
+    if (release) {
+        glWaitSync(gl, release);
+        glDeleteSync(gl, release);
+    }
+
+    attach_slot(self, next);
+    return true;
+}
+
+void
+wcore_present_resize(struct wcore_present *self,
+                     int32_t width,
+                     int32_t height)
+{
+    self->width = width;
+    self->height = height;
+
+    // Resize the frame being drawn now, if possible. The others are
+    // resized as they come up.
+    if (self->ctx && wcore_tinfo_get()->current_context == self->ctx)
+        attach_slot(self, self->current);
+}
+
+bool
+wcore_present_set_swap_interval(struct wcore_present *self,
+                                int32_t interval)
+{
+    struct wcore_platform *platform = self->platform;
+
+    // Before the present thread starts, the platform keeps the interval
+    // and applies it when the thread binds the window.
+    if (!self->started)
+        return platform->vtbl->window.set_swap_interval(self->window,
+                                                        interval);
+
+    mtx_lock(&self->mutex);
+    self->has_swap_interval = true;
+    self->swap_interval = interval;
+    mtx_unlock(&self->mutex);
+    return true;
+}
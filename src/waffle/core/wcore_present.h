@@ -0,0 +1,171 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "threads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct waffle_gl_dispatch;
+struct wcore_config;
+struct wcore_context;
+struct wcore_display;
+struct wcore_platform;
+struct wcore_window;
+
+/// @brief The color buffer of one frame of an asynchronously presented
+/// window.
+struct wcore_present_slot {
+    uint32_t color;
+    int32_t width;
+    int32_t height;
+
+    /// Queued or being presented. Guarded by the present lock.
+    bool busy;
+
+    /// Signaled when the present thread is done reading the slot, or null.
+    /// Guarded by the present lock.
+    void *release;
+};
+
+/// @brief A frame handed to the present thread.
+struct wcore_present_frame {
+    int32_t slot;
+
+    /// Signaled when the render context is done drawing the frame.
+    void *fence;
+};
+
+/// @brief State of a window created with WAFFLE_WINDOW_ASYNC_PRESENT.
+///
+/// The window's surface is bound only on the present thread, to a context
+/// that shares with the render context. The render context is bound
+/// without a surface, and draws to a framebuffer object whose color
+/// buffer changes at each swap. A swap fences the frame and queues it; the
+/// present thread waits for the fence on the GPU, blits the frame to the
+/// surface, and swaps the surface.
+struct wcore_present {
+    struct wcore_platform *platform;
+    struct wcore_window *window;
+    struct wcore_config *config;
+    int32_t depth;
+
+    // Touched only by the thread that the render context is current to.
+    struct wcore_context *ctx;
+    struct waffle_gl_dispatch *gl;
+    uint32_t fbo;
+    uint32_t depth_stencil;
+    int32_t depth_stencil_width;
+    int32_t depth_stencil_height;
+    int32_t current;
+    int32_t width;
+    int32_t height;
+
+    /// Has room for @a depth + 1, so a free slot exists whenever fewer
+    /// than @a depth frames are pending.
+    struct wcore_present_slot *slots;
+
+    struct wcore_context *present_ctx;
+    thrd_t thread;
+    bool started;
+
+    /// Guards the fields below and the slots' @a busy and @a release.
+    mtx_t mutex;
+    cnd_t cond;
+
+    /// A ring of @a depth frames.
+    struct wcore_present_frame *queue;
+    int32_t queue_head;
+    int32_t queue_count;
+
+    /// Frames queued or being presented.
+    int32_t num_pending;
+
+    bool stopping;
+    bool start_done;
+
+    bool has_swap_interval;
+    int32_t swap_interval;
+
+    /// The first failure of the present thread, reported by the next swap.
+    int32_t error_code;
+    char *error_message;
+};
+
+/// @brief Create the present state of a window of @a width x @a height.
+///
+/// Nothing starts until the window is first made current.
+struct wcore_present*
+wcore_present_create(struct wcore_platform *platform,
+                     struct wcore_window *window,
+                     struct wcore_config *config,
+                     int32_t depth,
+                     int32_t width,
+                     int32_t height);
+
+/// @brief Present the frames already queued, then stop the present thread.
+///
+/// Call before destroying the window.
+bool
+wcore_present_destroy(struct wcore_present *self);
+
+/// @brief Make @a ctx current to the calling thread in place of the
+/// window.
+///
+/// The first call creates the present context, starts the present thread,
+/// and binds the framebuffer object to @a ctx. Later calls must pass the
+/// same context.
+bool
+wcore_present_make_current(struct wcore_present *self,
+                           struct wcore_display *display,
+                           struct wcore_context *ctx);
+
+/// @brief Queue the current frame and start the next one.
+///
+/// Blocks while @a depth frames are pending. The render context must be
+/// current to the calling thread.
+bool
+wcore_present_swap(struct wcore_present *self);
+
+/// @brief Resize the frames rendered from now on.
+void
+wcore_present_resize(struct wcore_present *self,
+                     int32_t width,
+                     int32_t height);
+
+/// @brief Set the window's swap interval on the present thread.
+bool
+wcore_present_set_swap_interval(struct wcore_present *self,
+                                int32_t interval);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,135 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wcore_error.h"
+#include "wcore_sym_cache.h"
+#include "wcore_util.h"
+
+static struct wcore_sym_cache_entry *
+find_entry(struct wcore_sym_cache_entry *entries, size_t num_entries,
+           int32_t dl, const char *name, size_t len)
+{
+    size_t mask = num_entries - 1;
+    size_t i = (wcore_hash_string(name, len) ^ (size_t) dl) & mask;
+
+    while (entries[i].name) {
+        if (entries[i].dl == dl && entries[i].len == len &&
+            memcmp(entries[i].name, name, len) == 0)
+            break;
+
+        i = (i + 1) & mask;
+    }
+
+    return &entries[i];
+}
+
+static bool
+grow(struct wcore_sym_cache *self)
+{
+    struct wcore_sym_cache_entry *entries;
+    size_t num_entries = self->num_entries ? self->num_entries : 256;
+    size_t size;
+
+    if (self->num_entries && self->count + 1 <= self->num_entries / 2)
+        return true;
+
+    if (self->num_entries && !wcore_imul_size(&num_entries, 2))
+        goto bad_alloc;
+
+    if (!wcore_mul_size(&size, num_entries, sizeof(*entries)))
+        goto bad_alloc;
+
+    entries = wcore_calloc(size);
+    if (!entries)
+        return false;
+
+    for (size_t i = 0; i < self->num_entries; ++i) {
+        const struct wcore_sym_cache_entry *old = &self->entries[i];
+        if (old->name)
+            *find_entry(entries, num_entries,
+                        old->dl, old->name, old->len) = *old;
+    }
+
+    free(self->entries);
+    self->entries = entries;
+    self->num_entries = num_entries;
+    return true;
+
+bad_alloc:
+    wcore_error(WAFFLE_ERROR_BAD_ALLOC);
+    return false;
+}
+
+void*
+wcore_sym_cache_lookup(const struct wcore_sym_cache *self,
+                       int32_t dl, const char *name)
+{
+    if (self->count == 0)
+        return NULL;
+
+    return find_entry(self->entries, self->num_entries,
+                      dl, name, strlen(name))->sym;
+}
+
+bool
+wcore_sym_cache_insert(struct wcore_sym_cache *self,
+                       int32_t dl, const char *name, void *sym)
+{
+    struct wcore_sym_cache_entry *entry;
+    size_t len = strlen(name);
+
+    assert(sym);
+
+    if (!grow(self))
+        return false;
+
+    entry = find_entry(self->entries, self->num_entries, dl, name, len);
+    if (entry->name)
+        return true;
+
+    entry->name = wcore_strdup(name);
+    if (!entry->name)
+        return false;
+
+    entry->len = len;
+    entry->dl = dl;
+    entry->sym = sym;
+    ++self->count;
+    return true;
+}
+
+void
+wcore_sym_cache_finish(struct wcore_sym_cache *self)
+{
+    for (size_t i = 0; i < self->num_entries; ++i)
+        free(self->entries[i].name);
+
+    free(self->entries);
+    memset(self, 0, sizeof(*self));
+}
@@ -0,0 +1,73 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief Key for symbols obtained with the platform's get_proc_address(),
+/// as opposed to a WAFFLE_DL_* library.
+#define WCORE_SYM_CACHE_PROC_ADDRESS 0
+
+struct wcore_sym_cache_entry {
+    char *name;
+    size_t len;
+    int32_t dl;
+    void *sym;
+};
+
+/// @brief Map from (WAFFLE_DL_*, symbol name) to the resolved pointer.
+///
+/// Not thread-safe; see wcore_platform::sym_cache_mutex. A zero-filled
+/// struct is a valid, empty cache.
+struct wcore_sym_cache {
+    /// Open-addressed, power-of-two sized, never more than half full.
+    struct wcore_sym_cache_entry *entries;
+    size_t num_entries;
+    size_t count;
+};
+
+/// @brief Return the cached symbol, or null if absent.
+void*
+wcore_sym_cache_lookup(const struct wcore_sym_cache *self,
+                       int32_t dl, const char *name);
+
+/// @brief Insert a non-null symbol. Existing entries are left unchanged.
+bool
+wcore_sym_cache_insert(struct wcore_sym_cache *self,
+                       int32_t dl, const char *name, void *sym);
+
+void
+wcore_sym_cache_finish(struct wcore_sym_cache *self);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,121 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "waffle.h"
+#include "wcore_sym_cache.h"
+
+static int a, b, c;
+
+static void
+test_wcore_sym_cache_empty(void **state) {
+    struct wcore_sym_cache cache = {0};
+
+    assert_null(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL, "glClear"));
+    wcore_sym_cache_finish(&cache);
+}
+
+static void
+test_wcore_sym_cache_insert_lookup(void **state) {
+    struct wcore_sym_cache cache = {0};
+
+    assert_true(wcore_sym_cache_insert(&cache, WAFFLE_DL_OPENGL, "glClear", &a));
+    assert_true(wcore_sym_cache_insert(&cache, WAFFLE_DL_OPENGL, "glFlush", &b));
+
+    assert_ptr_equal(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL, "glClear"), &a);
+    assert_ptr_equal(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL, "glFlush"), &b);
+    assert_null(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL, "glFinish"));
+    assert_null(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL, "glClea"));
+    assert_null(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL, "glClearColor"));
+    wcore_sym_cache_finish(&cache);
+}
+
+static void
+test_wcore_sym_cache_key_includes_dl(void **state) {
+    struct wcore_sym_cache cache = {0};
+
+    assert_true(wcore_sym_cache_insert(&cache, WAFFLE_DL_OPENGL, "glClear", &a));
+    assert_true(wcore_sym_cache_insert(&cache, WAFFLE_DL_OPENGL_ES2, "glClear", &b));
+    assert_true(wcore_sym_cache_insert(&cache, WCORE_SYM_CACHE_PROC_ADDRESS, "glClear", &c));
+
+    assert_ptr_equal(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL, "glClear"), &a);
+    assert_ptr_equal(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL_ES2, "glClear"), &b);
+    assert_ptr_equal(wcore_sym_cache_lookup(&cache, WCORE_SYM_CACHE_PROC_ADDRESS, "glClear"), &c);
+    assert_null(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL_ES1, "glClear"));
+    wcore_sym_cache_finish(&cache);
+}
+
+static void
+test_wcore_sym_cache_insert_keeps_first(void **state) {
+    struct wcore_sym_cache cache = {0};
+
+    assert_true(wcore_sym_cache_insert(&cache, WAFFLE_DL_OPENGL, "glClear", &a));
+    assert_true(wcore_sym_cache_insert(&cache, WAFFLE_DL_OPENGL, "glClear", &b));
+
+    assert_int_equal(cache.count, 1);
+    assert_ptr_equal(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL, "glClear"), &a);
+    wcore_sym_cache_finish(&cache);
+}
+
+static void
+test_wcore_sym_cache_grow(void **state) {
+    struct wcore_sym_cache cache = {0};
+    static int syms[3000];
+    char name[32];
+
+    for (int i = 0; i < 3000; ++i) {
+        snprintf(name, sizeof(name), "glTestFunction%d", i);
+        assert_true(wcore_sym_cache_insert(&cache, WAFFLE_DL_OPENGL, name, &syms[i]));
+    }
+
+    assert_int_equal(cache.count, 3000);
+
+    for (int i = 0; i < 3000; ++i) {
+        snprintf(name, sizeof(name), "glTestFunction%d", i);
+        assert_ptr_equal(wcore_sym_cache_lookup(&cache, WAFFLE_DL_OPENGL, name), &syms[i]);
+    }
+
+    wcore_sym_cache_finish(&cache);
+    assert_int_equal(cache.count, 0);
+}
+
+int
+main(void) {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_wcore_sym_cache_empty),
+        cmocka_unit_test(test_wcore_sym_cache_insert_lookup),
+        cmocka_unit_test(test_wcore_sym_cache_key_includes_dl),
+        cmocka_unit_test(test_wcore_sym_cache_insert_keeps_first),
+        cmocka_unit_test(test_wcore_sym_cache_grow),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
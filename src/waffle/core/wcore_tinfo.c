@@ -30,12 +30,19 @@
 
 #include "threads.h"
 
+#include "wcore_context.h"
+#include "wcore_display.h"
 #include "wcore_error.h"
 #include "wcore_tinfo.h"
+#include "wcore_window.h"
 
 static once_flag wcore_tinfo_once = ONCE_FLAG_INIT;
 static tss_t wcore_tinfo_key;
 
+static once_flag wcore_tinfo_serial_once = ONCE_FLAG_INIT;
+static mtx_t wcore_tinfo_serial_mutex;
+static uint64_t wcore_tinfo_serial_counter;
+
 #ifdef WAFFLE_HAS_TLS
 /// @brief Thread-local storage for all of Waffle.
 ///
@@ -108,6 +115,12 @@ wcore_tinfo_init(struct wcore_tinfo *tinfo)
     tinfo->current_display = NULL;
     tinfo->current_window = NULL;
     tinfo->current_context = NULL;
+    tinfo->current_dispatch = NULL;
+    tinfo->current_is_valid = false;
+    tinfo->current_display_id = 0;
+    tinfo->current_window_serial = 0;
+    tinfo->current_context_serial = 0;
+    tinfo->make_current_elided = 0;
 
     tinfo->is_init = true;
 
@@ -153,3 +166,76 @@ wcore_tinfo_get(void)
     return tinfo;
 #endif
 }
+
+static void
+wcore_tinfo_serial_init(void)
+{
+    mtx_init(&wcore_tinfo_serial_mutex, mtx_plain);
+}
+
+uint64_t
+wcore_tinfo_next_serial(void)
+{
+    uint64_t serial;
+
+    call_once(&wcore_tinfo_serial_once, wcore_tinfo_serial_init);
+    mtx_lock(&wcore_tinfo_serial_mutex);
+    serial = ++wcore_tinfo_serial_counter;
+    mtx_unlock(&wcore_tinfo_serial_mutex);
+
+    return serial;
+}
+
+void
+wcore_tinfo_set_current(struct wcore_tinfo *tinfo,
+                        struct wcore_display *display,
+                        struct wcore_window *window,
+                        struct wcore_context *ctx)
+{
+    tinfo->current_display = display;
+    tinfo->current_window = window;
+    tinfo->current_context = ctx;
+    tinfo->current_dispatch = NULL;
+    tinfo->current_is_valid = true;
+
+    tinfo->current_display_id = display ? display->api.display_id : 0;
+    tinfo->current_window_serial = window ? window->serial : 0;
+    tinfo->current_context_serial = ctx ? ctx->serial : 0;
+}
+
+bool
+wcore_tinfo_is_current(const struct wcore_tinfo *tinfo,
+                       const struct wcore_display *display,
+                       const struct wcore_window *window,
+                       const struct wcore_context *ctx)
+{
+    // The pointers alone are not enough: they may be live objects that reuse
+    // the addresses of objects destroyed on another thread.
+    return tinfo->current_is_valid &&
+           tinfo->current_display == display &&
+           tinfo->current_window == window &&
+           tinfo->current_context == ctx &&
+           tinfo->current_display_id == (display ? display->api.display_id : 0) &&
+           tinfo->current_window_serial == (window ? window->serial : 0) &&
+           tinfo->current_context_serial == (ctx ? ctx->serial : 0);
+}
+
+void
+wcore_tinfo_forget_current(struct wcore_tinfo *tinfo, const void *obj)
+{
+    if (tinfo->current_display == obj) {
+        tinfo->current_display = NULL;
+        tinfo->current_is_valid = false;
+    }
+
+    if (tinfo->current_window == obj) {
+        tinfo->current_window = NULL;
+        tinfo->current_is_valid = false;
+    }
+
+    if (tinfo->current_context == obj) {
+        tinfo->current_context = NULL;
+        tinfo->current_dispatch = NULL;
+        tinfo->current_is_valid = false;
+    }
+}
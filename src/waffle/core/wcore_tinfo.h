@@ -25,10 +25,15 @@
 
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 struct wcore_error_tinfo;
 struct wcore_context;
 struct wcore_display;
 struct wcore_window;
+struct waffle_gl_dispatch;
 
 /// @brief Thread-local info for all of Waffle.
 ///
@@ -84,8 +89,58 @@ struct wcore_tinfo {
     struct wcore_window *current_window;
     struct wcore_context *current_context;
 
+    /// @brief The dispatch table of current_context, or null.
+    ///
+    /// Only set if the platform was initialized with WAFFLE_GL_DISPATCH.
+    const struct waffle_gl_dispatch *current_dispatch;
+
+    /// @brief True if the current_* triple is known to be bound.
+    ///
+    /// waffle_make_current() skips the platform call when asked to bind the
+    /// triple that is already current. This is cleared when one of the bound
+    /// objects is destroyed, because a new object may reuse its address.
+    bool current_is_valid;
+
+    /// @brief Identity of the current_* objects when they were bound.
+    ///
+    /// An object destroyed on another thread is not forgotten here, and a new
+    /// object may reuse its address, so wcore_tinfo_is_current() compares
+    /// these too.
+    size_t current_display_id;
+    uint64_t current_window_serial;
+    uint64_t current_context_serial;
+
+    /// @brief Number of waffle_make_current() calls elided on this thread.
+    uint64_t make_current_elided;
+
     bool is_init;
 };
 
 /// @brief Get the thread-local info for the current thread.
 struct wcore_tinfo* wcore_tinfo_get(void);
+
+/// @brief Return a new serial, unique in the process and never zero.
+///
+/// Windows and contexts take one at creation.
+uint64_t
+wcore_tinfo_next_serial(void);
+
+/// @brief Record the display, window and context just bound to the thread.
+void
+wcore_tinfo_set_current(struct wcore_tinfo *tinfo,
+                        struct wcore_display *display,
+                        struct wcore_window *window,
+                        struct wcore_context *ctx);
+
+/// @brief Return true if the given triple is known to be bound to the thread.
+bool
+wcore_tinfo_is_current(const struct wcore_tinfo *tinfo,
+                       const struct wcore_display *display,
+                       const struct wcore_window *window,
+                       const struct wcore_context *ctx);
+
+/// @brief Drop @a obj from the thread's current display, window and context.
+///
+/// Call this when a display, window, or context is destroyed.
+void
+wcore_tinfo_forget_current(struct wcore_tinfo *tinfo, const void *obj);
@@ -23,6 +23,7 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "wcore_error.h"
@@ -86,6 +87,31 @@ wcore_strdup(const char *str)
     return p;
 }
 
+size_t
+wcore_hash_string(const char *s, size_t len)
+{
+    const uint64_t k = 0x9e3779b97f4a7c15ull;
+    uint64_t h = len * k;
+    uint64_t w;
+
+    for (; len >= 8; s += 8, len -= 8) {
+        memcpy(&w, s, 8);
+        h = (h ^ w) * k;
+    }
+
+    if (len > 0) {
+        w = 0;
+        memcpy(&w, s, len);
+        h = (h ^ w) * k;
+    }
+
+    h ^= h >> 32;
+    h *= k;
+    h ^= h >> 29;
+
+    return (size_t) h;
+}
+
 const char*
 wcore_enum_to_string(int32_t e)
 {
@@ -104,6 +130,10 @@ wcore_enum_to_string(int32_t e)
         CASE(WAFFLE_PLATFORM_WGL);
         CASE(WAFFLE_PLATFORM_NACL);
         CASE(WAFFLE_PLATFORM_SURFACELESS_EGL);
+        CASE(WAFFLE_PLATFORM_EGL_DEVICE);
+        CASE(WAFFLE_VALIDATE_MAKE_CURRENT);
+        CASE(WAFFLE_GL_DISPATCH);
+        CASE(WAFFLE_CAPABILITY_CACHE);
         CASE(WAFFLE_CONTEXT_API);
         CASE(WAFFLE_CONTEXT_OPENGL);
         CASE(WAFFLE_CONTEXT_OPENGL_ES1);
@@ -117,6 +147,14 @@ wcore_enum_to_string(int32_t e)
         CASE(WAFFLE_CONTEXT_FORWARD_COMPATIBLE);
         CASE(WAFFLE_CONTEXT_DEBUG);
         CASE(WAFFLE_CONTEXT_ROBUST_ACCESS);
+        CASE(WAFFLE_CONTEXT_NO_ERROR);
+        CASE(WAFFLE_CONTEXT_RELEASE_BEHAVIOR);
+        CASE(WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH);
+        CASE(WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE);
+        CASE(WAFFLE_CONTEXT_PRIORITY);
+        CASE(WAFFLE_CONTEXT_PRIORITY_LOW);
+        CASE(WAFFLE_CONTEXT_PRIORITY_MEDIUM);
+        CASE(WAFFLE_CONTEXT_PRIORITY_HIGH);
         CASE(WAFFLE_RED_SIZE);
         CASE(WAFFLE_GREEN_SIZE);
         CASE(WAFFLE_BLUE_SIZE);
@@ -127,6 +165,11 @@ wcore_enum_to_string(int32_t e)
         CASE(WAFFLE_SAMPLES);
         CASE(WAFFLE_DOUBLE_BUFFERED);
         CASE(WAFFLE_ACCUM_BUFFER);
+        CASE(WAFFLE_NO_CONFIG);
+        CASE(WAFFLE_CONFIG_RANKING);
+        CASE(WAFFLE_CONFIG_PREFER_NATIVE_ORDER);
+        CASE(WAFFLE_CONFIG_PREFER_SMALLEST);
+        CASE(WAFFLE_SAMPLES_FALLBACK);
         CASE(WAFFLE_DL_OPENGL);
         CASE(WAFFLE_DL_OPENGL_ES1);
         CASE(WAFFLE_DL_OPENGL_ES2);
@@ -134,6 +177,37 @@ wcore_enum_to_string(int32_t e)
         CASE(WAFFLE_WINDOW_WIDTH);
         CASE(WAFFLE_WINDOW_HEIGHT);
         CASE(WAFFLE_WINDOW_FULLSCREEN);
+        CASE(WAFFLE_WINDOW_FRAME_PACING);
+        CASE(WAFFLE_WINDOW_SURFACELESS);
+        CASE(WAFFLE_WINDOW_ASYNC_PRESENT);
+        CASE(WAFFLE_WINDOW_PRESENT_QUEUE_DEPTH);
+        CASE(WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT);
+        CASE(WAFFLE_WINDOW_SWAP_INTERVAL);
+        CASE(WAFFLE_WINDOW_FRAMES_PRESENTED);
+        CASE(WAFFLE_WINDOW_FRAMES_DELAYED);
+        CASE(WAFFLE_WINDOW_FRAMES_DROPPED);
+        CASE(WAFFLE_WINDOW_FRAMEBUFFER);
+        CASE(WAFFLE_DISPLAY_DEVICE_COUNT);
+        CASE(WAFFLE_DISPLAY_DEVICE_INDEX);
+        CASE(WAFFLE_DISPLAY_DEVICE_SOFTWARE);
+        CASE(WAFFLE_DISPLAY_DEVICE_DRM_FILE);
+        CASE(WAFFLE_DISPLAY_DEVICE_DRM_RENDER_NODE_FILE);
+        CASE(WAFFLE_DISPLAY_DEVICE_EXTENSIONS);
+        CASE(WAFFLE_RENDERER_VENDOR_ID);
+        CASE(WAFFLE_RENDERER_DEVICE_ID);
+        CASE(WAFFLE_RENDERER_VIDEO_MEMORY);
+        CASE(WAFFLE_RENDERER_ACCELERATED);
+        CASE(WAFFLE_RENDERER_OPENGL_CORE_PROFILE_VERSION);
+        CASE(WAFFLE_RENDERER_OPENGL_COMPATIBILITY_PROFILE_VERSION);
+        CASE(WAFFLE_RENDERER_OPENGL_ES_PROFILE_VERSION);
+        CASE(WAFFLE_RENDERER_OPENGL_ES2_PROFILE_VERSION);
+        CASE(WAFFLE_CONTEXT_POOL_PREWARM);
+        CASE(WAFFLE_CONTEXT_POOL_MAX);
+        CASE(WAFFLE_CONTEXT_POOL_SIZE);
+        CASE(WAFFLE_CONTEXT_POOL_AVAILABLE);
+        CASE(WAFFLE_CONTEXT_POOL_HITS);
+        CASE(WAFFLE_CONTEXT_POOL_MISSES);
+        CASE(WAFFLE_EXECUTOR_THREADS);
 
         default: return NULL;
 
@@ -100,6 +100,13 @@ wcore_realloc(void *ptr, size_t size);
 char*
 wcore_strdup(const char *str);
 
+/// @brief Hash the first @a len bytes of @a s.
+///
+/// Tuned for GL extension and function names, which are short and share
+/// long prefixes such as "GL_ARB_" and "gl".
+size_t
+wcore_hash_string(const char *s, size_t len);
+
 /// @brief Create one of `union waffle_native_*`.
 ///
 /// The example below allocates n_dpy and n_dpy->glx, then sets both
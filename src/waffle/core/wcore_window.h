@@ -25,15 +25,40 @@
 
 #pragma once
 
+#include "threads.h"
+
 #include "wcore_config.h"
+#include "wcore_error.h"
+#include "wcore_tinfo.h"
 #include "wcore_util.h"
 
+struct wcore_frame_limiter;
+struct wcore_present;
 struct wcore_window;
 union waffle_native_window;
 
 struct wcore_window {
     struct api_object api;
     struct wcore_display *display;
+
+    /// Unique in the process, so that a window at a reused address is not
+    /// taken for the one that was current there.
+    uint64_t serial;
+
+    /// Null unless the window was created with WAFFLE_WINDOW_ASYNC_PRESENT.
+    struct wcore_present *present;
+
+    /// Null unless the window was created with
+    /// WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT.
+    struct wcore_frame_limiter *limiter;
+
+    /// For platforms whose swap interval applies to the drawable current
+    /// to the calling thread, an interval that is applied when the window
+    /// is next made current. Any thread may set it, hence the lock.
+    mtx_t swap_interval_mutex;
+    bool has_swap_interval;
+    bool swap_interval_dirty;
+    int32_t swap_interval;
 };
 
 static inline struct waffle_window*
@@ -55,6 +80,12 @@ wcore_window_init(struct wcore_window *self,
 
     self->api.display_id = config->display->api.display_id;
     self->display = config->display;
+    self->serial = wcore_tinfo_next_serial();
+
+    if (mtx_init(&self->swap_interval_mutex, mtx_plain) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "mtx_init failed");
+        return false;
+    }
 
     return true;
 }
@@ -62,7 +93,20 @@ wcore_window_init(struct wcore_window *self,
 static inline bool
 wcore_window_teardown(struct wcore_window *self)
 {
-    (void) self;
     assert(self);
+    mtx_destroy(&self->swap_interval_mutex);
     return true;
 }
+
+/// Whether a swap interval awaits the next make current, which therefore
+/// must reach the platform.
+static inline bool
+wcore_window_swap_interval_dirty(struct wcore_window *self)
+{
+    bool dirty;
+
+    mtx_lock(&self->swap_interval_mutex);
+    dirty = self->swap_interval_dirty;
+    mtx_unlock(&self->swap_interval_mutex);
+    return dirty;
+}
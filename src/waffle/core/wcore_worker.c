@@ -0,0 +1,143 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <assert.h>
+
+#include "wcore_error.h"
+#include "wcore_worker.h"
+
+bool
+wcore_worker_init(struct wcore_worker *self)
+{
+    assert(self);
+
+    if (mtx_init(&self->mutex, mtx_plain) != thrd_success) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "mtx_init failed");
+        return false;
+    }
+
+    if (cnd_init(&self->cond) != thrd_success) {
+        mtx_destroy(&self->mutex);
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "cnd_init failed");
+        return false;
+    }
+
+    self->started = false;
+    self->stopping = false;
+    self->head = NULL;
+    self->tail = NULL;
+    return true;
+}
+
+void
+wcore_worker_teardown(struct wcore_worker *self)
+{
+    wcore_worker_stop(self);
+    cnd_destroy(&self->cond);
+    mtx_destroy(&self->mutex);
+}
+
+static int
+wcore_worker_main(void *arg)
+{
+    struct wcore_worker *self = arg;
+
+    mtx_lock(&self->mutex);
+
+    for (;;) {
+        struct wcore_worker_job *job;
+
+        while (!self->head && !self->stopping)
+            cnd_wait(&self->cond, &self->mutex);
+
+        job = self->head;
+        if (!job)
+            break;
+
+        self->head = job->next;
+        if (!self->head)
+            self->tail = NULL;
+
+        mtx_unlock(&self->mutex);
+        job->run(job);
+        mtx_lock(&self->mutex);
+    }
+
+    mtx_unlock(&self->mutex);
+    return 0;
+}
+
+bool
+wcore_worker_post(struct wcore_worker *self, struct wcore_worker_job *job)
+{
+    bool ok = true;
+
+    mtx_lock(&self->mutex);
+
+    if (self->stopping) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "the worker is stopping");
+        ok = false;
+        goto out;
+    }
+
+    if (!self->started) {
+        if (thrd_create(&self->thread, wcore_worker_main,
+                        self) != thrd_success) {
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN, "thrd_create failed");
+            ok = false;
+            goto out;
+        }
+
+        self->started = true;
+    }
+
+    job->next = NULL;
+    if (self->tail)
+        self->tail->next = job;
+    else
+        self->head = job;
+    self->tail = job;
+
+    cnd_signal(&self->cond);
+
+out:
+    mtx_unlock(&self->mutex);
+    return ok;
+}
+
+void
+wcore_worker_stop(struct wcore_worker *self)
+{
+    bool join;
+
+    mtx_lock(&self->mutex);
+    join = self->started && !self->stopping;
+    self->stopping = true;
+    cnd_signal(&self->cond);
+    mtx_unlock(&self->mutex);
+
+    if (join)
+        thrd_join(self->thread, NULL);
+}
@@ -0,0 +1,80 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+
+#include "threads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief A unit of work for a wcore_worker, embedded in its owner.
+struct wcore_worker_job {
+    /// Called on the worker thread. The job may free itself.
+    void (*run)(struct wcore_worker_job *self);
+
+    struct wcore_worker_job *next;
+};
+
+/// @brief A thread that runs posted jobs one at a time, in order.
+///
+/// The thread starts with the first job, so that applications that never
+/// post one pay nothing for it.
+struct wcore_worker {
+    mtx_t mutex;
+    cnd_t cond;
+    thrd_t thread;
+    bool started;
+    bool stopping;
+    struct wcore_worker_job *head;
+    struct wcore_worker_job *tail;
+};
+
+bool
+wcore_worker_init(struct wcore_worker *self);
+
+/// @brief Stop the worker, if running, and free its resources.
+void
+wcore_worker_teardown(struct wcore_worker *self);
+
+/// @brief Queue @a job, starting the thread if needed.
+///
+/// Thread-safe. Fails only if the thread cannot be started or the worker
+/// is stopping.
+bool
+wcore_worker_post(struct wcore_worker *self, struct wcore_worker_job *job);
+
+/// @brief Run the jobs already queued, then join the thread.
+///
+/// Thread-safe and idempotent. Jobs posted afterwards are rejected.
+void
+wcore_worker_stop(struct wcore_worker *self);
+
+#ifdef __cplusplus
+}
+#endif
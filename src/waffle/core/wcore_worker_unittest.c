@@ -0,0 +1,132 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <cmocka.h>
+
+#include "threads.h"
+
+#include "wcore_util.h"
+#include "wcore_worker.h"
+
+struct test_job {
+    struct wcore_worker_job job;
+    int index;
+    int *order;
+    int *count;
+    thrd_t thread;
+};
+
+DEFINE_CONTAINER_CAST_FUNC(test_job,
+                           struct test_job,
+                           struct wcore_worker_job,
+                           job)
+
+static void
+run(struct wcore_worker_job *job)
+{
+    struct test_job *self = test_job(job);
+
+    // Only the worker touches *count, so no lock is needed.
+    self->order[(*self->count)++] = self->index;
+    self->thread = thrd_current();
+}
+
+static void
+test_wcore_worker_idle(void **state) {
+    struct wcore_worker worker;
+
+    assert_true(wcore_worker_init(&worker));
+    assert_false(worker.started);
+    wcore_worker_teardown(&worker);
+}
+
+static void
+test_wcore_worker_order(void **state) {
+    struct wcore_worker worker;
+    struct test_job jobs[100];
+    int order[100];
+    int count = 0;
+
+    assert_true(wcore_worker_init(&worker));
+
+    for (int i = 0; i < 100; ++i) {
+        jobs[i].job.run = run;
+        jobs[i].index = i;
+        jobs[i].order = order;
+        jobs[i].count = &count;
+        assert_true(wcore_worker_post(&worker, &jobs[i].job));
+    }
+
+    // Stopping runs the queued jobs first.
+    wcore_worker_stop(&worker);
+    assert_int_equal(count, 100);
+
+    for (int i = 0; i < 100; ++i) {
+        assert_int_equal(order[i], i);
+        assert_true(thrd_equal(jobs[i].thread, jobs[0].thread));
+    }
+
+    assert_false(thrd_equal(jobs[0].thread, thrd_current()));
+
+    wcore_worker_teardown(&worker);
+}
+
+static void
+test_wcore_worker_post_after_stop(void **state) {
+    struct wcore_worker worker;
+    struct test_job job;
+    int order[1];
+    int count = 0;
+
+    job.job.run = run;
+    job.index = 0;
+    job.order = order;
+    job.count = &count;
+
+    assert_true(wcore_worker_init(&worker));
+    wcore_worker_stop(&worker);
+    assert_false(wcore_worker_post(&worker, &job.job));
+    wcore_worker_stop(&worker);
+    wcore_worker_teardown(&worker);
+
+    assert_int_equal(count, 0);
+}
+
+int
+main(void) {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_wcore_worker_idle),
+        cmocka_unit_test(test_wcore_worker_order),
+        cmocka_unit_test(test_wcore_worker_post_after_stop),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -26,7 +26,9 @@
 #include <EGL/egl.h>
 #include <EGL/eglext.h>
 
+#include "wcore_caps_cache.h"
 #include "wcore_config_attrs.h"
+#include "wcore_config_rank.h"
 #include "wcore_error.h"
 #include "wcore_platform.h"
 
@@ -72,6 +74,21 @@ check_context_attrs(struct wegl_display *dpy,
         return false;
     }
 
+    if (attrs->context_no_error && !dpy->KHR_create_context_no_error) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_KHR_create_context_no_error is required in order to "
+                     "request a no-error context");
+        return false;
+    }
+
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE &&
+        !dpy->KHR_context_flush_control) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_KHR_context_flush_control is required in order to "
+                     "request WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE");
+        return false;
+    }
+
     switch (attrs->context_api) {
         case WAFFLE_CONTEXT_OPENGL:
             if (!(dpy->api_mask & WEGL_OPENGL_API)) {
@@ -129,20 +146,33 @@ check_context_attrs(struct wegl_display *dpy,
     }
 }
 
-static EGLConfig
-choose_real_config(struct wegl_display *dpy,
-                   const struct wcore_config_attrs *attrs)
+/// @brief Get the configs that match @a attrs, best first.
+///
+/// Unless @a want_all is set, or the configs must be ranked, EGL is asked
+/// for only the first match. The caller must free @a out_configs.
+static bool
+choose_real_configs(struct wegl_display *dpy,
+                    const struct wcore_config_attrs *attrs,
+                    bool want_all,
+                    EGLConfig **out_configs,
+                    EGLint *out_num_configs)
 {
     struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
-    EGLConfig config = NULL;
-    bool ok = true;
+    struct wcore_config_attrs query;
+    struct wcore_config_candidate *candidates = NULL;
+    EGLConfig *configs = NULL;
+    EGLint num_configs = 0;
+    bool rank = wcore_config_rank_needed(attrs);
 
     if (attrs->accum_buffer) {
         wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
                      "accum buffers do not exist on EGL");
-        return NULL;
+        return false;
     }
 
+    // The MSAA fallback needs every config that some step of it may pick.
+    wcore_config_rank_query_attrs(attrs, &query);
+
     // WARNING: If you resize attrib_list, then update renderable_index.
     const int renderable_index = 19;
 
@@ -153,17 +183,17 @@ choose_real_config(struct wegl_display *dpy,
         //     the color buffer2 For an RGB color buffer, the total is the sum
         //     of EGL_RED_SIZE, EGL_GREEN_SIZE, EGL_BLUE_SIZE, and
         //     EGL_ALPHA_SIZE.
-        EGL_BUFFER_SIZE,            attrs->rgba_size,
-        EGL_RED_SIZE,               attrs->red_size,
-        EGL_GREEN_SIZE,             attrs->green_size,
-        EGL_BLUE_SIZE,              attrs->blue_size,
-        EGL_ALPHA_SIZE,             attrs->alpha_size,
+        EGL_BUFFER_SIZE,            query.rgba_size,
+        EGL_RED_SIZE,               query.red_size,
+        EGL_GREEN_SIZE,             query.green_size,
+        EGL_BLUE_SIZE,              query.blue_size,
+        EGL_ALPHA_SIZE,             query.alpha_size,
 
-        EGL_DEPTH_SIZE,             attrs->depth_size,
-        EGL_STENCIL_SIZE,           attrs->stencil_size,
+        EGL_DEPTH_SIZE,             query.depth_size,
+        EGL_STENCIL_SIZE,           query.stencil_size,
 
-        EGL_SAMPLE_BUFFERS,         attrs->sample_buffers,
-        EGL_SAMPLES,                attrs->samples,
+        EGL_SAMPLE_BUFFERS,         query.sample_buffers,
+        EGL_SAMPLES,                query.samples,
 
         EGL_RENDERABLE_TYPE,        31415926,
 
@@ -190,23 +220,123 @@ choose_real_config(struct wegl_display *dpy,
             break;
         default:
             assert(false);
-            return NULL;
+            return false;
     }
 
-    EGLint num_configs = 0;
-    ok &= plat->eglChooseConfig(dpy->egl,
-                                attrib_list, &config, 1, &num_configs);
-    if (!ok) {
-        wegl_emit_error(plat, "eglChooseConfig");
-        return NULL;
+    if (want_all || rank) {
+        if (!plat->eglChooseConfig(dpy->egl, attrib_list,
+                                   NULL, 0, &num_configs)) {
+            wegl_emit_error(plat, "eglChooseConfig");
+            return false;
+        }
+    } else {
+        num_configs = 1;
     }
-    else if (num_configs == 0) {
-        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
-                     "eglChooseConfig found no matching configs");
+
+    if (num_configs > 0) {
+        configs = wcore_calloc(num_configs * sizeof(*configs));
+        if (!configs)
+            return false;
+
+        if (!plat->eglChooseConfig(dpy->egl, attrib_list,
+                                   configs, num_configs, &num_configs)) {
+            wegl_emit_error(plat, "eglChooseConfig");
+            goto fail;
+        }
+    }
+
+    if (rank && num_configs > 0) {
+        candidates = wcore_calloc(num_configs * sizeof(*candidates));
+        if (!candidates)
+            goto fail;
+
+        for (EGLint i = 0; i < num_configs; ++i) {
+            struct wcore_config_candidate *c = &candidates[i];
+            bool ok = true;
+
+            c->native = configs[i];
+            ok &= plat->eglGetConfigAttrib(dpy->egl, configs[i],
+                                           EGL_BUFFER_SIZE, &c->rgba_size);
+            ok &= plat->eglGetConfigAttrib(dpy->egl, configs[i],
+                                           EGL_DEPTH_SIZE, &c->depth_size);
+            ok &= plat->eglGetConfigAttrib(dpy->egl, configs[i],
+                                           EGL_STENCIL_SIZE, &c->stencil_size);
+            ok &= plat->eglGetConfigAttrib(dpy->egl, configs[i],
+                                           EGL_SAMPLES, &c->samples);
+            if (!ok) {
+                wegl_emit_error(plat, "eglGetConfigAttrib");
+                goto fail;
+            }
+        }
+
+        num_configs = wcore_config_rank(attrs, candidates, num_configs);
+        for (EGLint i = 0; i < num_configs; ++i)
+            configs[i] = candidates[i].native;
+
+        free(candidates);
+    }
+
+    *out_configs = configs;
+    *out_num_configs = num_configs;
+    return true;
+
+fail:
+    free(candidates);
+    free(configs);
+    return false;
+}
+
+static struct wegl_config*
+config_create(struct wegl_display *dpy,
+              const struct wcore_config_attrs *attrs,
+              EGLConfig egl)
+{
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+    struct wegl_config *config;
+
+    config = wcore_calloc(sizeof(*config));
+    if (!config)
         return NULL;
+
+    if (!wcore_config_init(&config->wcore, &dpy->wcore, attrs))
+        goto fail;
+
+    config->egl = egl;
+
+    if (egl != EGL_NO_CONFIG_KHR &&
+        !plat->eglGetConfigAttrib(dpy->egl, config->egl,
+                                  EGL_NATIVE_VISUAL_ID, &config->visual)) {
+        wegl_emit_error(plat, "eglGetConfigAttrib");
+        goto fail;
     }
 
     return config;
+
+fail:
+    wegl_config_destroy(&config->wcore);
+    return NULL;
+}
+
+/// @brief Return the config with the given EGL_CONFIG_ID, or null.
+static EGLConfig
+find_config_by_id(struct wegl_display *dpy, EGLint id)
+{
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+    EGLConfig config = NULL;
+    EGLint num_configs = 0;
+
+    // EGL ignores every other attribute when EGL_CONFIG_ID is given.
+    const EGLint attrib_list[] = {
+        EGL_CONFIG_ID, id,
+        EGL_NONE,
+    };
+
+    if (!plat->eglChooseConfig(dpy->egl, attrib_list,
+                               &config, 1, &num_configs) ||
+        num_configs != 1)
+        return NULL;
+
+    return config;
 }
 
 struct wcore_config*
@@ -214,39 +344,141 @@ wegl_config_choose(struct wcore_platform *wc_plat,
                    struct wcore_display *wc_dpy,
                    const struct wcore_config_attrs *attrs)
 {
-    struct wegl_platform *plat = wegl_platform(wc_plat);
     struct wegl_display *dpy = wegl_display(wc_dpy);
+    struct wegl_platform *plat = wegl_platform(wc_plat);
     struct wegl_config *config;
-    bool ok;
+    EGLConfig *egl_configs = NULL;
+    EGLint num_configs = 0;
+    EGLint id;
 
-    (void) wc_plat;
+    if (!check_context_attrs(dpy, attrs))
+        return NULL;
 
-    config = wcore_calloc(sizeof(*config));
+    if (attrs->no_config) {
+        // EGL_MESA_configless_context predates the KHR extension and uses
+        // the same token.
+        if (!dpy->KHR_no_config_context && !dpy->MESA_configless_context) {
+            wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                         "EGL_KHR_no_config_context or "
+                         "EGL_MESA_configless_context is required in order "
+                         "to request WAFFLE_NO_CONFIG");
+            return NULL;
+        }
+
+        config = config_create(dpy, attrs, EGL_NO_CONFIG_KHR);
+        return config ? &config->wcore : NULL;
+    }
+
+    // An earlier process already chose, and perhaps ranked, the configs of
+    // this driver. If the driver no longer has the config, choose again.
+    if (wcore_caps_cache_get_config_id(&wc_dpy->caps_cache, attrs, &id)) {
+        EGLConfig egl = find_config_by_id(dpy, id);
+        if (egl) {
+            config = config_create(dpy, attrs, egl);
+            return config ? &config->wcore : NULL;
+        }
+    }
+
+    if (!choose_real_configs(dpy, attrs, false, &egl_configs, &num_configs))
+        return NULL;
+
+    if (num_configs == 0) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "eglChooseConfig found no matching configs");
+        free(egl_configs);
+        return NULL;
+    }
+
+    config = config_create(dpy, attrs, egl_configs[0]);
+    free(egl_configs);
     if (!config)
         return NULL;
 
-    ok = wcore_config_init(&config->wcore, wc_dpy, attrs);
-    if (!ok)
-        goto fail;
+    if (plat->eglGetConfigAttrib(dpy->egl, config->egl, EGL_CONFIG_ID, &id))
+        wcore_caps_cache_put_config_id(&wc_dpy->caps_cache, attrs, id);
+
+    return &config->wcore;
+}
+
+bool
+wegl_config_enumerate(struct wcore_platform *wc_plat,
+                      struct wcore_display *wc_dpy,
+                      const struct wcore_config_attrs *attrs,
+                      struct wcore_config *wc_configs[],
+                      int32_t max_configs,
+                      int32_t *num_configs)
+{
+    struct wegl_display *dpy = wegl_display(wc_dpy);
+    EGLConfig *egl_configs = NULL;
+    EGLint num_egl_configs = 0;
+    int32_t n = 0;
+
+    (void) wc_plat;
 
     if (!check_context_attrs(dpy, attrs))
-        goto fail;
+        return false;
 
-    config->egl = choose_real_config(dpy, attrs);
-    if (!config->egl)
-        goto fail;
+    if (!choose_real_configs(dpy, attrs, true, &egl_configs, &num_egl_configs))
+        return false;
 
-    ok = plat->eglGetConfigAttrib(dpy->egl, config->egl,
-                                  EGL_NATIVE_VISUAL_ID, &config->visual);
+    if (!wc_configs) {
+        free(egl_configs);
+        *num_configs = num_egl_configs;
+        return true;
+    }
 
-    if (!ok)
-        goto fail;
+    for (; n < max_configs && n < num_egl_configs; ++n) {
+        struct wegl_config *config =
+            config_create(dpy, attrs, egl_configs[n]);
 
-    return &config->wcore;
+        if (!config) {
+            while (n > 0)
+                wegl_config_destroy(wc_configs[--n]);
+            free(egl_configs);
+            return false;
+        }
 
-fail:
-    wegl_config_destroy(&config->wcore);
-    return NULL;
+        wc_configs[n] = &config->wcore;
+    }
+
+    free(egl_configs);
+    *num_configs = n;
+    return true;
+}
+
+bool
+wegl_config_query(struct wcore_config *wc_config,
+                  int32_t attrib,
+                  intptr_t *value)
+{
+    struct wegl_config *config = wegl_config(wc_config);
+    struct wegl_display *dpy = wegl_display(wc_config->display);
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+    EGLint egl_attrib;
+    EGLint egl_value;
+
+    switch (attrib) {
+        case WAFFLE_RED_SIZE:       egl_attrib = EGL_RED_SIZE; break;
+        case WAFFLE_GREEN_SIZE:     egl_attrib = EGL_GREEN_SIZE; break;
+        case WAFFLE_BLUE_SIZE:      egl_attrib = EGL_BLUE_SIZE; break;
+        case WAFFLE_ALPHA_SIZE:     egl_attrib = EGL_ALPHA_SIZE; break;
+        case WAFFLE_DEPTH_SIZE:     egl_attrib = EGL_DEPTH_SIZE; break;
+        case WAFFLE_STENCIL_SIZE:   egl_attrib = EGL_STENCIL_SIZE; break;
+        case WAFFLE_SAMPLE_BUFFERS: egl_attrib = EGL_SAMPLE_BUFFERS; break;
+        case WAFFLE_SAMPLES:        egl_attrib = EGL_SAMPLES; break;
+        default:
+            wcore_error_bad_attribute(attrib);
+            return false;
+    }
+
+    if (!plat->eglGetConfigAttrib(dpy->egl, config->egl,
+                                  egl_attrib, &egl_value)) {
+        wegl_emit_error(plat, "eglGetConfigAttrib");
+        return false;
+    }
+
+    *value = egl_value;
+    return true;
 }
 
 bool
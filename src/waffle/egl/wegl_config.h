@@ -53,5 +53,18 @@ wegl_config_choose(struct wcore_platform *wc_plat,
                    struct wcore_display *wc_dpy,
                    const struct wcore_config_attrs *attrs);
 
+bool
+wegl_config_enumerate(struct wcore_platform *wc_plat,
+                      struct wcore_display *wc_dpy,
+                      const struct wcore_config_attrs *attrs,
+                      struct wcore_config *wc_configs[],
+                      int32_t max_configs,
+                      int32_t *num_configs);
+
+bool
+wegl_config_query(struct wcore_config *wc_config,
+                  int32_t attrib,
+                  intptr_t *value);
+
 bool
 wegl_config_destroy(struct wcore_config *wc_config);
@@ -162,6 +162,32 @@ create_real_context(struct wegl_config *config,
             return EGL_NO_CONTEXT;
     }
 
+    if (attrs->context_no_error) {
+        // Unlike the debug and robust access bits, this is a standalone
+        // attribute and applies to both OpenGL and OpenGL ES.
+        assert(dpy->KHR_create_context_no_error);
+        attrib_list[i++] = EGL_CONTEXT_OPENGL_NO_ERROR_KHR;
+        attrib_list[i++] = EGL_TRUE;
+    }
+
+    // The priority is only a hint, so without the extension we create an
+    // ordinary context and let waffle_context_query() report it.
+    if (attrs->context_priority != WAFFLE_CONTEXT_PRIORITY_MEDIUM &&
+        dpy->IMG_context_priority) {
+        attrib_list[i++] = EGL_CONTEXT_PRIORITY_LEVEL_IMG;
+        attrib_list[i++] =
+            attrs->context_priority == WAFFLE_CONTEXT_PRIORITY_HIGH
+                ? EGL_CONTEXT_PRIORITY_HIGH_IMG
+                : EGL_CONTEXT_PRIORITY_LOW_IMG;
+    }
+
+    // Flush is the default, so only pass the attribute when it differs.
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE) {
+        assert(dpy->KHR_context_flush_control);
+        attrib_list[i++] = EGL_CONTEXT_RELEASE_BEHAVIOR_KHR;
+        attrib_list[i++] = EGL_CONTEXT_RELEASE_BEHAVIOR_NONE_KHR;
+    }
+
     if (context_flags != 0) {
         attrib_list[i++] = EGL_CONTEXT_FLAGS_KHR;
         attrib_list[i++] = context_flags;
@@ -262,3 +288,48 @@ wegl_context_destroy(struct wcore_context *wc_ctx)
     }
     return result;
 }
+
+bool
+wegl_context_query(struct wcore_context *wc_ctx,
+                   int32_t attrib,
+                   intptr_t *value)
+{
+    struct wegl_context *ctx = wegl_context(wc_ctx);
+    struct wegl_display *dpy = wegl_display(wc_ctx->display);
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+    EGLint level;
+
+    switch (attrib) {
+        case WAFFLE_CONTEXT_PRIORITY:
+            // Without the extension every context has the default priority.
+            if (!dpy->IMG_context_priority) {
+                *value = WAFFLE_CONTEXT_PRIORITY_MEDIUM;
+                return true;
+            }
+
+            // The driver may grant less than was requested, so ask rather
+            // than echo the config.
+            if (!plat->eglQueryContext(dpy->egl, ctx->egl,
+                                       EGL_CONTEXT_PRIORITY_LEVEL_IMG,
+                                       &level)) {
+                wegl_emit_error(plat, "eglQueryContext");
+                return false;
+            }
+
+            switch (level) {
+                case EGL_CONTEXT_PRIORITY_HIGH_IMG:
+                    *value = WAFFLE_CONTEXT_PRIORITY_HIGH;
+                    break;
+                case EGL_CONTEXT_PRIORITY_LOW_IMG:
+                    *value = WAFFLE_CONTEXT_PRIORITY_LOW;
+                    break;
+                default:
+                    *value = WAFFLE_CONTEXT_PRIORITY_MEDIUM;
+                    break;
+            }
+            return true;
+        default:
+            wcore_error_bad_attribute(attrib);
+            return false;
+    }
+}
@@ -58,3 +58,8 @@ wegl_context_create(struct wcore_platform *wc_plat,
 
 bool
 wegl_context_destroy(struct wcore_context *wc_ctx);
+
+bool
+wegl_context_query(struct wcore_context *wc_ctx,
+                   int32_t attrib,
+                   intptr_t *value);
@@ -24,9 +24,18 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
 
+#ifdef __linux__
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#endif
+
+#include "wcore_caps_cache.h"
 #include "wcore_error.h"
 #include "wcore_platform.h"
+#include "wcore_util.h"
 
 #include "wegl_display.h"
 #include "wegl_imports.h"
@@ -72,6 +81,7 @@ static bool
 get_extensions(struct wegl_display *dpy)
 {
     struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+    struct wcore_ext_set *set = &dpy->wcore.extensions;
     const char *extensions = plat->eglQueryString(dpy->egl, EGL_EXTENSIONS);
 
     if (!extensions) {
@@ -79,23 +89,69 @@ get_extensions(struct wegl_display *dpy)
         return false;
     }
 
-    // waffle_is_extension_in_string() resets the error state. That's ok,
-    // however, because if we've reached this point then no error should be
-    // pending emission.
-    assert(wcore_error_get_code() == 0);
+    // Parse the strings once, here, rather than rescanning them for each
+    // extension that Waffle or the user asks about. The client extensions
+    // are included so that waffle_display_has_extension() reports the
+    // platform extensions too.
+    if (!wcore_ext_set_add_string(set, extensions))
+        return false;
+
+    if (!wcore_ext_set_add_string(set, plat->client_extensions))
+        return false;
 
 #define CHECK_EXTENSION(ext) \
-    dpy->ext = waffle_is_extension_in_string(extensions, "EGL_" #ext)
+    dpy->ext = wcore_ext_set_has(set, "EGL_" #ext)
 
     CHECK_EXTENSION(EXT_create_context_robustness);
     CHECK_EXTENSION(KHR_create_context);
+    CHECK_EXTENSION(KHR_create_context_no_error);
+    CHECK_EXTENSION(KHR_context_flush_control);
+    CHECK_EXTENSION(IMG_context_priority);
+    CHECK_EXTENSION(KHR_swap_buffers_with_damage);
+    CHECK_EXTENSION(EXT_swap_buffers_with_damage);
+    CHECK_EXTENSION(EXT_buffer_age);
+    CHECK_EXTENSION(KHR_partial_update);
+    CHECK_EXTENSION(KHR_fence_sync);
+    CHECK_EXTENSION(KHR_wait_sync);
+    CHECK_EXTENSION(ANDROID_native_fence_sync);
+    CHECK_EXTENSION(KHR_surfaceless_context);
+    CHECK_EXTENSION(KHR_no_config_context);
+    CHECK_EXTENSION(MESA_configless_context);
     CHECK_EXTENSION(EXT_image_dma_buf_import_modifiers);
 
 #undef CHECK_EXTENSION
 
+    dpy->wcore.proc_address_includes_core =
+        (dpy->major_version == 1 && dpy->minor_version >= 5) ||
+        wcore_ext_set_has(set, "EGL_KHR_get_all_proc_addresses") ||
+        wcore_ext_set_has(set, "EGL_KHR_client_get_all_proc_addresses");
+
     return true;
 }
 
+/// Identify the driver by the strings it reports and by the libraries it
+/// loaded.
+static uint64_t
+get_driver_id(struct wegl_display *dpy)
+{
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+    static const EGLint names[] = {
+        EGL_VENDOR,
+        EGL_VERSION,
+        EGL_CLIENT_APIS,
+        EGL_EXTENSIONS,
+    };
+    uint64_t id = 0;
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+        id = wcore_caps_hash_string(id, plat->eglQueryString(dpy->egl,
+                                                             names[i]));
+
+    id = wcore_caps_hash_string(id, plat->client_extensions);
+    id = wcore_caps_hash_driver_files(id);
+    return id ? id : 1;
+}
+
 /// On Linux, according to eglplatform.h, EGLNativeDisplayType and intptr_t
 /// have the same size regardless of platform.
 bool
@@ -146,6 +202,10 @@ wegl_display_init(struct wegl_display *dpy,
     if (!ok)
         goto fail;
 
+    // Only when needed, because this stats the driver's files.
+    if (wc_plat->caps_cache_path)
+        dpy->wcore.driver_id = get_driver_id(dpy);
+
     return true;
 
 fail:
@@ -165,6 +225,7 @@ wegl_display_teardown(struct wegl_display *dpy)
             wegl_emit_error(plat, "eglTerminate");
     }
 
+    ok &= wcore_display_teardown(&dpy->wcore);
     return ok;
 }
 
@@ -188,3 +249,166 @@ wegl_display_supports_context_api(struct wcore_display *wc_dpy,
             return false;
     }
 }
+
+/// Return the EGLDeviceEXT that backs the display, or EGL_NO_DEVICE_EXT if
+/// EGL cannot tell.
+static EGLDeviceEXT
+get_device(struct wegl_display *dpy)
+{
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+    struct wcore_ext_set *set = &dpy->wcore.extensions;
+    EGLAttrib device;
+
+    if (!plat->eglQueryDisplayAttribEXT || !plat->eglQueryDeviceStringEXT)
+        return EGL_NO_DEVICE_EXT;
+
+    if (!wcore_ext_set_has(set, "EGL_EXT_device_query") &&
+        !wcore_ext_set_has(set, "EGL_EXT_device_base"))
+        return EGL_NO_DEVICE_EXT;
+
+    if (!plat->eglQueryDisplayAttribEXT(dpy->egl, EGL_DEVICE_EXT, &device))
+        return EGL_NO_DEVICE_EXT;
+
+    return (EGLDeviceEXT) device;
+}
+
+/// Return the device's DRM node, preferring the render node, or null if it
+/// has none.
+static const char*
+get_drm_node(struct wegl_platform *plat, EGLDeviceEXT device,
+             const char *exts)
+{
+    const char *node = NULL;
+
+    if (waffle_is_extension_in_string(exts, "EGL_EXT_device_drm_render_node"))
+        node = plat->eglQueryDeviceStringEXT(device,
+                                             EGL_DRM_RENDER_NODE_FILE_EXT);
+
+    if (!node && waffle_is_extension_in_string(exts, "EGL_EXT_device_drm"))
+        node = plat->eglQueryDeviceStringEXT(device, EGL_DRM_DEVICE_FILE_EXT);
+
+    return node;
+}
+
+/// Read a number from the sysfs attribute @a name of the device behind the
+/// DRM node @a node.
+static bool
+read_drm_sysfs(const char *node, const char *name, int64_t *value)
+{
+#ifdef __linux__
+    struct stat st;
+    char path[256];
+    FILE *file;
+    bool ok;
+
+    if (stat(node, &st) != 0 || !S_ISCHR(st.st_mode))
+        return false;
+
+    snprintf(path, sizeof(path), "/sys/dev/char/%u:%u/device/%s",
+             major(st.st_rdev), minor(st.st_rdev), name);
+
+    file = fopen(path, "r");
+    if (!file)
+        return false;
+
+    // The PCI IDs are hexadecimal with a 0x prefix; sizes are decimal.
+    ok = fscanf(file, "%" SCNi64, value) == 1 && *value >= 0;
+    fclose(file);
+    return ok;
+#else
+    (void) node;
+    (void) name;
+    (void) value;
+    return false;
+#endif
+}
+
+/// EGL has no counterpart to GLX_MESA_query_renderer. The device attributes
+/// come from the display's EGLDeviceEXT and, on Linux, from sysfs. EGL
+/// cannot report the highest version of an API without creating contexts,
+/// so the versions are known only for APIs the display lacks. The
+/// capability cache has only a lower bound, which
+/// waffle_display_query_capability() reports.
+bool
+wegl_display_query_renderer(struct wcore_display *wc_dpy,
+                            int32_t attrib,
+                            intptr_t *value)
+{
+    struct wegl_display *dpy = wegl_display(wc_dpy);
+    struct wegl_platform *plat = wegl_platform(wc_dpy->platform);
+    EGLDeviceEXT device = EGL_NO_DEVICE_EXT;
+    const char *exts = NULL;
+    const char *node = NULL;
+    int64_t n;
+
+    switch (attrib) {
+        case WAFFLE_RENDERER_VENDOR_ID:
+        case WAFFLE_RENDERER_DEVICE_ID:
+        case WAFFLE_RENDERER_VIDEO_MEMORY:
+        case WAFFLE_RENDERER_ACCELERATED:
+            device = get_device(dpy);
+            if (device != EGL_NO_DEVICE_EXT)
+                exts = plat->eglQueryDeviceStringEXT(device, EGL_EXTENSIONS);
+            if (!exts) {
+                wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                             "%s requires EGL_EXT_device_query",
+                             wcore_enum_to_string(attrib));
+                return false;
+            }
+            node = get_drm_node(plat, device, exts);
+            break;
+    }
+
+    switch (attrib) {
+        case WAFFLE_RENDERER_VENDOR_ID:
+            if (!node || !read_drm_sysfs(node, "vendor", &n))
+                goto unknown_device;
+            *value = (intptr_t) n;
+            return true;
+        case WAFFLE_RENDERER_DEVICE_ID:
+            if (!node || !read_drm_sysfs(node, "device", &n))
+                goto unknown_device;
+            *value = (intptr_t) n;
+            return true;
+        case WAFFLE_RENDERER_VIDEO_MEMORY:
+            // Only amdgpu reports its dedicated memory.
+            if (!node || !read_drm_sysfs(node, "mem_info_vram_total", &n))
+                goto unknown_device;
+            *value = (intptr_t) (n >> 20);
+            return true;
+        case WAFFLE_RENDERER_ACCELERATED:
+            *value = node != NULL &&
+                     !waffle_is_extension_in_string(exts,
+                                                    "EGL_MESA_device_software");
+            return true;
+        case WAFFLE_RENDERER_OPENGL_CORE_PROFILE_VERSION:
+        case WAFFLE_RENDERER_OPENGL_COMPATIBILITY_PROFILE_VERSION:
+            if (!(dpy->api_mask & WEGL_OPENGL_API)) {
+                *value = 0;
+                return true;
+            }
+            goto unknown_version;
+        case WAFFLE_RENDERER_OPENGL_ES_PROFILE_VERSION:
+        case WAFFLE_RENDERER_OPENGL_ES2_PROFILE_VERSION:
+            if (!(dpy->api_mask & WEGL_OPENGL_ES_API)) {
+                *value = 0;
+                return true;
+            }
+            goto unknown_version;
+        default:
+            wcore_error_bad_attribute(attrib);
+            return false;
+    }
+
+unknown_version:
+    wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                 "EGL cannot report %s without creating contexts",
+                 wcore_enum_to_string(attrib));
+    return false;
+
+unknown_device:
+    wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                 "the EGL device does not report %s",
+                 wcore_enum_to_string(attrib));
+    return false;
+}
@@ -45,6 +45,19 @@ struct wegl_display {
     enum wegl_supported_api api_mask;
     bool EXT_create_context_robustness;
     bool KHR_create_context;
+    bool KHR_create_context_no_error;
+    bool KHR_context_flush_control;
+    bool IMG_context_priority;
+    bool KHR_swap_buffers_with_damage;
+    bool EXT_swap_buffers_with_damage;
+    bool EXT_buffer_age;
+    bool KHR_partial_update;
+    bool KHR_fence_sync;
+    bool KHR_wait_sync;
+    bool ANDROID_native_fence_sync;
+    bool KHR_surfaceless_context;
+    bool KHR_no_config_context;
+    bool MESA_configless_context;
     bool EXT_image_dma_buf_import_modifiers;
     EGLint major_version;
     EGLint minor_version;
@@ -66,3 +79,8 @@ wegl_display_teardown(struct wegl_display *dpy);
 bool
 wegl_display_supports_context_api(struct wcore_display *wc_dpy,
                                   int32_t waffle_context_api);
+
+bool
+wegl_display_query_renderer(struct wcore_display *wc_dpy,
+                            int32_t attrib,
+                            intptr_t *value);
@@ -0,0 +1,253 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "wcore_error.h"
+
+#include "wegl_display.h"
+#include "wegl_fence.h"
+#include "wegl_platform.h"
+#include "wegl_util.h"
+
+bool
+wegl_fence_check_display(struct wcore_platform *wc_plat,
+                         struct wcore_display *wc_dpy)
+{
+    struct wegl_platform *plat = wegl_platform(wc_plat);
+    struct wegl_display *dpy = wegl_display(wc_dpy);
+
+    if (!dpy->KHR_fence_sync || !plat->eglCreateSyncKHR) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_KHR_fence_sync is not supported");
+        return false;
+    }
+
+    return true;
+}
+
+static struct wcore_fence*
+create_fence(struct wcore_platform *wc_plat,
+             struct wcore_display *wc_dpy,
+             struct wcore_context *wc_ctx,
+             bool native)
+{
+    struct wegl_platform *plat = wegl_platform(wc_plat);
+    struct wegl_display *dpy = wegl_display(wc_dpy);
+    struct wegl_fence *self;
+
+    if (!wegl_fence_check_display(wc_plat, wc_dpy))
+        return NULL;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    wcore_fence_init(&self->wcore, wc_dpy, wc_ctx);
+    self->native = native;
+
+    // The fence goes into the context current to the calling thread.
+    self->egl = plat->eglCreateSyncKHR(dpy->egl,
+                                       self->native
+                                           ? EGL_SYNC_NATIVE_FENCE_ANDROID
+                                           : EGL_SYNC_FENCE_KHR,
+                                       NULL);
+    if (self->egl == EGL_NO_SYNC_KHR) {
+        wegl_emit_error(plat, "eglCreateSyncKHR");
+        free(self);
+        return NULL;
+    }
+
+    return &self->wcore;
+}
+
+struct wcore_fence*
+wegl_fence_create(struct wcore_platform *wc_plat,
+                  struct wcore_display *wc_dpy,
+                  struct wcore_context *wc_ctx)
+{
+    return create_fence(wc_plat, wc_dpy, wc_ctx, false);
+}
+
+struct wcore_fence*
+wegl_fence_create_exportable(struct wcore_platform *wc_plat,
+                             struct wcore_display *wc_dpy,
+                             struct wcore_context *wc_ctx)
+{
+    struct wegl_platform *plat = wegl_platform(wc_plat);
+    struct wegl_display *dpy = wegl_display(wc_dpy);
+
+    // A native fence holds a file descriptor, but otherwise behaves as a
+    // plain one, which is all some displays offer.
+    return create_fence(wc_plat, wc_dpy, wc_ctx,
+                        dpy->ANDROID_native_fence_sync &&
+                        plat->eglDupNativeFenceFDANDROID);
+}
+
+bool
+wegl_fence_destroy(struct wcore_fence *wc_fence)
+{
+    struct wegl_fence *self = wegl_fence(wc_fence);
+    struct wegl_display *dpy;
+    struct wegl_platform *plat;
+    bool ok = true;
+
+    if (!self)
+        return true;
+
+    dpy = wegl_display(self->wcore.display);
+    plat = wegl_platform(dpy->wcore.platform);
+
+    if (!plat->eglDestroySyncKHR(dpy->egl, self->egl)) {
+        wegl_emit_error(plat, "eglDestroySyncKHR");
+        ok = false;
+    }
+
+    ok &= wcore_fence_teardown(&self->wcore);
+    free(self);
+    return ok;
+}
+
+bool
+wegl_fence_client_wait(struct wcore_fence *wc_fence,
+                       uint64_t timeout,
+                       bool *signaled)
+{
+    struct wegl_fence *self = wegl_fence(wc_fence);
+    struct wegl_display *dpy = wegl_display(self->wcore.display);
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+    EGLint result;
+
+    // EGL_FOREVER_KHR is UINT64_MAX, as Waffle's timeout.
+    result = plat->eglClientWaitSyncKHR(dpy->egl, self->egl,
+                                        EGL_SYNC_FLUSH_COMMANDS_BIT_KHR,
+                                        (EGLTimeKHR) timeout);
+    switch (result) {
+        case EGL_CONDITION_SATISFIED_KHR:
+            *signaled = true;
+            return true;
+        case EGL_TIMEOUT_EXPIRED_KHR:
+            *signaled = false;
+            return true;
+        default:
+            wegl_emit_error(plat, "eglClientWaitSyncKHR");
+            return false;
+    }
+}
+
+bool
+wegl_fence_server_wait(struct wcore_fence *wc_fence)
+{
+    struct wegl_fence *self = wegl_fence(wc_fence);
+    struct wegl_display *dpy = wegl_display(self->wcore.display);
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+
+    if (!dpy->KHR_wait_sync || !plat->eglWaitSyncKHR) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_KHR_wait_sync is not supported");
+        return false;
+    }
+
+    if (!plat->eglWaitSyncKHR(dpy->egl, self->egl, 0)) {
+        wegl_emit_error(plat, "eglWaitSyncKHR");
+        return false;
+    }
+
+    return true;
+}
+
+bool
+wegl_fence_export_fd(struct wcore_fence *wc_fence, int *fd)
+{
+    struct wegl_fence *self = wegl_fence(wc_fence);
+    struct wegl_display *dpy = wegl_display(self->wcore.display);
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+
+    if (!self->native) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_ANDROID_native_fence_sync is not supported");
+        return false;
+    }
+
+    // The fence has no file descriptor until its context is flushed.
+    // Polling the fence with the flush bit does that without needing GL.
+    if (plat->eglClientWaitSyncKHR(dpy->egl, self->egl,
+                                   EGL_SYNC_FLUSH_COMMANDS_BIT_KHR,
+                                   0) == EGL_FALSE) {
+        wegl_emit_error(plat, "eglClientWaitSyncKHR");
+        return false;
+    }
+
+    *fd = plat->eglDupNativeFenceFDANDROID(dpy->egl, self->egl);
+    if (*fd == EGL_NO_NATIVE_FENCE_FD_ANDROID) {
+        wegl_emit_error(plat, "eglDupNativeFenceFDANDROID");
+        return false;
+    }
+
+    return true;
+}
+
+struct wcore_fence*
+wegl_fence_import_fd(struct wcore_platform *wc_plat,
+                     struct wcore_display *wc_dpy,
+                     struct wcore_context *wc_ctx,
+                     int fd)
+{
+    struct wegl_platform *plat = wegl_platform(wc_plat);
+    struct wegl_display *dpy = wegl_display(wc_dpy);
+    struct wegl_fence *self;
+
+    const EGLint attrib_list[] = {
+        EGL_SYNC_NATIVE_FENCE_FD_ANDROID, fd,
+        EGL_NONE,
+    };
+
+    if (!dpy->KHR_fence_sync || !plat->eglCreateSyncKHR ||
+        !dpy->ANDROID_native_fence_sync ||
+        !plat->eglDupNativeFenceFDANDROID) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_ANDROID_native_fence_sync is not supported");
+        return NULL;
+    }
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    wcore_fence_init(&self->wcore, wc_dpy, wc_ctx);
+    self->native = true;
+
+    // EGL takes ownership of fd only if the sync is created.
+    self->egl = plat->eglCreateSyncKHR(dpy->egl,
+                                       EGL_SYNC_NATIVE_FENCE_ANDROID,
+                                       attrib_list);
+    if (self->egl == EGL_NO_SYNC_KHR) {
+        wegl_emit_error(plat, "eglCreateSyncKHR");
+        free(self);
+        return NULL;
+    }
+
+    return &self->wcore;
+}
@@ -56,6 +56,31 @@ typedef intptr_t EGLAttrib;
 #define EGL_OPENGL_ES3_BIT_KHR                              0x00000040
 #endif
 
+#ifndef EGL_KHR_create_context_no_error
+#define EGL_KHR_create_context_no_error 1
+#define EGL_CONTEXT_OPENGL_NO_ERROR_KHR                     0x31B3
+#endif
+
+#ifndef EGL_KHR_context_flush_control
+#define EGL_KHR_context_flush_control 1
+#define EGL_CONTEXT_RELEASE_BEHAVIOR_NONE_KHR               0
+#define EGL_CONTEXT_RELEASE_BEHAVIOR_KHR                    0x2097
+#define EGL_CONTEXT_RELEASE_BEHAVIOR_FLUSH_KHR              0x2098
+#endif
+
+#ifndef EGL_IMG_context_priority
+#define EGL_IMG_context_priority 1
+#define EGL_CONTEXT_PRIORITY_LEVEL_IMG                      0x3100
+#define EGL_CONTEXT_PRIORITY_HIGH_IMG                       0x3101
+#define EGL_CONTEXT_PRIORITY_MEDIUM_IMG                     0x3102
+#define EGL_CONTEXT_PRIORITY_LOW_IMG                        0x3103
+#endif
+
+#ifndef EGL_EXT_buffer_age
+#define EGL_EXT_buffer_age 1
+#define EGL_BUFFER_AGE_EXT                                  0x313D
+#endif
+
 #ifndef EGL_KHR_platform_android
 #define EGL_KHR_platform_android 1
 #define EGL_PLATFORM_ANDROID_KHR          0x3141
@@ -81,3 +106,41 @@ typedef intptr_t EGLAttrib;
 #define EGL_MESA_platform_surfaceless 1
 #define EGL_PLATFORM_SURFACELESS_MESA     0x31DD
 #endif /* EGL_MESA_platform_surfaceless */
+
+#ifndef EGL_KHR_no_config_context
+#define EGL_KHR_no_config_context 1
+#define EGL_NO_CONFIG_KHR                 ((EGLConfig)0)
+#endif /* EGL_KHR_no_config_context */
+
+#ifndef EGL_ANDROID_native_fence_sync
+#define EGL_ANDROID_native_fence_sync 1
+#define EGL_SYNC_NATIVE_FENCE_ANDROID     0x3144
+#define EGL_SYNC_NATIVE_FENCE_FD_ANDROID  0x3145
+#define EGL_NO_NATIVE_FENCE_FD_ANDROID    -1
+#endif /* EGL_ANDROID_native_fence_sync */
+
+#ifndef EGL_EXT_device_base
+#define EGL_EXT_device_base 1
+typedef void *EGLDeviceEXT;
+#define EGL_NO_DEVICE_EXT                 ((EGLDeviceEXT)(0))
+#endif /* EGL_EXT_device_base */
+
+#ifndef EGL_EXT_platform_device
+#define EGL_EXT_platform_device 1
+#define EGL_PLATFORM_DEVICE_EXT           0x313F
+#endif /* EGL_EXT_platform_device */
+
+#ifndef EGL_EXT_device_query
+#define EGL_EXT_device_query 1
+#define EGL_DEVICE_EXT                    0x322C
+#endif /* EGL_EXT_device_query */
+
+#ifndef EGL_EXT_device_drm
+#define EGL_EXT_device_drm 1
+#define EGL_DRM_DEVICE_FILE_EXT           0x3233
+#endif /* EGL_EXT_device_drm */
+
+#ifndef EGL_EXT_device_drm_render_node
+#define EGL_EXT_device_drm_render_node 1
+#define EGL_DRM_RENDER_NODE_FILE_EXT      0x3377
+#endif /* EGL_EXT_device_drm_render_node */
@@ -57,6 +57,9 @@ setup_env(const struct wegl_platform *self)
         case EGL_PLATFORM_SURFACELESS_MESA:
             setenv("EGL_PLATFORM", "surfaceless", true);
             break;
+        case EGL_PLATFORM_DEVICE_EXT:
+            setenv("EGL_PLATFORM", "device", true);
+            break;
         case EGL_NONE:
             break;
         default:
@@ -77,6 +80,8 @@ wegl_platform_teardown(struct wegl_platform *self)
         unsetenv("EGL_PLATFORM");
     }
 
+    wcore_ext_set_finish(&self->client_extension_set);
+
     if (self->eglHandle) {
         error = dlclose(self->eglHandle);
         if (error) {
@@ -145,6 +150,9 @@ wegl_platform_init(struct wegl_platform *self, EGLenum egl_platform)
 
     RETRIEVE_EGL_SYMBOL(eglMakeCurrent);
     RETRIEVE_EGL_SYMBOL(eglGetProcAddress);
+    RETRIEVE_EGL_SYMBOL(eglGetCurrentDisplay);
+    RETRIEVE_EGL_SYMBOL(eglGetCurrentSurface);
+    RETRIEVE_EGL_SYMBOL(eglGetCurrentContext);
 
     // display
     RETRIEVE_EGL_SYMBOL(eglGetDisplay);
@@ -160,6 +168,7 @@ wegl_platform_init(struct wegl_platform *self, EGLenum egl_platform)
     RETRIEVE_EGL_SYMBOL(eglBindAPI);
     RETRIEVE_EGL_SYMBOL(eglCreateContext);
     RETRIEVE_EGL_SYMBOL(eglDestroyContext);
+    RETRIEVE_EGL_SYMBOL(eglQueryContext);
 
     // window
     RETRIEVE_EGL_SYMBOL(eglGetConfigAttrib);
@@ -167,6 +176,8 @@ wegl_platform_init(struct wegl_platform *self, EGLenum egl_platform)
     RETRIEVE_EGL_SYMBOL(eglCreatePbufferSurface);
     RETRIEVE_EGL_SYMBOL(eglDestroySurface);
     RETRIEVE_EGL_SYMBOL(eglSwapBuffers);
+    RETRIEVE_EGL_SYMBOL(eglSwapInterval);
+    RETRIEVE_EGL_SYMBOL(eglQuerySurface);
 
     // EGL 1.5
     RETRIEVE_EGL_SYMBOL_OPTIONAL(eglGetPlatformDisplay);
@@ -174,6 +185,33 @@ wegl_platform_init(struct wegl_platform *self, EGLenum egl_platform)
     // EGL_EXT_platform_display
     RETRIEVE_EGL_SYMBOL_OPTIONAL(eglGetPlatformDisplayEXT);
 
+    // EGL_EXT_device_enumeration
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglQueryDevicesEXT);
+
+    // EGL_EXT_device_query
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglQueryDeviceStringEXT);
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglQueryDisplayAttribEXT);
+
+    // EGL_KHR_swap_buffers_with_damage
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglSwapBuffersWithDamageKHR);
+
+    // EGL_EXT_swap_buffers_with_damage
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglSwapBuffersWithDamageEXT);
+
+    // EGL_KHR_partial_update
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglSetDamageRegionKHR);
+
+    // EGL_KHR_fence_sync
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglCreateSyncKHR);
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglDestroySyncKHR);
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglClientWaitSyncKHR);
+
+    // EGL_KHR_wait_sync
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglWaitSyncKHR);
+
+    // EGL_ANDROID_native_fence_sync
+    RETRIEVE_EGL_SYMBOL_OPTIONAL(eglDupNativeFenceFDANDROID);
+
     // EGL_EXT_image_dma_buf_import_modifiers
     RETRIEVE_EGL_SYMBOL_OPTIONAL(eglQueryDmaBufFormatsEXT);
     RETRIEVE_EGL_SYMBOL_OPTIONAL(eglQueryDmaBufModifiersEXT);
@@ -184,6 +222,13 @@ wegl_platform_init(struct wegl_platform *self, EGLenum egl_platform)
     self->client_extensions =
         self->eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
 
+    // EGL_EXT_client_extensions may be unsupported, in which case
+    // client_extensions is null and the set remains empty.
+    ok = wcore_ext_set_add_string(&self->client_extension_set,
+                                  self->client_extensions);
+    if (!ok)
+        goto error;
+
     if (!wegl_platform_can_use_eglGetPlatformDisplay(self) &&
         !wegl_platform_can_use_eglGetPlatformDisplayEXT(self)) {
         setup_env(self);
@@ -219,6 +264,9 @@ wegl_platform_can_use_eglGetPlatformDisplay(const struct wegl_platform *plat)
         case EGL_PLATFORM_SURFACELESS_MESA:
             ext = "EGL_MESA_platform_surfaceless";
             break;
+        case EGL_PLATFORM_DEVICE_EXT:
+            ext = "EGL_EXT_platform_device";
+            break;
         case EGL_NONE:
             ext = NULL;
             break;
@@ -227,7 +275,7 @@ wegl_platform_can_use_eglGetPlatformDisplay(const struct wegl_platform *plat)
             return false;
     }
 
-    return waffle_is_extension_in_string(plat->client_extensions, ext);
+    return wcore_ext_set_has(&plat->client_extension_set, ext);
 }
 
 bool
@@ -254,6 +302,9 @@ wegl_platform_can_use_eglGetPlatformDisplayEXT(const struct wegl_platform *plat)
         case EGL_PLATFORM_SURFACELESS_MESA:
             ext = "EGL_MESA_platform_surfaceless";
             break;
+        case EGL_PLATFORM_DEVICE_EXT:
+            ext = "EGL_EXT_platform_device";
+            break;
         case EGL_NONE:
             ext = NULL;
             break;
@@ -262,5 +313,5 @@ wegl_platform_can_use_eglGetPlatformDisplayEXT(const struct wegl_platform *plat)
             return false;
     }
 
-    return waffle_is_extension_in_string(plat->client_extensions, ext);
+    return wcore_ext_set_has(&plat->client_extension_set, ext);
 }
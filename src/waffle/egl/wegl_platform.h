@@ -27,6 +27,7 @@
 
 #include <EGL/egl.h>
 
+#include "wcore_ext_set.h"
 #include "wcore_platform.h"
 #include "wcore_util.h"
 
@@ -55,10 +56,16 @@ struct wegl_platform {
     // See https://www.khronos.org/registry/egl/extensions/EXT/EGL_EXT_client_extensions.txt
     const char *client_extensions;
 
+    // Hashed copy of client_extensions.
+    struct wcore_ext_set client_extension_set;
+
     EGLBoolean (*eglMakeCurrent)(EGLDisplay dpy, EGLSurface draw,
                                  EGLSurface read, EGLContext ctx);
     __eglMustCastToProperFunctionPointerType
        (*eglGetProcAddress)(const char *procname);
+    EGLDisplay (*eglGetCurrentDisplay)(void);
+    EGLSurface (*eglGetCurrentSurface)(EGLint readdraw);
+    EGLContext (*eglGetCurrentContext)(void);
 
     // EGL 1.5
     EGLDisplay (*eglGetPlatformDisplay)(EGLenum platform, void *native_display,
@@ -82,6 +89,8 @@ struct wegl_platform {
                                    EGLContext share_context,
                                    const EGLint *attrib_list);
     EGLBoolean (*eglDestroyContext)(EGLDisplay dpy, EGLContext ctx);
+    EGLBoolean (*eglQueryContext)(EGLDisplay dpy, EGLContext ctx,
+                                  EGLint attribute, EGLint *value);
 
     // window
     EGLBoolean (*eglGetConfigAttrib)(EGLDisplay dpy, EGLConfig config,
@@ -93,11 +102,55 @@ struct wegl_platform {
                                           const EGLint *attrib_list);
     EGLBoolean (*eglDestroySurface)(EGLDisplay dpy, EGLSurface surface);
     EGLBoolean (*eglSwapBuffers)(EGLDisplay dpy, EGLSurface surface);
+    EGLBoolean (*eglSwapInterval)(EGLDisplay dpy, EGLint interval);
+    EGLBoolean (*eglQuerySurface)(EGLDisplay dpy, EGLSurface surface,
+                                  EGLint attribute, EGLint *value);
 
     // EGL_EXT_platform_display
     EGLDisplay (*eglGetPlatformDisplayEXT)(EGLenum platform, void *native_display,
                                            const EGLint *attrib_list);
 
+    // EGL_EXT_device_enumeration
+    EGLBoolean (*eglQueryDevicesEXT)(EGLint max_devices,
+                                     EGLDeviceEXT *devices,
+                                     EGLint *num_devices);
+
+    // EGL_EXT_device_query
+    const char * (*eglQueryDeviceStringEXT)(EGLDeviceEXT device,
+                                            EGLint name);
+    EGLBoolean (*eglQueryDisplayAttribEXT)(EGLDisplay dpy,
+                                           EGLint attribute,
+                                           EGLAttrib *value);
+
+    // EGL_KHR_swap_buffers_with_damage
+    EGLBoolean (*eglSwapBuffersWithDamageKHR)(EGLDisplay dpy,
+                                              EGLSurface surface,
+                                              const EGLint *rects,
+                                              EGLint n_rects);
+
+    // EGL_EXT_swap_buffers_with_damage
+    EGLBoolean (*eglSwapBuffersWithDamageEXT)(EGLDisplay dpy,
+                                              EGLSurface surface,
+                                              const EGLint *rects,
+                                              EGLint n_rects);
+
+    // EGL_KHR_partial_update
+    EGLBoolean (*eglSetDamageRegionKHR)(EGLDisplay dpy, EGLSurface surface,
+                                        EGLint *rects, EGLint n_rects);
+
+    // EGL_KHR_fence_sync
+    EGLSyncKHR (*eglCreateSyncKHR)(EGLDisplay dpy, EGLenum type,
+                                   const EGLint *attrib_list);
+    EGLBoolean (*eglDestroySyncKHR)(EGLDisplay dpy, EGLSyncKHR sync);
+    EGLint (*eglClientWaitSyncKHR)(EGLDisplay dpy, EGLSyncKHR sync,
+                                   EGLint flags, EGLTimeKHR timeout);
+
+    // EGL_KHR_wait_sync
+    EGLint (*eglWaitSyncKHR)(EGLDisplay dpy, EGLSyncKHR sync, EGLint flags);
+
+    // EGL_ANDROID_native_fence_sync
+    EGLint (*eglDupNativeFenceFDANDROID)(EGLDisplay dpy, EGLSyncKHR sync);
+
     // EGL_EXT_image_dma_buf_import_modifiers
     EGLBoolean (*eglQueryDmaBufFormatsEXT)(EGLDisplay dpy,
                                            EGLint max_formats,
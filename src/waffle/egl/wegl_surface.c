@@ -23,6 +23,9 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include "wcore_error.h"
+#include "wcore_tinfo.h"
+
 #include "wegl_config.h"
 #include "wegl_display.h"
 #include "wegl_imports.h"
@@ -66,6 +69,12 @@ wegl_window_init(struct wegl_surface *surf,
         goto fail;
     }
 
+    // The interval belongs to the EGLSurface. Reapply it if the native
+    // surface was recreated, as on resize.
+    mtx_lock(&surf->wcore.swap_interval_mutex);
+    surf->wcore.swap_interval_dirty = surf->wcore.has_swap_interval;
+    mtx_unlock(&surf->wcore.swap_interval_mutex);
+
     return true;
 
 fail:
@@ -108,6 +117,37 @@ wegl_pbuffer_init(struct wegl_surface *surf,
         goto fail;
     }
 
+    mtx_lock(&surf->wcore.swap_interval_mutex);
+    surf->wcore.swap_interval_dirty = surf->wcore.has_swap_interval;
+    mtx_unlock(&surf->wcore.swap_interval_mutex);
+
+    return true;
+
+fail:
+    wegl_surface_teardown(surf);
+    return false;
+}
+
+/// Initialize a window that has no EGLSurface, and so binds EGL_NO_SURFACE
+/// and costs no GPU memory. Rendering must go to framebuffer objects.
+bool
+wegl_surfaceless_init(struct wegl_surface *surf,
+                      struct wcore_config *wc_config)
+{
+    struct wegl_display *dpy = wegl_display(wc_config->display);
+    bool ok;
+
+    ok = wcore_window_init(&surf->wcore, wc_config);
+    if (!ok)
+        goto fail;
+
+    if (!dpy->KHR_surfaceless_context) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "WAFFLE_WINDOW_SURFACELESS requires "
+                     "EGL_KHR_surfaceless_context");
+        goto fail;
+    }
+
     return true;
 
 fail:
@@ -115,6 +155,42 @@ fail:
     return false;
 }
 
+/// Parse the window attributes of platforms whose windows are pbuffers, which
+/// accept only WAFFLE_WINDOW_SURFACELESS.
+bool
+wegl_surface_parse_attrib_list(const intptr_t attrib_list[],
+                               bool *surfaceless)
+{
+    if (!attrib_list)
+        return true;
+
+    for (int i = 0; attrib_list[i]; i += 2) {
+        intptr_t key = attrib_list[i + 0];
+        intptr_t value = attrib_list[i + 1];
+
+        switch (key) {
+            case WAFFLE_WINDOW_SURFACELESS:
+                if (value == WAFFLE_DONT_CARE) {
+                    value = false;
+                }
+                else if (value != true && value != false) {
+                    wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                                 "WAFFLE_WINDOW_SURFACELESS has bad value "
+                                 "0x%x. Must be true(1), false(0), or "
+                                 "WAFFLE_DONT_CARE(-1)", (int) value);
+                    return false;
+                }
+                *surfaceless = value;
+                break;
+            default:
+                wcore_error_bad_attribute(key);
+                return false;
+        }
+    }
+
+    return true;
+}
+
 bool
 wegl_surface_teardown(struct wegl_surface *surf)
 {
@@ -141,9 +217,195 @@ wegl_surface_swap_buffers(struct wcore_window *wc_window)
     struct wegl_display *dpy = wegl_display(surf->wcore.display);
     struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
 
-    bool ok = plat->eglSwapBuffers(dpy->egl, surf->egl);
-    if (!ok)
-        wegl_emit_error(plat, "eglSwapBuffers");
+    bool ok;
+
+    if (surf->egl == EGL_NO_SURFACE) {
+        // There is nothing to present without a surface.
+        ok = true;
+    }
+    else if (surf->num_damage_rects > 0 &&
+             dpy->KHR_swap_buffers_with_damage &&
+             plat->eglSwapBuffersWithDamageKHR) {
+        ok = plat->eglSwapBuffersWithDamageKHR(dpy->egl, surf->egl,
+                                               surf->damage_rects,
+                                               surf->num_damage_rects);
+        if (!ok)
+            wegl_emit_error(plat, "eglSwapBuffersWithDamageKHR");
+    }
+    else if (surf->num_damage_rects > 0 &&
+             dpy->EXT_swap_buffers_with_damage &&
+             plat->eglSwapBuffersWithDamageEXT) {
+        ok = plat->eglSwapBuffersWithDamageEXT(dpy->egl, surf->egl,
+                                               surf->damage_rects,
+                                               surf->num_damage_rects);
+        if (!ok)
+            wegl_emit_error(plat, "eglSwapBuffersWithDamageEXT");
+    }
+    else {
+        // Without the extensions, presenting the whole surface is always a
+        // correct, if slower, way to present the damaged part of it.
+        ok = plat->eglSwapBuffers(dpy->egl, surf->egl);
+        if (!ok)
+            wegl_emit_error(plat, "eglSwapBuffers");
+    }
+
+    // A successful swap is a frame boundary for EGL_KHR_partial_update.
+    if (ok) {
+        surf->buffer_age_queried = false;
+        surf->damage_region_set = false;
+    }
+
+    return ok;
+}
+
+bool
+wegl_surface_swap_buffers_with_damage(struct wcore_window *wc_window,
+                                      const int32_t *rects,
+                                      int32_t n_rects)
+{
+    struct wegl_surface *surf = wegl_surface(wc_window);
+    const struct wcore_platform_vtbl *vtbl =
+        wc_window->display->platform->vtbl;
+    bool ok;
+
+    // Go through the platform's swap_buffers() rather than straight to
+    // wegl_surface_swap_buffers(), because some platforms wrap it; Wayland
+    // paces frames there and GBM releases the front buffer.
+    surf->damage_rects = rects;
+    surf->num_damage_rects = n_rects;
+
+    ok = vtbl->window.swap_buffers(wc_window);
+
+    surf->damage_rects = NULL;
+    surf->num_damage_rects = 0;
+
+    return ok;
+}
+
+bool
+wegl_surface_get_buffer_age(struct wcore_window *wc_window,
+                            int32_t *age)
+{
+    struct wegl_surface *surf = wegl_surface(wc_window);
+    struct wegl_display *dpy = wegl_display(surf->wcore.display);
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+    EGLint value;
+
+    // An age of 0 tells the application that the back buffer's contents
+    // are undefined, which is all that can be promised without the
+    // extension. EGL_KHR_partial_update defines the same query.
+    if ((!dpy->EXT_buffer_age && !dpy->KHR_partial_update) ||
+        surf->egl == EGL_NO_SURFACE) {
+        *age = 0;
+        surf->buffer_age_queried = true;
+        return true;
+    }
+
+    // EGL requires the surface to be current to the calling thread, and
+    // reports EGL_BAD_SURFACE if it is not.
+    if (!plat->eglQuerySurface(dpy->egl, surf->egl, EGL_BUFFER_AGE_EXT,
+                               &value)) {
+        wegl_emit_error(plat, "eglQuerySurface(EGL_BUFFER_AGE_EXT)");
+        return false;
+    }
+
+    *age = value;
+    surf->buffer_age_queried = true;
+    return true;
+}
+
+bool
+wegl_surface_set_damage_region(struct wcore_window *wc_window,
+                               const int32_t *rects,
+                               int32_t n_rects)
+{
+    struct wegl_surface *surf = wegl_surface(wc_window);
+    struct wegl_display *dpy = wegl_display(surf->wcore.display);
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+
+    // Enforce EGL_KHR_partial_update's ordering rules even when the
+    // extension is missing, so that applications behave the same
+    // everywhere.
+    if (!surf->buffer_age_queried) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the buffer age must be queried in the current frame "
+                     "before setting the damage region");
+        return false;
+    }
+
+    if (surf->damage_region_set) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the damage region was already set in the current "
+                     "frame");
+        return false;
+    }
+
+    // The region only lets the driver skip work, so without the extension
+    // there is nothing to do.
+    if (dpy->KHR_partial_update && plat->eglSetDamageRegionKHR &&
+        surf->egl != EGL_NO_SURFACE) {
+        if (!plat->eglSetDamageRegionKHR(dpy->egl, surf->egl,
+                                         (EGLint *) rects, n_rects)) {
+            wegl_emit_error(plat, "eglSetDamageRegionKHR");
+            return false;
+        }
+    }
+
+    surf->damage_region_set = true;
+    return true;
+}
+
+bool
+wegl_surface_set_swap_interval(struct wcore_window *wc_window,
+                               int32_t interval)
+{
+    struct wegl_surface *surf = wegl_surface(wc_window);
+    struct wcore_tinfo *tinfo;
+
+    // EGL has no equivalent of GLX_EXT_swap_control_tear.
+    if (interval < 0) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL does not support adaptive swap intervals");
+        return false;
+    }
+
+    // eglSwapInterval() applies to the surface bound on the calling thread,
+    // so the interval waits for the next wegl_make_current() if the surface
+    // is not current here.
+    mtx_lock(&wc_window->swap_interval_mutex);
+    wc_window->has_swap_interval = true;
+    wc_window->swap_interval_dirty = true;
+    wc_window->swap_interval = interval;
+    mtx_unlock(&wc_window->swap_interval_mutex);
+
+    tinfo = wcore_tinfo_get();
+    if (tinfo->current_window == wc_window && tinfo->current_context)
+        return wegl_surface_apply_swap_interval(surf);
+
+    return true;
+}
+
+bool
+wegl_surface_apply_swap_interval(struct wegl_surface *surf)
+{
+    struct wegl_display *dpy = wegl_display(surf->wcore.display);
+    struct wegl_platform *plat = wegl_platform(dpy->wcore.platform);
+    bool ok = true;
+
+    if (surf->egl == EGL_NO_SURFACE)
+        return true;
+
+    mtx_lock(&surf->wcore.swap_interval_mutex);
+    if (surf->wcore.swap_interval_dirty) {
+        // EGL silently clamps the interval to the config's
+        // [EGL_MIN_SWAP_INTERVAL, EGL_MAX_SWAP_INTERVAL].
+        ok = plat->eglSwapInterval(dpy->egl, surf->wcore.swap_interval);
+        if (ok)
+            surf->wcore.swap_interval_dirty = false;
+        else
+            wegl_emit_error(plat, "eglSwapInterval");
+    }
+    mtx_unlock(&surf->wcore.swap_interval_mutex);
 
     return ok;
 }
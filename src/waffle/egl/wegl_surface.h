@@ -38,6 +38,17 @@ struct wegl_display;
 struct wegl_surface {
     struct wcore_window wcore;
     EGLSurface egl;
+
+    /// Set only for the duration of wegl_surface_swap_buffers_with_damage(),
+    /// so that the platform's swap_buffers() hook can pass the damage to
+    /// EGL.
+    const EGLint *damage_rects;
+    EGLint num_damage_rects;
+
+    /// EGL_KHR_partial_update state for the current frame. Both are reset
+    /// by each successful swap.
+    bool buffer_age_queried;
+    bool damage_region_set;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(wegl_surface,
@@ -55,8 +66,38 @@ wegl_pbuffer_init(struct wegl_surface *surf,
                   struct wcore_config *wc_config,
                   int32_t width, int32_t height);
 
+bool
+wegl_surfaceless_init(struct wegl_surface *surf,
+                      struct wcore_config *wc_config);
+
+bool
+wegl_surface_parse_attrib_list(const intptr_t attrib_list[],
+                               bool *surfaceless);
+
 bool
 wegl_surface_teardown(struct wegl_surface *surf);
 
 bool
 wegl_surface_swap_buffers(struct wcore_window *wc_window);
+
+bool
+wegl_surface_swap_buffers_with_damage(struct wcore_window *wc_window,
+                                      const int32_t *rects,
+                                      int32_t n_rects);
+
+bool
+wegl_surface_get_buffer_age(struct wcore_window *wc_window,
+                            int32_t *age);
+
+bool
+wegl_surface_set_damage_region(struct wcore_window *wc_window,
+                               const int32_t *rects,
+                               int32_t n_rects);
+
+bool
+wegl_surface_set_swap_interval(struct wcore_window *wc_window,
+                               int32_t interval);
+
+/// @brief Apply a pending swap interval. The surface must be current.
+bool
+wegl_surface_apply_swap_interval(struct wegl_surface *surf);
@@ -76,21 +76,58 @@ wegl_make_current(struct wcore_platform *wc_plat,
                   struct wcore_context *wc_ctx)
 {
     struct wegl_platform *plat = wegl_platform(wc_plat);
+    struct wegl_display *dpy = wegl_display(wc_dpy);
     EGLSurface surface = wc_window ? wegl_surface(wc_window)->egl : NULL;
     bool ok;
 
+    // Report the missing extension rather than the EGL_BAD_MATCH that
+    // eglMakeCurrent would give.
+    if (wc_ctx && surface == EGL_NO_SURFACE && !dpy->KHR_surfaceless_context) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "binding a context without a surface requires "
+                     "EGL_KHR_surfaceless_context");
+        return false;
+    }
+
     ok = plat->eglMakeCurrent(wegl_display(wc_dpy)->egl,
                               surface,
                               surface,
                               wc_ctx
                                   ? wegl_context(wc_ctx)->egl
                                   : NULL);
-    if (!ok)
+    if (!ok) {
         wegl_emit_error(plat, "eglMakeCurrent");
+        return false;
+    }
+
+    if (wc_window && wc_ctx)
+        ok = wegl_surface_apply_swap_interval(wegl_surface(wc_window));
 
     return ok;
 }
 
+bool
+wegl_is_current(struct wcore_platform *wc_plat,
+                struct wcore_display *wc_dpy,
+                struct wcore_window *wc_window,
+                struct wcore_context *wc_ctx)
+{
+    struct wegl_platform *plat = wegl_platform(wc_plat);
+    EGLSurface surface = wc_window ? wegl_surface(wc_window)->egl : NULL;
+    EGLContext ctx = wc_ctx ? wegl_context(wc_ctx)->egl : NULL;
+
+    if (plat->eglGetCurrentContext() != ctx)
+        return false;
+
+    // With no context bound, EGL reports neither display nor surfaces.
+    if (ctx == NULL)
+        return true;
+
+    return plat->eglGetCurrentDisplay() == wegl_display(wc_dpy)->egl &&
+           plat->eglGetCurrentSurface(EGL_DRAW) == surface &&
+           plat->eglGetCurrentSurface(EGL_READ) == surface;
+}
+
 void*
 wegl_get_proc_address(struct wcore_platform *wc_self, const char *name)
 {
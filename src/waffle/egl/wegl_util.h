@@ -46,5 +46,11 @@ wegl_make_current(struct wcore_platform *wc_plat,
                   struct wcore_window *wc_window,
                   struct wcore_context *wc_ctx);
 
+bool
+wegl_is_current(struct wcore_platform *wc_plat,
+                struct wcore_display *wc_dpy,
+                struct wcore_window *wc_window,
+                struct wcore_context *wc_ctx);
+
 void*
 wegl_get_proc_address(struct wcore_platform *wc_self, const char *name);
@@ -0,0 +1,260 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "waffle.h"
+
+#include "wcore_error.h"
+
+#include "wegl_platform.h"
+#include "wegl_util.h"
+
+#include "edev_display.h"
+#include "edev_platform.h"
+
+/// Fill the device fields of @a self from @a device.
+static bool
+query_device(struct edev_display *self,
+             struct wegl_platform *plat,
+             EGLDeviceEXT device)
+{
+    const char *exts = plat->eglQueryDeviceStringEXT(device, EGL_EXTENSIONS);
+
+    if (!exts) {
+        wegl_emit_error(plat, "eglQueryDeviceStringEXT(EGL_EXTENSIONS)");
+        return false;
+    }
+
+    // waffle_is_extension_in_string() resets the error state. That's ok,
+    // because no error is pending here.
+    self->device = device;
+    self->device_extensions = exts;
+    self->software = waffle_is_extension_in_string(exts,
+                                                   "EGL_MESA_device_software");
+    self->drm_file = NULL;
+    self->drm_render_node_file = NULL;
+
+    if (waffle_is_extension_in_string(exts, "EGL_EXT_device_drm")) {
+        self->drm_file =
+            plat->eglQueryDeviceStringEXT(device, EGL_DRM_DEVICE_FILE_EXT);
+    }
+
+    if (waffle_is_extension_in_string(exts, "EGL_EXT_device_drm_render_node")) {
+        self->drm_render_node_file =
+            plat->eglQueryDeviceStringEXT(device, EGL_DRM_RENDER_NODE_FILE_EXT);
+    }
+
+    return true;
+}
+
+static bool
+same_file(const char *resolved, const char *file)
+{
+    char *path;
+    bool same;
+
+    if (!file)
+        return false;
+
+    path = realpath(file, NULL);
+    if (!path)
+        return false;
+
+    same = strcmp(resolved, path) == 0;
+    free(path);
+    return same;
+}
+
+/// Select the device named by @a name, which is null for the first device,
+/// a decimal index, or the path of one of the device's DRM nodes.
+static bool
+select_device(struct edev_display *self,
+              struct wegl_platform *plat,
+              EGLDeviceEXT *devices,
+              EGLint num_devices,
+              const char *name)
+{
+    if (name == NULL) {
+        self->device_index = 0;
+        return query_device(self, plat, devices[0]);
+    }
+
+    if (name[0] != '/') {
+        char *end;
+        long index;
+
+        errno = 0;
+        index = strtol(name, &end, 10);
+        if (name[0] == '\0' || *end != '\0' || errno != 0 || index < 0) {
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                         "'%s' is neither a device index nor a path", name);
+            return false;
+        }
+
+        if (index >= num_devices) {
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                         "device index %ld is out of range; found %d "
+                         "EGL devices", index, num_devices);
+            return false;
+        }
+
+        self->device_index = index;
+        return query_device(self, plat, devices[index]);
+    }
+
+    // Compare resolved paths, so that symlinks such as
+    // /dev/dri/by-path/* also match.
+    char *resolved = realpath(name, NULL);
+    if (!resolved) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "%s: %s", name, strerror(errno));
+        return false;
+    }
+
+    for (EGLint i = 0; i < num_devices; ++i) {
+        if (!query_device(self, plat, devices[i]))
+            break;
+
+        if (same_file(resolved, self->drm_file) ||
+            same_file(resolved, self->drm_render_node_file)) {
+            self->device_index = i;
+            free(resolved);
+            return true;
+        }
+    }
+
+    if (wcore_error_get_code() == WAFFLE_NO_ERROR) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "no EGL device has the DRM node %s", name);
+    }
+
+    free(resolved);
+    return false;
+}
+
+bool
+edev_display_destroy(struct wcore_display *wc_self)
+{
+    struct edev_display *self = edev_display(wegl_display(wc_self));
+    bool ok = true;
+
+    if (!self)
+        return ok;
+
+    ok &= wegl_display_teardown(&self->wegl);
+    free(self);
+    return ok;
+}
+
+struct wcore_display*
+edev_display_connect(struct wcore_platform *wc_plat, const char *name)
+{
+    struct wegl_platform *plat = wegl_platform(wc_plat);
+    struct edev_display *self;
+    EGLDeviceEXT *devices = NULL;
+    EGLint num_devices = 0;
+    bool ok = true;
+
+    self = wcore_calloc(sizeof(*self));
+    if (self == NULL)
+        return NULL;
+
+    if (!plat->eglQueryDevicesEXT(0, NULL, &num_devices)) {
+        wegl_emit_error(plat, "eglQueryDevicesEXT");
+        goto fail;
+    }
+
+    if (num_devices == 0) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "found no EGL devices");
+        goto fail;
+    }
+
+    devices = wcore_calloc(num_devices * sizeof(*devices));
+    if (devices == NULL)
+        goto fail;
+
+    if (!plat->eglQueryDevicesEXT(num_devices, devices, &num_devices)) {
+        wegl_emit_error(plat, "eglQueryDevicesEXT");
+        goto fail;
+    }
+
+    self->device_count = num_devices;
+
+    ok = select_device(self, plat, devices, num_devices, name);
+    if (!ok)
+        goto fail;
+
+    // Device handles stay valid for the life of the process, so the list
+    // itself is not needed past here.
+    free(devices);
+    devices = NULL;
+
+    ok = wegl_display_init(&self->wegl, wc_plat, self->device);
+    if (!ok)
+        goto fail;
+
+    return &self->wegl.wcore;
+
+fail:
+    free(devices);
+    edev_display_destroy(&self->wegl.wcore);
+    return NULL;
+}
+
+bool
+edev_display_query(struct wcore_display *wc_self,
+                   int32_t attrib,
+                   intptr_t *value)
+{
+    struct edev_display *self = edev_display(wegl_display(wc_self));
+
+    switch (attrib) {
+        case WAFFLE_DISPLAY_DEVICE_COUNT:
+            *value = self->device_count;
+            return true;
+        case WAFFLE_DISPLAY_DEVICE_INDEX:
+            *value = self->device_index;
+            return true;
+        case WAFFLE_DISPLAY_DEVICE_SOFTWARE:
+            *value = self->software;
+            return true;
+        case WAFFLE_DISPLAY_DEVICE_DRM_FILE:
+            *value = (intptr_t) self->drm_file;
+            return true;
+        case WAFFLE_DISPLAY_DEVICE_DRM_RENDER_NODE_FILE:
+            *value = (intptr_t) self->drm_render_node_file;
+            return true;
+        case WAFFLE_DISPLAY_DEVICE_EXTENSIONS:
+            *value = (intptr_t) self->device_extensions;
+            return true;
+        default:
+            wcore_error_bad_attribute(attrib);
+            return false;
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+
+#include "wegl_display.h"
+#include "wegl_imports.h"
+
+struct edev_display {
+    struct wegl_display wegl;
+
+    EGLDeviceEXT device;
+    int32_t device_index;
+    int32_t device_count;
+
+    /// Owned by EGL. The DRM files are null if the device has none, as
+    /// Mesa's software device does not.
+    const char *device_extensions;
+    const char *drm_file;
+    const char *drm_render_node_file;
+    bool software;
+};
+
+DEFINE_CONTAINER_CAST_FUNC(edev_display,
+                           struct edev_display,
+                           struct wegl_display,
+                           wegl)
+
+struct wcore_display*
+edev_display_connect(struct wcore_platform *wc_plat, const char *name);
+
+bool
+edev_display_destroy(struct wcore_display *wc_self);
+
+bool
+edev_display_query(struct wcore_display *wc_self,
+                   int32_t attrib,
+                   intptr_t *value);
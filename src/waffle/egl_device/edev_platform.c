@@ -0,0 +1,189 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "wcore_error.h"
+
+#include "linux_platform.h"
+
+#include "wegl_config.h"
+#include "wegl_context.h"
+#include "wegl_fence.h"
+#include "wegl_platform.h"
+#include "wegl_util.h"
+
+#include "edev_display.h"
+#include "edev_platform.h"
+#include "edev_window.h"
+
+static const struct wcore_platform_vtbl edev_platform_vtbl;
+
+static bool
+edev_platform_destroy(struct wcore_platform *wc_self)
+{
+    struct edev_platform *self = edev_platform(wegl_platform(wc_self));
+    bool ok = true;
+
+    if (!self)
+        return true;
+
+    if (self->linux)
+        ok &= linux_platform_destroy(self->linux);
+
+    ok &= wegl_platform_teardown(&self->wegl);
+    free(self);
+    return ok;
+}
+
+static bool
+has_client_extension(struct wegl_platform *plat, const char *name)
+{
+    return wcore_ext_set_has(&plat->client_extension_set, name);
+}
+
+struct wcore_platform*
+edev_platform_create(void)
+{
+    bool ok = true;
+
+    struct edev_platform *self = wcore_calloc(sizeof(*self));
+    if (self == NULL)
+        return NULL;
+
+    ok = wegl_platform_init(&self->wegl, EGL_PLATFORM_DEVICE_EXT);
+    if (!ok)
+        goto fail;
+
+    // Unlike the other platforms, a device cannot be selected through the
+    // EGL_PLATFORM environment variable, so eglGetPlatformDisplay is
+    // mandatory.
+    if (!wegl_platform_can_use_eglGetPlatformDisplay(&self->wegl) &&
+        !wegl_platform_can_use_eglGetPlatformDisplayEXT(&self->wegl)) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_EXT_platform_device is not supported");
+        goto fail;
+    }
+
+    // EGL_EXT_device_base is the union of the two extensions.
+    if (!self->wegl.eglQueryDevicesEXT ||
+        !(has_client_extension(&self->wegl, "EGL_EXT_device_enumeration") ||
+          has_client_extension(&self->wegl, "EGL_EXT_device_base"))) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_EXT_device_enumeration is not supported");
+        goto fail;
+    }
+
+    if (!self->wegl.eglQueryDeviceStringEXT ||
+        !(has_client_extension(&self->wegl, "EGL_EXT_device_query") ||
+          has_client_extension(&self->wegl, "EGL_EXT_device_base"))) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_EXT_device_query is not supported");
+        goto fail;
+    }
+
+    self->wegl.egl_surface_type_mask = EGL_PBUFFER_BIT;
+
+    self->linux = linux_platform_create();
+    if (!self->linux)
+        goto fail;
+
+    self->wegl.wcore.vtbl = &edev_platform_vtbl;
+    return &self->wegl.wcore;
+
+fail:
+    edev_platform_destroy(&self->wegl.wcore);
+    return NULL;
+}
+
+static bool
+edev_dl_can_open(struct wcore_platform *wc_self, int32_t waffle_dl)
+{
+    struct edev_platform *self = edev_platform(wegl_platform(wc_self));
+    return linux_platform_dl_can_open(self->linux, waffle_dl);
+}
+
+static void*
+edev_dl_sym(struct wcore_platform *wc_self,
+            int32_t waffle_dl, const char *name)
+{
+    struct edev_platform *self = edev_platform(wegl_platform(wc_self));
+    return linux_platform_dl_sym(self->linux, waffle_dl, name);
+}
+
+static const struct wcore_platform_vtbl edev_platform_vtbl = {
+    .destroy = edev_platform_destroy,
+
+    .make_current = wegl_make_current,
+    .is_current = wegl_is_current,
+    .get_proc_address = wegl_get_proc_address,
+
+    .dl_can_open = edev_dl_can_open,
+    .dl_sym = edev_dl_sym,
+
+    .display = {
+        .connect = edev_display_connect,
+        .destroy = edev_display_destroy,
+        .supports_context_api = wegl_display_supports_context_api,
+        .query = edev_display_query,
+        .query_renderer = wegl_display_query_renderer,
+        .get_native = NULL, // unsupported by platform
+    },
+
+    .config = {
+        .choose = wegl_config_choose,
+        .destroy = wegl_config_destroy,
+        .enumerate = wegl_config_enumerate,
+        .query = wegl_config_query,
+        .get_native = NULL, // unsupported by platform
+    },
+
+    .context = {
+        .create = wegl_context_create,
+        .destroy = wegl_context_destroy,
+        .query = wegl_context_query,
+        .get_native = NULL, // unsupported by platform
+    },
+
+    .window = {
+        .create = edev_window_create,
+        .destroy = edev_window_destroy,
+        .show = edev_window_show,
+        .swap_buffers = wegl_surface_swap_buffers,
+        .swap_buffers_with_damage = wegl_surface_swap_buffers_with_damage,
+        .get_buffer_age = wegl_surface_get_buffer_age,
+        .set_damage_region = wegl_surface_set_damage_region,
+        .set_swap_interval = wegl_surface_set_swap_interval,
+        .get_native = NULL, // unsupported by platform
+    },
+
+    .fence = {
+        .create = wegl_fence_create,
+        .destroy = wegl_fence_destroy,
+        .check_display = wegl_fence_check_display,
+        .client_wait = wegl_fence_client_wait,
+        .server_wait = wegl_fence_server_wait,
+    },
+};
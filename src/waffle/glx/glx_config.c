@@ -29,6 +29,7 @@
 #include "linux_platform.h"
 
 #include "wcore_config_attrs.h"
+#include "wcore_config_rank.h"
 #include "wcore_error.h"
 
 #include "glx_config.h"
@@ -74,6 +75,27 @@ glx_config_check_context_attrs(struct glx_display *dpy,
         return false;
     }
 
+    if (attrs->context_no_error && !dpy->ARB_create_context_no_error) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX_ARB_create_context_no_error is required in order to "
+                     "request a no-error context");
+        return false;
+    }
+
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE &&
+        !dpy->ARB_context_flush_control) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX_ARB_context_flush_control is required in order to "
+                     "request WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE");
+        return false;
+    }
+
+    if (attrs->no_config) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX does not support WAFFLE_NO_CONFIG");
+        return false;
+    }
+
     switch (attrs->context_api) {
         case WAFFLE_CONTEXT_OPENGL:
             if (glx_context_needs_arb_create_context(attrs) &&
@@ -141,31 +163,22 @@ glx_config_check_context_attrs(struct glx_display *dpy,
     }
 }
 
-struct wcore_config*
-glx_config_choose(struct wcore_platform *wc_plat,
-                  struct wcore_display *wc_dpy,
-                  const struct wcore_config_attrs *attrs)
+/// @brief Get the fbconfigs that match @a attrs, best first.
+///
+/// If some match, the caller must XFree() @a out_configs.
+static bool
+glx_config_choose_fbconfigs(struct glx_platform *plat,
+                            struct glx_display *dpy,
+                            const struct wcore_config_attrs *attrs,
+                            GLXFBConfig **out_configs,
+                            int *num_configs)
 {
-    struct glx_config *self;
-    struct glx_display *dpy = glx_display(wc_dpy);
-    struct glx_platform *plat = glx_platform(wc_plat);
-
+    struct wcore_config_attrs query;
+    struct wcore_config_candidate *candidates = NULL;
     GLXFBConfig *configs = NULL;
-    int num_configs = 0;
-    XVisualInfo *vi = NULL;
 
-    bool ok = true;
-
-    if (!glx_config_check_context_attrs(dpy, attrs))
-        return NULL;
-
-    self = wcore_calloc(sizeof(*self));
-    if (self == NULL)
-        return NULL;
-
-    ok = wcore_config_init(&self->wcore, wc_dpy, attrs);
-    if (!ok)
-        goto error;
+    // The MSAA fallback needs every config that some step of it may pick.
+    wcore_config_rank_query_attrs(attrs, &query);
 
     int attrib_list[] = {
         // From page 12 (18 of pdf) of the GLX 1.4 spec:
@@ -173,24 +186,24 @@ glx_config_choose(struct wcore_platform *wc_plat,
         //    For GLXFBConfigs that correspond to a TrueColor or DirectColor
         //    visual, GLX BUFFER SIZE is the sum of GLX RED SIZE, GLX GREEN
         //    SIZE, GLX BLUE SIZE, and GLX ALPHA SIZE.
-        GLX_BUFFER_SIZE,        attrs->rgba_size,
-        GLX_RED_SIZE,           attrs->red_size,
-        GLX_GREEN_SIZE,         attrs->green_size,
-        GLX_BLUE_SIZE,          attrs->blue_size,
-        GLX_ALPHA_SIZE,         attrs->alpha_size,
+        GLX_BUFFER_SIZE,        query.rgba_size,
+        GLX_RED_SIZE,           query.red_size,
+        GLX_GREEN_SIZE,         query.green_size,
+        GLX_BLUE_SIZE,          query.blue_size,
+        GLX_ALPHA_SIZE,         query.alpha_size,
 
-        GLX_DEPTH_SIZE,         attrs->depth_size,
-        GLX_STENCIL_SIZE,       attrs->stencil_size,
+        GLX_DEPTH_SIZE,         query.depth_size,
+        GLX_STENCIL_SIZE,       query.stencil_size,
 
-        GLX_SAMPLE_BUFFERS,     attrs->sample_buffers,
-        GLX_SAMPLES,            attrs->samples,
+        GLX_SAMPLE_BUFFERS,     query.sample_buffers,
+        GLX_SAMPLES,            query.samples,
 
-        GLX_DOUBLEBUFFER,       attrs->double_buffered,
+        GLX_DOUBLEBUFFER,       query.double_buffered,
 
-        GLX_ACCUM_RED_SIZE,     attrs->accum_buffer,
-        GLX_ACCUM_GREEN_SIZE,   attrs->accum_buffer,
-        GLX_ACCUM_BLUE_SIZE,    attrs->accum_buffer,
-        GLX_ACCUM_ALPHA_SIZE,   attrs->accum_buffer,
+        GLX_ACCUM_RED_SIZE,     query.accum_buffer,
+        GLX_ACCUM_GREEN_SIZE,   query.accum_buffer,
+        GLX_ACCUM_BLUE_SIZE,    query.accum_buffer,
+        GLX_ACCUM_ALPHA_SIZE,   query.accum_buffer,
 
         // According to the GLX 1.4 spec Table 3.4, the default value of
         // GLX_DRAWABLE_TYPE is GLX_WINDOW_BIT. Explicitly set the default
@@ -200,18 +213,77 @@ glx_config_choose(struct wcore_platform *wc_plat,
         0,
     };
 
-    // Set glx_fbconfig.
+    *out_configs = NULL;
+    *num_configs = 0;
     configs = wrapped_glXChooseFBConfig(plat, dpy->x11.xlib,
                                         dpy->x11.screen,
                                         attrib_list,
-                                        &num_configs);
-    if (!configs || num_configs == 0) {
-        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
-                     "glXChooseFBConfig returned no matching configs");
+                                        num_configs);
+    if (!configs)
+        *num_configs = 0;
+
+    if (*num_configs == 0 || !wcore_config_rank_needed(attrs)) {
+        *out_configs = configs;
+        return true;
+    }
+
+    candidates = wcore_calloc(*num_configs * sizeof(*candidates));
+    if (!candidates)
         goto error;
+
+    for (int i = 0; i < *num_configs; ++i) {
+        struct wcore_config_candidate *c = &candidates[i];
+        int error = 0;
+
+        c->native = configs[i];
+        error |= wrapped_glXGetFBConfigAttrib(plat, dpy->x11.xlib, configs[i],
+                                              GLX_BUFFER_SIZE, &c->rgba_size);
+        error |= wrapped_glXGetFBConfigAttrib(plat, dpy->x11.xlib, configs[i],
+                                              GLX_DEPTH_SIZE, &c->depth_size);
+        error |= wrapped_glXGetFBConfigAttrib(plat, dpy->x11.xlib, configs[i],
+                                              GLX_STENCIL_SIZE, &c->stencil_size);
+        error |= wrapped_glXGetFBConfigAttrib(plat, dpy->x11.xlib, configs[i],
+                                              GLX_SAMPLES, &c->samples);
+        if (error) {
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glxGetFBConfigAttrib failed");
+            goto error;
+        }
     }
-    // Simply take the first.
-    self->glx_fbconfig = configs[0];
+
+    *num_configs = wcore_config_rank(attrs, candidates, *num_configs);
+    for (int i = 0; i < *num_configs; ++i)
+        configs[i] = candidates[i].native;
+
+    free(candidates);
+    *out_configs = configs;
+    return true;
+
+error:
+    free(candidates);
+    XFree(configs);
+    *num_configs = 0;
+    return false;
+}
+
+static struct glx_config*
+glx_config_create(struct glx_platform *plat,
+                  struct glx_display *dpy,
+                  const struct wcore_config_attrs *attrs,
+                  GLXFBConfig fbconfig)
+{
+    struct glx_config *self;
+    XVisualInfo *vi = NULL;
+    bool ok = true;
+
+    self = wcore_calloc(sizeof(*self));
+    if (self == NULL)
+        return NULL;
+
+    ok = wcore_config_init(&self->wcore, &dpy->wcore, attrs);
+    if (!ok)
+        goto error;
+
+    self->glx_fbconfig = fbconfig;
 
     // Set glx_fbconfig_id.
     ok = !wrapped_glXGetFBConfigAttrib(plat, dpy->x11.xlib,
@@ -234,19 +306,130 @@ glx_config_choose(struct wcore_platform *wc_plat,
     }
     self->xcb_visual_id = vi->visualid;
 
-    goto cleanup;
+    XFree(vi);
+    return self;
 
 error:
     glx_config_destroy(&self->wcore);
-    self = NULL;
+    return NULL;
+}
 
-cleanup:
+struct wcore_config*
+glx_config_choose(struct wcore_platform *wc_plat,
+                  struct wcore_display *wc_dpy,
+                  const struct wcore_config_attrs *attrs)
+{
+    struct glx_config *self;
+    struct glx_display *dpy = glx_display(wc_dpy);
+    struct glx_platform *plat = glx_platform(wc_plat);
+
+    GLXFBConfig *configs = NULL;
+    int num_configs = 0;
+
+    if (!glx_config_check_context_attrs(dpy, attrs))
+        return NULL;
+
+    if (!glx_config_choose_fbconfigs(plat, dpy, attrs, &configs, &num_configs))
+        return NULL;
+
+    if (num_configs == 0) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "glXChooseFBConfig returned no matching configs");
+        if (configs)
+            XFree(configs);
+        return NULL;
+    }
+
+    // The fbconfigs are ranked, so take the first.
+    self = glx_config_create(plat, dpy, attrs, configs[0]);
+    XFree(configs);
+
+    return self ? &self->wcore : NULL;
+}
+
+bool
+glx_config_enumerate(struct wcore_platform *wc_plat,
+                     struct wcore_display *wc_dpy,
+                     const struct wcore_config_attrs *attrs,
+                     struct wcore_config *wc_configs[],
+                     int32_t max_configs,
+                     int32_t *num_configs)
+{
+    struct glx_display *dpy = glx_display(wc_dpy);
+    struct glx_platform *plat = glx_platform(wc_plat);
+
+    GLXFBConfig *configs = NULL;
+    int num_fbconfigs = 0;
+    int32_t n = 0;
+
+    if (!glx_config_check_context_attrs(dpy, attrs))
+        return false;
+
+    if (!glx_config_choose_fbconfigs(plat, dpy, attrs,
+                                     &configs, &num_fbconfigs))
+        return false;
+
+    if (!wc_configs) {
+        *num_configs = num_fbconfigs;
+        goto done;
+    }
+
+    for (; n < max_configs && n < num_fbconfigs; ++n) {
+        struct glx_config *self =
+            glx_config_create(plat, dpy, attrs, configs[n]);
+
+        if (!self) {
+            while (n > 0)
+                glx_config_destroy(wc_configs[--n]);
+            XFree(configs);
+            return false;
+        }
+
+        wc_configs[n] = &self->wcore;
+    }
+
+    *num_configs = n;
+
+done:
     if (configs)
         XFree(configs);
-    if (vi)
-        XFree(vi);
+    return true;
+}
+
+bool
+glx_config_query(struct wcore_config *wc_self,
+                 int32_t attrib,
+                 intptr_t *value)
+{
+    struct glx_config *self = glx_config(wc_self);
+    struct glx_display *dpy = glx_display(wc_self->display);
+    struct glx_platform *plat = glx_platform(dpy->wcore.platform);
+    int glx_attrib;
+    int glx_value;
+
+    switch (attrib) {
+        case WAFFLE_RED_SIZE:           glx_attrib = GLX_RED_SIZE; break;
+        case WAFFLE_GREEN_SIZE:         glx_attrib = GLX_GREEN_SIZE; break;
+        case WAFFLE_BLUE_SIZE:          glx_attrib = GLX_BLUE_SIZE; break;
+        case WAFFLE_ALPHA_SIZE:         glx_attrib = GLX_ALPHA_SIZE; break;
+        case WAFFLE_DEPTH_SIZE:         glx_attrib = GLX_DEPTH_SIZE; break;
+        case WAFFLE_STENCIL_SIZE:       glx_attrib = GLX_STENCIL_SIZE; break;
+        case WAFFLE_SAMPLE_BUFFERS:     glx_attrib = GLX_SAMPLE_BUFFERS; break;
+        case WAFFLE_SAMPLES:            glx_attrib = GLX_SAMPLES; break;
+        case WAFFLE_DOUBLE_BUFFERED:    glx_attrib = GLX_DOUBLEBUFFER; break;
+        default:
+            wcore_error_bad_attribute(attrib);
+            return false;
+    }
+
+    if (wrapped_glXGetFBConfigAttrib(plat, dpy->x11.xlib, self->glx_fbconfig,
+                                     glx_attrib, &glx_value)) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glxGetFBConfigAttrib failed");
+        return false;
+    }
 
-    return &self->wcore;
+    *value = glx_value;
+    return true;
 }
 
 union waffle_native_config*
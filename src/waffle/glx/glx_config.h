@@ -55,6 +55,19 @@ glx_config_choose(struct wcore_platform *wc_plat,
                   struct wcore_display *wc_dpy,
                   const struct wcore_config_attrs *attrs);
 
+bool
+glx_config_enumerate(struct wcore_platform *wc_plat,
+                     struct wcore_display *wc_dpy,
+                     const struct wcore_config_attrs *attrs,
+                     struct wcore_config *wc_configs[],
+                     int32_t max_configs,
+                     int32_t *num_configs);
+
+bool
+glx_config_query(struct wcore_config *wc_self,
+                 int32_t attrib,
+                 intptr_t *value);
+
 bool
 glx_config_destroy(struct wcore_config *wc_self);
 
@@ -48,6 +48,16 @@
 #include "glx_platform.h"
 #include "glx_wrappers.h"
 
+// Older glxext.h lack the definition.
+#ifndef GLX_CONTEXT_OPENGL_NO_ERROR_ARB
+#define GLX_CONTEXT_OPENGL_NO_ERROR_ARB 0x31B3
+#endif
+
+#ifndef GLX_ARB_context_flush_control
+#define GLX_CONTEXT_RELEASE_BEHAVIOR_ARB 0x2097
+#define GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB 0
+#endif
+
 bool
 glx_context_destroy(struct wcore_context *wc_self)
 {
@@ -155,6 +165,16 @@ glx_context_fill_attrib_list(struct glx_config *config,
         context_flags |= GLX_CONTEXT_ROBUST_ACCESS_BIT_ARB;
     }
 
+    if (attrs->context_no_error) {
+        attrib_list[i++] = GLX_CONTEXT_OPENGL_NO_ERROR_ARB;
+        attrib_list[i++] = True;
+    }
+
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE) {
+        attrib_list[i++] = GLX_CONTEXT_RELEASE_BEHAVIOR_ARB;
+        attrib_list[i++] = GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB;
+    }
+
     if (context_flags != 0) {
         attrib_list[i++] = GLX_CONTEXT_FLAGS_ARB;
         attrib_list[i++] = context_flags;
@@ -177,9 +197,11 @@ glx_context_create_native(struct glx_config *config,
     // - OpenGL version 1.0, or
     // - OpenGL version 3.2 or greater, or
     // - OpenGL with fwd_compat, or
-    // - Debug context
+    // - Debug context, or
+    // - No-error context, or
+    // - Context with a non-default release behavior
     //
-    // The first one of the four is optional, the remainder hard requirement
+    // The first one of the six is optional, the remainder hard requirement
     // for the use of ARB_create_context.
     if (dpy->ARB_create_context &&
         (wcore_config_attrs_version_eq(&config->wcore.attrs, 10) ||
@@ -243,6 +265,8 @@ glx_context_create(struct wcore_platform *wc_plat,
     if (!self->glx)
         goto error;
 
+    self->share_group = share_ctx ? share_ctx->share_group
+                                  : self->wcore.serial;
     return &self->wcore;
 
 error:
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include <GL/glx.h>
 
@@ -39,6 +40,15 @@ struct wcore_platform;
 struct glx_context {
     struct wcore_context wcore;
     GLXContext glx;
+
+    /// The serial of the first context of the share group, which outlives
+    /// the context itself.
+    uint64_t share_group;
+
+    /// Whether the context has sync objects, checked by the first
+    /// glx_fence_check_context().
+    bool sync_checked;
+    bool has_sync;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(glx_context,
@@ -66,7 +76,10 @@ glx_context_needs_arb_create_context(const struct wcore_config_attrs *attrs)
          attrs->context_forward_compatible))
         return true;
 
-    if (attrs->context_debug)
+    if (attrs->context_debug || attrs->context_no_error)
+        return true;
+
+    if (attrs->context_release_behavior != WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH)
         return true;
 
     return false;
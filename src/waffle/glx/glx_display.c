@@ -25,7 +25,9 @@
 
 #include <stdlib.h>
 
+#include "wcore_caps_cache.h"
 #include "wcore_error.h"
+#include "wcore_util.h"
 
 #include "linux_platform.h"
 
@@ -33,6 +35,17 @@
 #include "glx_platform.h"
 #include "glx_wrappers.h"
 
+#ifndef GLX_MESA_query_renderer
+#define GLX_RENDERER_VENDOR_ID_MESA                      0x8183
+#define GLX_RENDERER_DEVICE_ID_MESA                      0x8184
+#define GLX_RENDERER_ACCELERATED_MESA                    0x8186
+#define GLX_RENDERER_VIDEO_MEMORY_MESA                   0x8187
+#define GLX_RENDERER_OPENGL_CORE_PROFILE_VERSION_MESA    0x818A
+#define GLX_RENDERER_OPENGL_COMPATIBILITY_PROFILE_VERSION_MESA 0x818B
+#define GLX_RENDERER_OPENGL_ES_PROFILE_VERSION_MESA      0x818C
+#define GLX_RENDERER_OPENGL_ES2_PROFILE_VERSION_MESA     0x818D
+#endif
+
 bool
 glx_display_destroy(struct wcore_display *wc_self)
 {
@@ -52,6 +65,7 @@ static bool
 glx_display_set_extensions(struct glx_display *self)
 {
     struct glx_platform *platform = glx_platform(self->wcore.platform);
+    struct wcore_ext_set *set = &self->wcore.extensions;
     const char *s = wrapped_glXQueryExtensionsString(platform,
                                                      self->x11.xlib,
                                                      self->x11.screen);
@@ -61,10 +75,15 @@ glx_display_set_extensions(struct glx_display *self)
         return false;
     }
 
-    self->ARB_create_context                     = waffle_is_extension_in_string(s, "GLX_ARB_create_context");
-    self->ARB_create_context_profile             = waffle_is_extension_in_string(s, "GLX_ARB_create_context_profile");
-    self->ARB_create_context_robustness          = waffle_is_extension_in_string(s, "GLX_ARB_create_context_robustness");
-    self->EXT_create_context_es_profile          = waffle_is_extension_in_string(s, "GLX_EXT_create_context_es_profile");
+    if (!wcore_ext_set_add_string(set, s))
+        return false;
+
+    self->ARB_create_context                     = wcore_ext_set_has(set, "GLX_ARB_create_context");
+    self->ARB_create_context_profile             = wcore_ext_set_has(set, "GLX_ARB_create_context_profile");
+    self->ARB_create_context_robustness          = wcore_ext_set_has(set, "GLX_ARB_create_context_robustness");
+    self->ARB_create_context_no_error            = wcore_ext_set_has(set, "GLX_ARB_create_context_no_error");
+    self->ARB_context_flush_control              = wcore_ext_set_has(set, "GLX_ARB_context_flush_control");
+    self->EXT_create_context_es_profile          = wcore_ext_set_has(set, "GLX_EXT_create_context_es_profile");
 
     // The GLX_EXT_create_context_es2_profile spec, version 4 2012/03/28,
     // states that GLX_EXT_create_context_es_profile is an alias of
@@ -77,12 +96,41 @@ glx_display_set_extensions(struct glx_display *self)
     else {
         // Assume that GLX does not implement version 3 of the extension, in
         // which case the ES contexts GLX is capable of creating is ES2.
-        self->EXT_create_context_es2_profile = waffle_is_extension_in_string(s, "GLX_EXT_create_context_es2_profile");
+        self->EXT_create_context_es2_profile = wcore_ext_set_has(set, "GLX_EXT_create_context_es2_profile");
     }
 
+    self->EXT_swap_control                       = wcore_ext_set_has(set, "GLX_EXT_swap_control");
+    self->EXT_swap_control_tear                  = wcore_ext_set_has(set, "GLX_EXT_swap_control_tear");
+    self->MESA_swap_control                      = wcore_ext_set_has(set, "GLX_MESA_swap_control");
+    self->MESA_query_renderer                    = wcore_ext_set_has(set, "GLX_MESA_query_renderer");
+
     return true;
 }
 
+/// Identify the driver by the strings that the client library and the
+/// server report, and by the libraries loaded.
+static uint64_t
+glx_display_get_driver_id(struct glx_display *self)
+{
+    struct glx_platform *platform = glx_platform(self->wcore.platform);
+    Display *dpy = self->x11.xlib;
+    int screen = self->x11.screen;
+    uint64_t id = 0;
+
+    id = wcore_caps_hash_string(id,
+            wrapped_glXGetClientString(platform, dpy, GLX_VENDOR));
+    id = wcore_caps_hash_string(id,
+            wrapped_glXGetClientString(platform, dpy, GLX_VERSION));
+    id = wcore_caps_hash_string(id,
+            wrapped_glXQueryServerString(platform, dpy, screen, GLX_VENDOR));
+    id = wcore_caps_hash_string(id,
+            wrapped_glXQueryServerString(platform, dpy, screen, GLX_VERSION));
+    id = wcore_caps_hash_string(id,
+            wrapped_glXQueryExtensionsString(platform, dpy, screen));
+    id = wcore_caps_hash_driver_files(id);
+    return id ? id : 1;
+}
+
 struct wcore_display*
 glx_display_connect(struct wcore_platform *wc_plat,
                     const char *name)
@@ -106,6 +154,14 @@ glx_display_connect(struct wcore_platform *wc_plat,
     if (!ok)
         goto error;
 
+    // The Linux OpenGL ABI requires glXGetProcAddressARB() to return every
+    // GL function, core or extension.
+    self->wcore.proc_address_includes_core = true;
+
+    // Only when needed, because this stats the driver's files.
+    if (wc_plat->caps_cache_path)
+        self->wcore.driver_id = glx_display_get_driver_id(self);
+
     return &self->wcore;
 
 error:
@@ -134,6 +190,77 @@ glx_display_supports_context_api(struct wcore_display *wc_self,
     }
 }
 
+bool
+glx_display_query_renderer(struct wcore_display *wc_self,
+                           int32_t attrib,
+                           intptr_t *value)
+{
+    struct glx_display *self = glx_display(wc_self);
+    struct glx_platform *platform = glx_platform(wc_self->platform);
+    // Large enough for the version queries, which return major and minor.
+    unsigned int v[2] = {0};
+    int glx_attrib;
+
+    switch (attrib) {
+        case WAFFLE_RENDERER_VENDOR_ID:
+            glx_attrib = GLX_RENDERER_VENDOR_ID_MESA;
+            break;
+        case WAFFLE_RENDERER_DEVICE_ID:
+            glx_attrib = GLX_RENDERER_DEVICE_ID_MESA;
+            break;
+        case WAFFLE_RENDERER_VIDEO_MEMORY:
+            glx_attrib = GLX_RENDERER_VIDEO_MEMORY_MESA;
+            break;
+        case WAFFLE_RENDERER_ACCELERATED:
+            glx_attrib = GLX_RENDERER_ACCELERATED_MESA;
+            break;
+        case WAFFLE_RENDERER_OPENGL_CORE_PROFILE_VERSION:
+            glx_attrib = GLX_RENDERER_OPENGL_CORE_PROFILE_VERSION_MESA;
+            break;
+        case WAFFLE_RENDERER_OPENGL_COMPATIBILITY_PROFILE_VERSION:
+            glx_attrib = GLX_RENDERER_OPENGL_COMPATIBILITY_PROFILE_VERSION_MESA;
+            break;
+        case WAFFLE_RENDERER_OPENGL_ES_PROFILE_VERSION:
+            glx_attrib = GLX_RENDERER_OPENGL_ES_PROFILE_VERSION_MESA;
+            break;
+        case WAFFLE_RENDERER_OPENGL_ES2_PROFILE_VERSION:
+            glx_attrib = GLX_RENDERER_OPENGL_ES2_PROFILE_VERSION_MESA;
+            break;
+        default:
+            wcore_error_bad_attribute(attrib);
+            return false;
+    }
+
+    if (!self->MESA_query_renderer || !platform->glXQueryRendererIntegerMESA) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX_MESA_query_renderer is not supported");
+        return false;
+    }
+
+    if (!wrapped_glXQueryRendererIntegerMESA(platform, self->x11.xlib,
+                                             self->x11.screen, 0,
+                                             glx_attrib, v)) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "glXQueryRendererIntegerMESA(%s) failed",
+                     wcore_enum_to_string(attrib));
+        return false;
+    }
+
+    switch (attrib) {
+        case WAFFLE_RENDERER_OPENGL_CORE_PROFILE_VERSION:
+        case WAFFLE_RENDERER_OPENGL_COMPATIBILITY_PROFILE_VERSION:
+        case WAFFLE_RENDERER_OPENGL_ES_PROFILE_VERSION:
+        case WAFFLE_RENDERER_OPENGL_ES2_PROFILE_VERSION:
+            *value = 10 * v[0] + v[1];
+            break;
+        default:
+            *value = v[0];
+            break;
+    }
+
+    return true;
+}
+
 union waffle_native_display*
 glx_display_get_native(struct wcore_display *wc_self)
 {
@@ -47,8 +47,14 @@ struct glx_display {
     bool ARB_create_context;
     bool ARB_create_context_profile;
     bool ARB_create_context_robustness;
+    bool ARB_create_context_no_error;
+    bool ARB_context_flush_control;
     bool EXT_create_context_es_profile;
     bool EXT_create_context_es2_profile;
+    bool EXT_swap_control;
+    bool EXT_swap_control_tear;
+    bool MESA_swap_control;
+    bool MESA_query_renderer;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(glx_display,
@@ -67,5 +73,10 @@ bool
 glx_display_supports_context_api(struct wcore_display *wc_self,
                                  int32_t context_api);
 
+bool
+glx_display_query_renderer(struct wcore_display *wc_self,
+                           int32_t attrib,
+                           intptr_t *value);
+
 union waffle_native_display*
 glx_display_get_native(struct wcore_display *wc_self);
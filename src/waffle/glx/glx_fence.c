@@ -0,0 +1,207 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "waffle.h"
+
+#include "wcore_error.h"
+#include "wcore_tinfo.h"
+
+#include "glx_context.h"
+#include "glx_display.h"
+#include "glx_fence.h"
+#include "glx_platform.h"
+
+static bool
+context_has_sync(struct glx_platform *plat, struct glx_context *ctx)
+{
+    const char *version;
+    int major = 0, minor = 0;
+
+    if (ctx->sync_checked)
+        return ctx->has_sync;
+
+    version = (const char *) plat->glGetString(GL_VERSION);
+    if (version) {
+        while (*version != '\0' && !isdigit((unsigned char) *version))
+            version++;
+
+        sscanf(version, "%d.%d", &major, &minor);
+    }
+
+    if (ctx->wcore.context_api == WAFFLE_CONTEXT_OPENGL) {
+        // Core profiles, where GL_EXTENSIONS is not a valid string, start
+        // at 3.2. waffle_is_extension_in_string() resets the error state,
+        // which is fine because no error is pending here.
+        ctx->has_sync = major > 3 || (major == 3 && minor >= 2) ||
+                        waffle_is_extension_in_string(
+                            (const char *) plat->glGetString(GL_EXTENSIONS),
+                            "GL_ARB_sync");
+    }
+    else {
+        ctx->has_sync = major >= 3;
+    }
+
+    ctx->sync_checked = true;
+    return ctx->has_sync;
+}
+
+bool
+glx_fence_check_context(struct wcore_platform *wc_plat,
+                        struct wcore_context *wc_ctx)
+{
+    struct glx_platform *plat = glx_platform(wc_plat);
+
+    if (!plat->glGetString || !plat->glFenceSync ||
+        !plat->glDeleteSync || !plat->glClientWaitSync ||
+        !plat->glWaitSync ||
+        !context_has_sync(plat, glx_context(wc_ctx))) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "sync objects require OpenGL 3.2, OpenGL ES 3.0 or "
+                     "GL_ARB_sync");
+        return false;
+    }
+
+    return true;
+}
+
+/// Whether the context current to the calling thread shares with the
+/// fence's context, so that the fence's sync object may be used.
+static bool
+current_shares_with(struct glx_fence *self)
+{
+    struct glx_platform *plat = glx_platform(self->wcore.display->platform);
+    struct glx_context *current =
+        glx_context(wcore_tinfo_get()->current_context);
+
+    // Waffle's binding may be stale if the application called
+    // glXMakeCurrent() itself.
+    return current && current->glx == plat->glXGetCurrentContext() &&
+           current->share_group == self->share_group;
+}
+
+struct wcore_fence*
+glx_fence_create(struct wcore_platform *wc_plat,
+                 struct wcore_display *wc_dpy,
+                 struct wcore_context *wc_ctx)
+{
+    struct glx_platform *plat = glx_platform(wc_plat);
+    struct glx_fence *self;
+
+    if (!glx_fence_check_context(wc_plat, wc_ctx))
+        return NULL;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    wcore_fence_init(&self->wcore, wc_dpy, wc_ctx);
+    self->share_group = glx_context(wc_ctx)->share_group;
+
+    self->sync = plat->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (!self->sync) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glFenceSync failed");
+        free(self);
+        return NULL;
+    }
+
+    return &self->wcore;
+}
+
+bool
+glx_fence_destroy(struct wcore_fence *wc_fence)
+{
+    struct glx_fence *self = glx_fence(wc_fence);
+    struct glx_platform *plat;
+    bool ok = true;
+
+    if (!self)
+        return true;
+
+    plat = glx_platform(self->wcore.display->platform);
+
+    // The sync is a name in the share group, so deleting it from another
+    // group would delete whatever that name means there. Left alone, it
+    // is freed with its share group.
+    if (current_shares_with(self))
+        plat->glDeleteSync(self->sync);
+
+    ok &= wcore_fence_teardown(&self->wcore);
+    free(self);
+    return ok;
+}
+
+bool
+glx_fence_client_wait(struct wcore_fence *wc_fence,
+                      uint64_t timeout,
+                      bool *signaled)
+{
+    struct glx_fence *self = glx_fence(wc_fence);
+    struct glx_platform *plat = glx_platform(self->wcore.display->platform);
+    GLenum result;
+
+    if (!current_shares_with(self)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "waiting for a GLX fence requires a current context "
+                     "that shares with the fence's context");
+        return false;
+    }
+
+    // GL_TIMEOUT_IGNORED is UINT64_MAX, as Waffle's timeout.
+    result = plat->glClientWaitSync(self->sync,
+                                    GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+    switch (result) {
+        case GL_ALREADY_SIGNALED:
+        case GL_CONDITION_SATISFIED:
+            *signaled = true;
+            return true;
+        case GL_TIMEOUT_EXPIRED:
+            *signaled = false;
+            return true;
+        default:
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glClientWaitSync failed");
+            return false;
+    }
+}
+
+bool
+glx_fence_server_wait(struct wcore_fence *wc_fence)
+{
+    struct glx_fence *self = glx_fence(wc_fence);
+    struct glx_platform *plat = glx_platform(self->wcore.display->platform);
+
+    if (!current_shares_with(self)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "waiting for a GLX fence requires a current context "
+                     "that shares with the fence's context");
+        return false;
+    }
+
+    plat->glWaitSync(self->sync, 0, GL_TIMEOUT_IGNORED);
+    return true;
+}
@@ -0,0 +1,76 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <GL/glx.h>
+
+#include "wcore_fence.h"
+#include "wcore_util.h"
+
+struct wcore_context;
+struct wcore_display;
+struct wcore_platform;
+
+/// @brief A GL_ARB_sync object.
+///
+/// Unlike an EGL sync, it belongs to the share group of the context that
+/// created it, and may be waited for or deleted only while a context of
+/// that group is current.
+struct glx_fence {
+    struct wcore_fence wcore;
+    GLsync sync;
+
+    /// The glx_context::share_group of the fence's context.
+    uint64_t share_group;
+};
+
+DEFINE_CONTAINER_CAST_FUNC(glx_fence,
+                           struct glx_fence,
+                           struct wcore_fence,
+                           wcore)
+
+struct wcore_fence*
+glx_fence_create(struct wcore_platform *wc_plat,
+                 struct wcore_display *wc_dpy,
+                 struct wcore_context *wc_ctx);
+
+bool
+glx_fence_destroy(struct wcore_fence *wc_fence);
+
+bool
+glx_fence_check_context(struct wcore_platform *wc_plat,
+                        struct wcore_context *wc_ctx);
+
+bool
+glx_fence_client_wait(struct wcore_fence *wc_fence,
+                      uint64_t timeout,
+                      bool *signaled);
+
+bool
+glx_fence_server_wait(struct wcore_fence *wc_fence);
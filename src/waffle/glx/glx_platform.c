@@ -33,6 +33,7 @@
 #include "glx_config.h"
 #include "glx_context.h"
 #include "glx_display.h"
+#include "glx_fence.h"
 #include "glx_platform.h"
 #include "glx_window.h"
 #include "glx_wrappers.h"
@@ -103,8 +104,12 @@ glx_platform_create(void)
     RETRIEVE_GLX_SYMBOL(glXCreateNewContext);
     RETRIEVE_GLX_SYMBOL(glXDestroyContext);
     RETRIEVE_GLX_SYMBOL(glXMakeCurrent);
+    RETRIEVE_GLX_SYMBOL(glXGetCurrentContext);
+    RETRIEVE_GLX_SYMBOL(glXGetCurrentDrawable);
 
     RETRIEVE_GLX_SYMBOL(glXQueryExtensionsString);
+    RETRIEVE_GLX_SYMBOL(glXGetClientString);
+    RETRIEVE_GLX_SYMBOL(glXQueryServerString);
     RETRIEVE_GLX_SYMBOL(glXGetProcAddress);
 
     RETRIEVE_GLX_SYMBOL(glXGetVisualFromFBConfig);
@@ -119,6 +124,21 @@ glx_platform_create(void)
         goto error;
 
     self->glXCreateContextAttribsARB = (PFNGLXCREATECONTEXTATTRIBSARBPROC) self->glXGetProcAddress((const uint8_t*) "glXCreateContextAttribsARB");
+    self->glXSwapIntervalEXT = self->glXGetProcAddress((const uint8_t*) "glXSwapIntervalEXT");
+    self->glXSwapIntervalMESA = self->glXGetProcAddress((const uint8_t*) "glXSwapIntervalMESA");
+    self->glXQueryRendererIntegerMESA = self->glXGetProcAddress((const uint8_t*) "glXQueryRendererIntegerMESA");
+
+    // Whether these work depends on the context, which
+    // glx_fence_check_context() checks.
+    self->glGetString = self->glXGetProcAddress((const uint8_t*) "glGetString");
+    self->glFenceSync = self->glXGetProcAddress((const uint8_t*) "glFenceSync");
+    self->glDeleteSync = self->glXGetProcAddress((const uint8_t*) "glDeleteSync");
+    self->glClientWaitSync = self->glXGetProcAddress((const uint8_t*) "glClientWaitSync");
+    self->glWaitSync = self->glXGetProcAddress((const uint8_t*) "glWaitSync");
+
+    // Nothing calls XInitThreads(), and the wrappers swap the process-wide
+    // Xlib error handler, so only the application's threads may use GLX.
+    self->wcore.native_display_is_single_threaded = true;
 
     self->wcore.vtbl = &glx_platform_vtbl;
     return &self->wcore;
@@ -143,11 +163,31 @@ glx_platform_make_current(struct wcore_platform *wc_self,
     ok = wrapped_glXMakeCurrent(self, dpy, win, ctx);
     if (!ok) {
         wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glXMakeCurrent failed");
+        return false;
     }
 
+    if (wc_window && wc_ctx)
+        ok = glx_window_apply_swap_interval(glx_window(wc_window));
+
     return ok;
 }
 
+static bool
+glx_platform_is_current(struct wcore_platform *wc_self,
+                        struct wcore_display *wc_dpy,
+                        struct wcore_window *wc_window,
+                        struct wcore_context *wc_ctx)
+{
+    struct glx_platform *self = glx_platform(wc_self);
+    GLXDrawable win = wc_window ? glx_window(wc_window)->x11.xcb : 0;
+    GLXContext ctx = wc_ctx ? glx_context(wc_ctx)->glx : NULL;
+
+    if (self->glXGetCurrentContext() != ctx)
+        return false;
+
+    return ctx == NULL || self->glXGetCurrentDrawable() == win;
+}
+
 static void*
 glx_platform_get_proc_address(struct wcore_platform *wc_self,
                               const char *name)
@@ -178,6 +218,7 @@ static const struct wcore_platform_vtbl glx_platform_vtbl = {
     .destroy = glx_platform_destroy,
 
     .make_current = glx_platform_make_current,
+    .is_current = glx_platform_is_current,
     .get_proc_address = glx_platform_get_proc_address,
     .dl_can_open = glx_platform_dl_can_open,
     .dl_sym = glx_platform_dl_sym,
@@ -186,12 +227,15 @@ static const struct wcore_platform_vtbl glx_platform_vtbl = {
         .connect = glx_display_connect,
         .destroy = glx_display_destroy,
         .supports_context_api = glx_display_supports_context_api,
+        .query_renderer = glx_display_query_renderer,
         .get_native = glx_display_get_native,
     },
 
     .config = {
         .choose = glx_config_choose,
         .destroy = glx_config_destroy,
+        .enumerate = glx_config_enumerate,
+        .query = glx_config_query,
         .get_native = glx_config_get_native,
     },
 
@@ -207,6 +251,15 @@ static const struct wcore_platform_vtbl glx_platform_vtbl = {
         .show = glx_window_show,
         .resize = glx_window_resize,
         .swap_buffers = glx_window_swap_buffers,
+        .set_swap_interval = glx_window_set_swap_interval,
         .get_native = glx_window_get_native,
     },
+
+    .fence = {
+        .create = glx_fence_create,
+        .destroy = glx_fence_destroy,
+        .check_context = glx_fence_check_context,
+        .client_wait = glx_fence_client_wait,
+        .server_wait = glx_fence_server_wait,
+    },
 };
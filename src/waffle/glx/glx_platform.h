@@ -45,8 +45,12 @@ struct glx_platform {
                                       Bool direct);
     void (*glXDestroyContext)(Display *dpy, GLXContext ctx);
     Bool (*glXMakeCurrent)(Display *dpy, GLXDrawable drawable, GLXContext ctx);
+    GLXContext (*glXGetCurrentContext)(void);
+    GLXDrawable (*glXGetCurrentDrawable)(void);
 
     const char *(*glXQueryExtensionsString)(Display *dpy, int screen);
+    const char *(*glXGetClientString)(Display *dpy, int name);
+    const char *(*glXQueryServerString)(Display *dpy, int screen, int name);
     void *(*glXGetProcAddress)(const GLubyte *procname);
 
     XVisualInfo *(*glXGetVisualFromFBConfig)(Display *dpy, GLXFBConfig config);
@@ -59,6 +63,26 @@ struct glx_platform {
 
 
     PFNGLXCREATECONTEXTATTRIBSARBPROC glXCreateContextAttribsARB;
+
+    // GLX_EXT_swap_control
+    void (*glXSwapIntervalEXT)(Display *dpy, GLXDrawable drawable,
+                               int interval);
+
+    // GLX_MESA_swap_control
+    int (*glXSwapIntervalMESA)(unsigned int interval);
+
+    // GLX_MESA_query_renderer
+    Bool (*glXQueryRendererIntegerMESA)(Display *dpy, int screen,
+                                        int renderer, int attribute,
+                                        unsigned int *value);
+
+    // GL_ARB_sync, which is core in OpenGL 3.2 and OpenGL ES 3.0.
+    const GLubyte *(*glGetString)(GLenum name);
+    GLsync (*glFenceSync)(GLenum condition, GLbitfield flags);
+    void (*glDeleteSync)(GLsync sync);
+    GLenum (*glClientWaitSync)(GLsync sync, GLbitfield flags,
+                               GLuint64 timeout);
+    void (*glWaitSync)(GLsync sync, GLbitfield flags, GLuint64 timeout);
 };
 
 DEFINE_CONTAINER_CAST_FUNC(glx_platform,
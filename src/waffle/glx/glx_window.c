@@ -29,6 +29,7 @@
 
 #include "wcore_attrib_list.h"
 #include "wcore_error.h"
+#include "wcore_tinfo.h"
 
 #include "glx_config.h"
 #include "glx_display.h"
@@ -120,6 +121,81 @@ glx_window_swap_buffers(struct wcore_window *wc_self)
     return true;
 }
 
+bool
+glx_window_set_swap_interval(struct wcore_window *wc_self,
+                             int32_t interval)
+{
+    struct glx_window *self = glx_window(wc_self);
+    struct glx_display *dpy = glx_display(wc_self->display);
+    struct glx_platform *plat = glx_platform(wc_self->display->platform);
+    struct wcore_tinfo *tinfo;
+    int error;
+
+    if (interval < 0 && !dpy->EXT_swap_control_tear) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "adaptive swap interval requires "
+                     "GLX_EXT_swap_control_tear");
+        return false;
+    }
+
+    if (dpy->EXT_swap_control && plat->glXSwapIntervalEXT) {
+        error = wrapped_glXSwapIntervalEXT(plat, dpy->x11.xlib,
+                                           self->x11.xcb, interval);
+        if (error != Success) {
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                         "glXSwapIntervalEXT failed with X error %d", error);
+            return false;
+        }
+
+        return true;
+    }
+
+    // glXSwapIntervalMESA() applies to the current drawable, so the
+    // interval waits for the next make current if the window is not
+    // current here.
+    if (dpy->MESA_swap_control && plat->glXSwapIntervalMESA) {
+        mtx_lock(&wc_self->swap_interval_mutex);
+        wc_self->has_swap_interval = true;
+        wc_self->swap_interval_dirty = true;
+        wc_self->swap_interval = interval;
+        mtx_unlock(&wc_self->swap_interval_mutex);
+
+        tinfo = wcore_tinfo_get();
+        if (tinfo->current_window == wc_self && tinfo->current_context)
+            return glx_window_apply_swap_interval(self);
+
+        return true;
+    }
+
+    wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                 "GLX_EXT_swap_control or GLX_MESA_swap_control is required "
+                 "to set the swap interval");
+    return false;
+}
+
+bool
+glx_window_apply_swap_interval(struct glx_window *self)
+{
+    struct glx_platform *plat = glx_platform(self->wcore.display->platform);
+    int error = 0;
+
+    mtx_lock(&self->wcore.swap_interval_mutex);
+    if (self->wcore.swap_interval_dirty) {
+        error = wrapped_glXSwapIntervalMESA(plat, self->wcore.swap_interval);
+        if (!error)
+            self->wcore.swap_interval_dirty = false;
+    }
+    mtx_unlock(&self->wcore.swap_interval_mutex);
+
+    if (error) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "glXSwapIntervalMESA failed with error %d", error);
+        return false;
+    }
+
+    return true;
+}
+
 union waffle_native_window*
 glx_window_get_native(struct wcore_window *wc_self)
 {
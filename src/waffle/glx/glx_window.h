@@ -37,6 +37,7 @@ struct wcore_platform;
 struct glx_window {
     struct wcore_window wcore;
     struct x11_window x11;
+
 };
 
 DEFINE_CONTAINER_CAST_FUNC(glx_window,
@@ -63,5 +64,13 @@ glx_window_resize(struct wcore_window *wc_self,
 bool
 glx_window_swap_buffers(struct wcore_window *wc_self);
 
+bool
+glx_window_set_swap_interval(struct wcore_window *wc_self,
+                             int32_t interval);
+
+/// @brief Apply a pending swap interval. The window must be current.
+bool
+glx_window_apply_swap_interval(struct glx_window *self);
+
 union waffle_native_window*
 glx_window_get_native(struct wcore_window *wc_self);
@@ -131,6 +131,26 @@ wrapped_glXQueryExtensionsString(struct glx_platform *platform,
     return s;
 }
 
+static inline const char*
+wrapped_glXGetClientString(struct glx_platform *platform,
+                           Display *dpy, int name)
+{
+    X11_SAVE_ERROR_HANDLER
+    const char *s = platform->glXGetClientString(dpy, name);
+    X11_RESTORE_ERROR_HANDLER
+    return s;
+}
+
+static inline const char*
+wrapped_glXQueryServerString(struct glx_platform *platform,
+                             Display *dpy, int screen, int name)
+{
+    X11_SAVE_ERROR_HANDLER
+    const char *s = platform->glXQueryServerString(dpy, screen, name);
+    X11_RESTORE_ERROR_HANDLER
+    return s;
+}
+
 static inline void
 wrapped_glXSwapBuffers(struct glx_platform *platform,
                        Display *dpy, GLXDrawable drawable)
@@ -139,3 +159,39 @@ wrapped_glXSwapBuffers(struct glx_platform *platform,
     platform->glXSwapBuffers(dpy, drawable);
     X11_RESTORE_ERROR_HANDLER
 }
+
+/// Return the Xlib error code that the request caused, or Success.
+static inline int
+wrapped_glXSwapIntervalEXT(struct glx_platform *platform,
+                           Display *dpy, GLXDrawable drawable, int interval)
+{
+    int (*old_handler)(Display*, XErrorEvent*) =
+        XSetErrorHandler(x11_capture_error_handler);
+    *x11_captured_error() = Success;
+    platform->glXSwapIntervalEXT(dpy, drawable, interval);
+    XSync(dpy, False);
+    X11_RESTORE_ERROR_HANDLER
+    return *x11_captured_error();
+}
+
+static inline Bool
+wrapped_glXQueryRendererIntegerMESA(struct glx_platform *platform,
+                                    Display *dpy, int screen, int renderer,
+                                    int attribute, unsigned int *value)
+{
+    X11_SAVE_ERROR_HANDLER
+    Bool ok = platform->glXQueryRendererIntegerMESA(dpy, screen, renderer,
+                                                    attribute, value);
+    X11_RESTORE_ERROR_HANDLER
+    return ok;
+}
+
+static inline int
+wrapped_glXSwapIntervalMESA(struct glx_platform *platform,
+                            unsigned int interval)
+{
+    X11_SAVE_ERROR_HANDLER
+    int error = platform->glXSwapIntervalMESA(interval);
+    X11_RESTORE_ERROR_HANDLER
+    return error;
+}
@@ -26,6 +26,7 @@
 #include "ppapi/c/pp_graphics_3d.h"
 
 #include "wcore_config_attrs.h"
+#include "wcore_config_rank.h"
 #include "wcore_error.h"
 
 #include "nacl_config.h"
@@ -69,6 +70,32 @@ nacl_config_choose(struct wcore_platform *wc_plat,
         goto error;
     }
 
+    if (attrs->context_no_error) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "NaCl does not support no-error contexts.");
+        goto error;
+    }
+
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "NaCl does not support controlling the context release "
+                     "behavior.");
+        goto error;
+    }
+
+    if (attrs->no_config) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "NaCl does not support WAFFLE_NO_CONFIG.");
+        goto error;
+    }
+
+    if (wcore_config_rank_needed(attrs)) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "NaCl does not support WAFFLE_CONFIG_RANKING or "
+                     "WAFFLE_SAMPLES_FALLBACK.");
+        goto error;
+    }
+
     unsigned attr = 0;
 
     // Max amount of attribs is hardcoded in nacl_config.h (64)
@@ -1,4 +1,5 @@
 #include "wegl_context.h"
+#include "wegl_fence.h"
 #include "wegl_util.h"
 #include "linux_platform.h"
 #include "linux_platform_libs.h"
@@ -97,6 +98,7 @@ static const struct wcore_platform_vtbl qnx_platform_vtbl = {
     .destroy = qnx_platform_destroy,
 
     .make_current = wegl_make_current,
+    .is_current = wegl_is_current,
     .get_proc_address = wegl_get_proc_address,
     .dl_can_open = qnx_platform_dl_can_open,
     .dl_sym = qnx_platform_dl_sym,
@@ -105,18 +107,22 @@ static const struct wcore_platform_vtbl qnx_platform_vtbl = {
         .connect = qnx_display_connect,
         .destroy = qnx_display_disconnect,
         .supports_context_api = qnx_display_supports_context_api,
+        .query_renderer = wegl_display_query_renderer,
         .get_native = NULL,
     },
 
     .config = {
         .choose = wegl_config_choose,
         .destroy = wegl_config_destroy,
+        .enumerate = wegl_config_enumerate,
+        .query = wegl_config_query,
         .get_native = NULL,
     },
 
     .context = {
         .create = wegl_context_create,
         .destroy = wegl_context_destroy,
+        .query = wegl_context_query,
         .get_native = NULL,
     },
 
@@ -125,7 +131,18 @@ static const struct wcore_platform_vtbl qnx_platform_vtbl = {
         .destroy = qnx_window_destroy,
         .show = qnx_window_show,
         .swap_buffers = wegl_surface_swap_buffers,
+        .swap_buffers_with_damage = wegl_surface_swap_buffers_with_damage,
+        .get_buffer_age = wegl_surface_get_buffer_age,
+        .set_damage_region = wegl_surface_set_damage_region,
         .resize = qnx_window_resize,
         .get_native = NULL,
     },
+
+    .fence = {
+        .create = wegl_fence_create,
+        .destroy = wegl_fence_destroy,
+        .check_display = wegl_fence_check_display,
+        .client_wait = wegl_fence_client_wait,
+        .server_wait = wegl_fence_server_wait,
+    },
 };
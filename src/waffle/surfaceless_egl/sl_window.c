@@ -57,6 +57,7 @@ sl_window_create(struct wcore_platform *wc_plat,
                    const intptr_t attrib_list[])
 {
     struct sl_window *self;
+    bool surfaceless = false;
     bool ok = true;
 
     if (width == -1 && height == -1) {
@@ -65,16 +66,17 @@ sl_window_create(struct wcore_platform *wc_plat,
         return NULL;
     }
 
-    if (wcore_attrib_list_length(attrib_list) > 0) {
-        wcore_error_bad_attribute(attrib_list[0]);
+    if (!wegl_surface_parse_attrib_list(attrib_list, &surfaceless))
         return NULL;
-    }
 
     self = wcore_calloc(sizeof(*self));
     if (self == NULL)
         return NULL;
 
-    ok = wegl_pbuffer_init(&self->wegl, wc_config, width, height);
+    if (surfaceless)
+        ok = wegl_surfaceless_init(&self->wegl, wc_config);
+    else
+        ok = wegl_pbuffer_init(&self->wegl, wc_config, width, height);
     if (!ok)
         goto error;
 
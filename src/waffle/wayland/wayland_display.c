@@ -25,6 +25,8 @@
 
 #define WL_EGL_PLATFORM 1
 
+#include <errno.h>
+#include <poll.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -188,3 +190,59 @@ wayland_display_sync(struct wayland_display *dpy)
 
     return true;
 }
+
+bool
+wayland_display_dispatch_nonblock(struct wayland_display *dpy,
+                                  struct wl_event_queue *queue)
+{
+    struct wl_display *wl_dpy = dpy->wl_display;
+    struct pollfd pfd;
+    int ret;
+
+    // Drain what is already queued, so that wl_display_prepare_read_queue()
+    // can succeed.
+    while (wl_display_prepare_read_queue(wl_dpy, queue) != 0) {
+        if (wl_display_dispatch_queue_pending(wl_dpy, queue) == -1)
+            goto error;
+    }
+
+    // Flush our own requests (the frame request and the commit issued by
+    // eglSwapBuffers). A full socket buffer is not fatal; the remainder is
+    // flushed on the next swap.
+    if (wl_display_flush(wl_dpy) == -1 && errno != EAGAIN) {
+        wl_display_cancel_read(wl_dpy);
+        goto error;
+    }
+
+    // Read only what the compositor has already sent. Never block.
+    pfd.fd = wl_display_get_fd(wl_dpy);
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    do {
+        ret = poll(&pfd, 1, 0);
+    } while (ret == -1 && errno == EINTR);
+
+    if (ret > 0 && (pfd.revents & POLLIN)) {
+        if (wl_display_read_events(wl_dpy) == -1)
+            goto error;
+    }
+    else {
+        wl_display_cancel_read(wl_dpy);
+    }
+
+    if (wl_display_dispatch_queue_pending(wl_dpy, queue) == -1)
+        goto error;
+
+    // The default queue carries the shell's ping events. Service them too,
+    // as wl_display_roundtrip() did, or the compositor may consider us
+    // unresponsive.
+    if (wl_display_dispatch_pending(wl_dpy) == -1)
+        goto error;
+
+    return true;
+
+error:
+    wcore_error_errno("error on wl_display");
+    return false;
+}
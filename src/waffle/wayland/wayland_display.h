@@ -39,6 +39,7 @@ struct wcore_platform;
 struct wl_display;
 struct wl_compositor;
 struct wl_shell;
+struct wl_event_queue;
 
 struct wayland_display {
     struct wl_display *wl_display;
@@ -90,3 +91,12 @@ wayland_display_get_native(struct wcore_display *wc_self);
 /// public entry points synchronous.
 bool
 wayland_display_sync(struct wayland_display *dpy);
+
+/// @brief Dispatch events without blocking.
+///
+/// Flush pending requests, read whatever the server has already sent, and
+/// dispatch the events queued on @a queue and on the default queue. Unlike
+/// wayland_display_sync(), this never waits for the server.
+bool
+wayland_display_dispatch_nonblock(struct wayland_display *dpy,
+                                  struct wl_event_queue *queue);
@@ -36,6 +36,7 @@
 
 #include "wegl_config.h"
 #include "wegl_context.h"
+#include "wegl_fence.h"
 #include "wegl_platform.h"
 #include "wegl_util.h"
 
@@ -185,6 +186,7 @@ static const struct wcore_platform_vtbl wayland_platform_vtbl = {
     .destroy = wayland_platform_destroy,
 
     .make_current = wegl_make_current,
+    .is_current = wegl_is_current,
     .get_proc_address = wegl_get_proc_address,
     .dl_can_open = wayland_dl_can_open,
     .dl_sym = wayland_dl_sym,
@@ -193,18 +195,22 @@ static const struct wcore_platform_vtbl wayland_platform_vtbl = {
         .connect = wayland_display_connect,
         .destroy = wayland_display_destroy,
         .supports_context_api = wegl_display_supports_context_api,
+        .query_renderer = wegl_display_query_renderer,
         .get_native = wayland_display_get_native,
     },
 
     .config = {
         .choose = wegl_config_choose,
         .destroy = wegl_config_destroy,
+        .enumerate = wegl_config_enumerate,
+        .query = wegl_config_query,
         .get_native = wayland_config_get_native,
     },
 
     .context = {
         .create = wegl_context_create,
         .destroy = wegl_context_destroy,
+        .query = wegl_context_query,
         .get_native = wayland_context_get_native,
     },
 
@@ -213,7 +219,23 @@ static const struct wcore_platform_vtbl wayland_platform_vtbl = {
         .destroy = wayland_window_destroy,
         .show = wayland_window_show,
         .swap_buffers = wayland_window_swap_buffers,
+        .swap_buffers_with_damage = wegl_surface_swap_buffers_with_damage,
+        .get_buffer_age = wegl_surface_get_buffer_age,
+        .set_damage_region = wegl_surface_set_damage_region,
+        .set_swap_interval = wegl_surface_set_swap_interval,
         .resize = wayland_window_resize,
+        .query = wayland_window_query,
         .get_native = wayland_window_get_native,
     },
+
+    .fence = {
+        .create = wegl_fence_create,
+        .create_exportable = wegl_fence_create_exportable,
+        .destroy = wegl_fence_destroy,
+        .check_display = wegl_fence_check_display,
+        .client_wait = wegl_fence_client_wait,
+        .server_wait = wegl_fence_server_wait,
+        .export_fd = wegl_fence_export_fd,
+        .import_fd = wegl_fence_import_fd,
+    },
 };
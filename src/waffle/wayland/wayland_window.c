@@ -55,6 +55,9 @@ wayland_window_destroy(struct wcore_window *wc_self)
     if (!self)
         return ok;
 
+    for (int i = 0; i < self->num_pending_frames; ++i)
+        wl_callback_destroy(self->pending_frames[i]);
+
     ok &= wegl_surface_teardown(&self->wegl);
 
     if (self->wl_window)
@@ -66,6 +69,9 @@ wayland_window_destroy(struct wcore_window *wc_self)
     if (self->wl_surface)
         wl_surface_destroy(self->wl_surface);
 
+    if (self->wl_queue)
+        wl_event_queue_destroy(self->wl_queue);
+
     free(self);
     return ok;
 }
@@ -99,6 +105,80 @@ static const struct wl_shell_surface_listener shell_surface_listener = {
     .popup_done = shell_surface_listener_popup_done
 };
 
+static void
+frame_listener_done(void *data,
+                    struct wl_callback *callback,
+                    uint32_t time)
+{
+    struct wayland_window *self = data;
+    int i;
+
+    for (i = 0; i < self->num_pending_frames; ++i) {
+        if (self->pending_frames[i] == callback)
+            break;
+    }
+
+    if (i < self->num_pending_frames) {
+        memmove(&self->pending_frames[i], &self->pending_frames[i + 1],
+                (self->num_pending_frames - i - 1) *
+                sizeof(self->pending_frames[0]));
+        --self->num_pending_frames;
+    }
+
+    wl_callback_destroy(callback);
+
+    // The compositor signals every frame committed since its previous
+    // repaint with the same timestamp, but only the newest of them reached
+    // the screen.
+    if (self->have_last_frame_time && time == self->last_frame_time) {
+        ++self->frames_dropped;
+    }
+    else {
+        ++self->frames_presented;
+    }
+
+    self->have_last_frame_time = true;
+    self->last_frame_time = time;
+}
+
+static const struct wl_callback_listener frame_listener = {
+    .done = frame_listener_done,
+};
+
+static bool
+wayland_window_parse_attrib_list(struct wayland_window *self,
+                                 const intptr_t attrib_list[])
+{
+    if (!attrib_list)
+        return true;
+
+    for (int i = 0; attrib_list[i]; i += 2) {
+        intptr_t key = attrib_list[i + 0];
+        intptr_t value = attrib_list[i + 1];
+
+        switch (key) {
+            case WAFFLE_WINDOW_FRAME_PACING:
+                if (value == WAFFLE_DONT_CARE) {
+                    value = false;
+                }
+                else if (value != true && value != false) {
+                    wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                                 "WAFFLE_WINDOW_FRAME_PACING has bad value "
+                                 "0x%x. Must be true(1), false(0), or "
+                                 "WAFFLE_DONT_CARE(-1)", (int) value);
+                    return false;
+                }
+                self->frame_pacing = value;
+                break;
+            default:
+                wcore_error_bad_attribute(key);
+                return false;
+        }
+    }
+
+    return true;
+}
+
 struct wcore_window*
 wayland_window_create(struct wcore_platform *wc_plat,
                       struct wcore_config *wc_config,
@@ -117,15 +197,15 @@ wayland_window_create(struct wcore_platform *wc_plat,
         return NULL;
     }
 
-    if (wcore_attrib_list_length(attrib_list) > 0) {
-        wcore_error_bad_attribute(attrib_list[0]);
-        return NULL;
-    }
-
     self = wcore_calloc(sizeof(*self));
     if (self == NULL)
         return NULL;
 
+    if (!wayland_window_parse_attrib_list(self, attrib_list)) {
+        free(self);
+        return NULL;
+    }
+
     if (!dpy->wl_compositor) {
         wcore_errorf(WAFFLE_ERROR_UNKNOWN, "wayland compositor not found");
         goto error;
@@ -142,6 +222,21 @@ wayland_window_create(struct wcore_platform *wc_plat,
         goto error;
     }
 
+    if (self->frame_pacing) {
+        // Frame callbacks inherit the queue of the surface. Keeping them off
+        // the default queue lets each window dispatch its own events without
+        // serializing against the other windows.
+        self->wl_queue = wl_display_create_queue(dpy->wl_display);
+        if (!self->wl_queue) {
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                         "wl_display_create_queue failed");
+            goto error;
+        }
+
+        wl_proxy_set_queue((struct wl_proxy *) self->wl_surface,
+                           self->wl_queue);
+    }
+
     self->wl_shell_surface = wl_shell_get_shell_surface(dpy->wl_shell,
                                                         self->wl_surface);
     if (!self->wl_shell_surface) {
@@ -194,12 +289,58 @@ wayland_window_show(struct wcore_window *wc_self)
     return true;
 }
 
+static bool
+wayland_window_swap_buffers_paced(struct wayland_window *self)
+{
+    struct wayland_display *dpy = wayland_display(self->wegl.wcore.display);
+    struct wl_callback *callback;
+    bool ok;
+
+    // Collect the frame callbacks of earlier swaps.
+    ok = wayland_display_dispatch_nonblock(dpy, self->wl_queue);
+    if (!ok)
+        return false;
+
+    // The compositor has not yet consumed the previous frame.
+    if (self->num_pending_frames > 0)
+        ++self->frames_delayed;
+
+    if (self->num_pending_frames == WAYLAND_WINDOW_MAX_PENDING_FRAMES) {
+        wl_callback_destroy(self->pending_frames[0]);
+        memmove(&self->pending_frames[0], &self->pending_frames[1],
+                (WAYLAND_WINDOW_MAX_PENDING_FRAMES - 1) *
+                sizeof(self->pending_frames[0]));
+        --self->num_pending_frames;
+        ++self->frames_dropped;
+    }
+
+    // Request the callback before eglSwapBuffers, which commits the surface.
+    callback = wl_surface_frame(self->wl_surface);
+    if (!callback) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "wl_surface_frame failed");
+        return false;
+    }
+
+    wl_callback_add_listener(callback, &frame_listener, self);
+    self->pending_frames[self->num_pending_frames++] = callback;
+
+    ok = wegl_surface_swap_buffers(&self->wegl.wcore);
+    if (!ok)
+        return false;
+
+    return wayland_display_dispatch_nonblock(dpy, self->wl_queue);
+}
+
 bool
 wayland_window_swap_buffers(struct wcore_window *wc_self)
 {
+    struct wayland_window *self = wayland_window(wc_self);
     struct wayland_display *dpy = wayland_display(wc_self->display);
     bool ok;
 
+    if (self->frame_pacing)
+        return wayland_window_swap_buffers_paced(self);
+
     ok = wegl_surface_swap_buffers(wc_self);
     if (!ok)
         return false;
@@ -230,6 +371,37 @@ wayland_window_resize(struct wcore_window *wc_self,
     return true;
 }
 
+bool
+wayland_window_query(struct wcore_window *wc_self,
+                     int32_t attrib,
+                     intptr_t *value)
+{
+    struct wayland_window *self = wayland_window(wc_self);
+    struct wayland_display *dpy = wayland_display(wc_self->display);
+
+    if (self->frame_pacing &&
+        !wayland_display_dispatch_nonblock(dpy, self->wl_queue))
+        return false;
+
+    switch (attrib) {
+        case WAFFLE_WINDOW_FRAME_PACING:
+            *value = self->frame_pacing;
+            return true;
+        case WAFFLE_WINDOW_FRAMES_PRESENTED:
+            *value = self->frames_presented;
+            return true;
+        case WAFFLE_WINDOW_FRAMES_DELAYED:
+            *value = self->frames_delayed;
+            return true;
+        case WAFFLE_WINDOW_FRAMES_DROPPED:
+            *value = self->frames_dropped;
+            return true;
+        default:
+            wcore_error_bad_attribute(attrib);
+            return false;
+    }
+}
+
 union waffle_native_window*
 wayland_window_get_native(struct wcore_window *wc_self)
 {
@@ -35,12 +35,36 @@
 #include "wegl_surface.h"
 
 struct wcore_platform;
+struct wl_callback;
+struct wl_event_queue;
+
+/// Frames whose wl_surface.frame callback has not yet fired. If the
+/// compositor stops repainting the surface (for example, because it is
+/// hidden), the oldest frame is forgotten and counted as dropped.
+#define WAYLAND_WINDOW_MAX_PENDING_FRAMES 4
 
 struct wayland_window {
     struct wl_surface *wl_surface;
     struct wl_shell_surface *wl_shell_surface;
     struct wl_egl_window *wl_window;
 
+    /// WAFFLE_WINDOW_FRAME_PACING. If set, swaps are paced by
+    /// wl_surface.frame callbacks dispatched on wl_queue, and
+    /// wayland_display_sync() is not called after each swap.
+    bool frame_pacing;
+    struct wl_event_queue *wl_queue;
+
+    /// Ordered from oldest to newest.
+    struct wl_callback *pending_frames[WAYLAND_WINDOW_MAX_PENDING_FRAMES];
+    int num_pending_frames;
+
+    bool have_last_frame_time;
+    uint32_t last_frame_time;
+
+    intptr_t frames_presented;
+    intptr_t frames_delayed;
+    intptr_t frames_dropped;
+
     struct wegl_surface wegl;
 };
 
@@ -76,5 +100,10 @@ bool
 wayland_window_resize(struct wcore_window *wc_self,
                       int32_t width, int32_t height);
 
+bool
+wayland_window_query(struct wcore_window *wc_self,
+                     int32_t attrib,
+                     intptr_t *value);
+
 union waffle_native_window*
 wayland_window_get_native(struct wcore_window *wc_self);
@@ -93,6 +93,7 @@ wayland_wrapper_init(void)
         goto error;                                             \
     }
 
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_callback_interface);
     RETRIEVE_WL_CLIENT_SYMBOL(wl_compositor_interface);
     RETRIEVE_WL_CLIENT_SYMBOL(wl_registry_interface);
     RETRIEVE_WL_CLIENT_SYMBOL(wl_shell_interface);
@@ -102,8 +103,18 @@ wayland_wrapper_init(void)
     RETRIEVE_WL_CLIENT_SYMBOL(wl_display_connect);
     RETRIEVE_WL_CLIENT_SYMBOL(wl_display_disconnect);
     RETRIEVE_WL_CLIENT_SYMBOL(wl_display_roundtrip);
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_display_get_fd);
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_display_flush);
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_display_dispatch_pending);
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_display_dispatch_queue_pending);
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_display_prepare_read_queue);
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_display_read_events);
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_display_cancel_read);
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_display_create_queue);
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_event_queue_destroy);
     RETRIEVE_WL_CLIENT_SYMBOL(wl_proxy_destroy);
     RETRIEVE_WL_CLIENT_SYMBOL(wl_proxy_add_listener);
+    RETRIEVE_WL_CLIENT_SYMBOL(wl_proxy_set_queue);
     RETRIEVE_WL_CLIENT_SYMBOL(wl_proxy_marshal);
     RETRIEVE_WL_CLIENT_SYMBOL(wl_proxy_marshal_constructor);
 #if WAYLAND_VERSION_MAJOR == 1 && \
@@ -29,6 +29,7 @@
 #include <windows.h>
 
 #include "wcore_config_attrs.h"
+#include "wcore_config_rank.h"
 #include "wcore_error.h"
 
 #include "wgl_config.h"
@@ -79,6 +80,34 @@ wgl_config_check_context_attrs(struct wgl_display *dpy,
         return false;
     }
 
+    if (attrs->context_no_error && !dpy->ARB_create_context_no_error) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "WGL_ARB_create_context_no_error is required in order to "
+                     "request a no-error context");
+        return false;
+    }
+
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE &&
+        !dpy->ARB_context_flush_control) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "WGL_ARB_context_flush_control is required in order to "
+                     "request WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE");
+        return false;
+    }
+
+    if (attrs->no_config) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "WGL does not support WAFFLE_NO_CONFIG");
+        return false;
+    }
+
+    if (wcore_config_rank_needed(attrs)) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "WGL does not support WAFFLE_CONFIG_RANKING or "
+                     "WAFFLE_SAMPLES_FALLBACK");
+        return false;
+    }
+
     switch (attrs->context_api) {
         case WAFFLE_CONTEXT_OPENGL:
             if (wgl_context_needs_arb_create_context(attrs) &&
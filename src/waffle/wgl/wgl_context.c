@@ -35,6 +35,16 @@
 #include "wgl_error.h"
 #include "wgl_window.h"
 
+// Older wglext.h lack the definition.
+#ifndef WGL_CONTEXT_OPENGL_NO_ERROR_ARB
+#define WGL_CONTEXT_OPENGL_NO_ERROR_ARB 0x31B3
+#endif
+
+#ifndef WGL_ARB_context_flush_control
+#define WGL_CONTEXT_RELEASE_BEHAVIOR_ARB 0x2097
+#define WGL_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB 0
+#endif
+
 bool
 wgl_context_destroy(struct wcore_context *wc_self)
 {
@@ -139,6 +149,16 @@ wgl_context_fill_attrib_list(struct wgl_config *config,
         context_flags |= WGL_CONTEXT_ROBUST_ACCESS_BIT_ARB;
     }
 
+    if (attrs->context_no_error) {
+        attrib_list[i++] = WGL_CONTEXT_OPENGL_NO_ERROR_ARB;
+        attrib_list[i++] = TRUE;
+    }
+
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE) {
+        attrib_list[i++] = WGL_CONTEXT_RELEASE_BEHAVIOR_ARB;
+        attrib_list[i++] = WGL_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB;
+    }
+
     if (context_flags != 0) {
         attrib_list[i++] = WGL_CONTEXT_FLAGS_ARB;
         attrib_list[i++] = context_flags;
@@ -160,9 +180,11 @@ wgl_context_create_native(struct wgl_config *config,
     // - OpenGL version 1.0, or
     // - OpenGL version 3.2 or greater, or
     // - OpenGL with fwd_compat, or
-    // - Debug context
+    // - Debug context, or
+    // - No-error context, or
+    // - Context with a non-default release behavior
     //
-    // The first one of the four is optional, the remainder hard requirement
+    // The first one of the six is optional, the remainder hard requirement
     // for the use of ARB_create_context.
     if (dpy->ARB_create_context &&
         (wcore_config_attrs_version_eq(&config->wcore.attrs, 10) ||
@@ -134,6 +134,7 @@ wgl_display_set_extensions(struct wgl_display *dpy)
 {
     typedef const char * (__stdcall *PFNWGLGETEXTENSIONSSTRINGARBPROC)(HDC hdc);
     PFNWGLGETEXTENSIONSSTRINGARBPROC wglGetExtensionsStringARB_func;
+    struct wcore_ext_set *set = &dpy->wcore.extensions;
     const char *extensions;
 
     wglGetExtensionsStringARB_func = (void *)wglGetProcAddress("wglGetExtensionsStringARB");
@@ -151,10 +152,15 @@ wgl_display_set_extensions(struct wgl_display *dpy)
         return false;
     }
 
-    dpy->ARB_create_context                     = waffle_is_extension_in_string(extensions, "WGL_ARB_create_context");
-    dpy->ARB_create_context_profile             = waffle_is_extension_in_string(extensions, "WGL_ARB_create_context_profile");
-    dpy->ARB_create_context_robustness          = waffle_is_extension_in_string(extensions, "WGL_ARB_create_context_robustness");
-    dpy->EXT_create_context_es_profile          = waffle_is_extension_in_string(extensions, "WGL_EXT_create_context_es_profile");
+    if (!wcore_ext_set_add_string(set, extensions))
+        return false;
+
+    dpy->ARB_create_context                     = wcore_ext_set_has(set, "WGL_ARB_create_context");
+    dpy->ARB_create_context_profile             = wcore_ext_set_has(set, "WGL_ARB_create_context_profile");
+    dpy->ARB_create_context_robustness          = wcore_ext_set_has(set, "WGL_ARB_create_context_robustness");
+    dpy->ARB_create_context_no_error            = wcore_ext_set_has(set, "WGL_ARB_create_context_no_error");
+    dpy->ARB_context_flush_control              = wcore_ext_set_has(set, "WGL_ARB_context_flush_control");
+    dpy->EXT_create_context_es_profile          = wcore_ext_set_has(set, "WGL_EXT_create_context_es_profile");
 
     // The WGL_EXT_create_context_es2_profile spec, version 5 2012/04/06,
     // states that WGL_EXT_create_context_es_profile is an alias of
@@ -167,10 +173,10 @@ wgl_display_set_extensions(struct wgl_display *dpy)
     else {
         // Assume that WGL does not implement version 3 of the extension, in
         // which case the ES contexts WGL is capable of creating is ES2.
-        dpy->EXT_create_context_es2_profile = waffle_is_extension_in_string(extensions, "WGL_EXT_create_context_es2_profile");
+        dpy->EXT_create_context_es2_profile = wcore_ext_set_has(set, "WGL_EXT_create_context_es2_profile");
     }
 
-    dpy->ARB_pixel_format = waffle_is_extension_in_string(extensions, "WGL_ARB_pixel_format");
+    dpy->ARB_pixel_format = wcore_ext_set_has(set, "WGL_ARB_pixel_format");
 
     return true;
 }
@@ -56,6 +56,8 @@ struct wgl_display {
     bool ARB_create_context;
     bool ARB_create_context_profile;
     bool ARB_create_context_robustness;
+    bool ARB_create_context_no_error;
+    bool ARB_context_flush_control;
     bool EXT_create_context_es_profile;
     bool EXT_create_context_es2_profile;
     bool ARB_pixel_format;
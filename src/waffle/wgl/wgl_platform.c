@@ -104,6 +104,10 @@ wgl_platform_create(void)
     if (!ok)
         goto error;
 
+    // wglGetProcAddress() returns pointers that are valid only for contexts
+    // of the current context's pixel format.
+    self->wcore.proc_address_is_context_dependent = true;
+
     ok = wgl_platform_register_class(wfl_class_name);
     if (!ok)
         goto error;
@@ -51,6 +51,25 @@ x11_dummy_error_handler(Display *dpy, XErrorEvent *err)
     return 0;
 }
 
+/// @brief Error code caught by x11_capture_error_handler(), or Success.
+static inline int*
+x11_captured_error(void)
+{
+    static int error_code;
+    return &error_code;
+}
+
+/// @brief Like x11_dummy_error_handler(), but record the error code.
+///
+/// Xlib reports errors asynchronously, so a wrapper that installs this
+/// handler must call XSync() before it restores the old one.
+static inline int
+x11_capture_error_handler(Display *dpy, XErrorEvent *err)
+{
+    *x11_captured_error() = err->error_code;
+    return 0;
+}
+
 static inline Display*
 wrapped_XOpenDisplay(const char *name)
 {
@@ -29,6 +29,7 @@
 
 #include "wegl_config.h"
 #include "wegl_context.h"
+#include "wegl_fence.h"
 #include "wegl_platform.h"
 #include "wegl_util.h"
 
@@ -138,6 +139,7 @@ static const struct wcore_platform_vtbl xegl_platform_vtbl = {
     .destroy = xegl_platform_destroy,
 
     .make_current = wegl_make_current,
+    .is_current = wegl_is_current,
     .get_proc_address = wegl_get_proc_address,
     .dl_can_open = xegl_dl_can_open,
     .dl_sym = xegl_dl_sym,
@@ -146,18 +148,22 @@ static const struct wcore_platform_vtbl xegl_platform_vtbl = {
         .connect = xegl_display_connect,
         .destroy = xegl_display_destroy,
         .supports_context_api = wegl_display_supports_context_api,
+        .query_renderer = wegl_display_query_renderer,
         .get_native = xegl_display_get_native,
     },
 
     .config = {
         .choose = wegl_config_choose,
         .destroy = wegl_config_destroy,
+        .enumerate = wegl_config_enumerate,
+        .query = wegl_config_query,
         .get_native = xegl_config_get_native,
     },
 
     .context = {
         .create = wegl_context_create,
         .destroy = wegl_context_destroy,
+        .query = wegl_context_query,
         .get_native = xegl_context_get_native,
     },
 
@@ -167,6 +173,18 @@ static const struct wcore_platform_vtbl xegl_platform_vtbl = {
         .show = xegl_window_show,
         .resize = xegl_window_resize,
         .swap_buffers = wegl_surface_swap_buffers,
+        .swap_buffers_with_damage = wegl_surface_swap_buffers_with_damage,
+        .get_buffer_age = wegl_surface_get_buffer_age,
+        .set_damage_region = wegl_surface_set_damage_region,
+        .set_swap_interval = wegl_surface_set_swap_interval,
         .get_native = xegl_window_get_native,
     },
+
+    .fence = {
+        .create = wegl_fence_create,
+        .destroy = wegl_fence_destroy,
+        .check_display = wegl_fence_check_display,
+        .client_wait = wegl_fence_client_wait,
+        .server_wait = wegl_fence_server_wait,
+    },
 };
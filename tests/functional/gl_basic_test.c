@@ -51,6 +51,7 @@
 
 #include <cmocka.h>
 #include "waffle.h"
+#include "waffle_gl_dispatch.h"
 
 #include "gl_basic_cocoa.h"
 
@@ -78,6 +79,14 @@ struct test_state_gl_basic {
     struct waffle_window *window;
     struct waffle_context *ctx;
 
+    // Used only by the no_config tests.
+    struct waffle_config *ctx_config;
+    struct waffle_config *config2;
+    struct waffle_window *window2;
+
+    // Used only by the fence tests.
+    struct waffle_context *ctx2;
+
     uint8_t actual_pixels[4 * WINDOW_WIDTH * WINDOW_HEIGHT];
     uint8_t expect_pixels[4 * WINDOW_WIDTH * WINDOW_HEIGHT];
 };
@@ -115,6 +124,7 @@ typedef double              GLclampd;   /* double precision float in [0,1] */
 
 #define GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT 0x00000001
 #define GL_CONTEXT_FLAG_DEBUG_BIT              0x00000002
+#define GL_CONTEXT_FLAG_NO_ERROR_BIT           0x00000008
 
 #ifndef _WIN32
 #define APIENTRY
@@ -132,6 +142,7 @@ static void (APIENTRY *glClearColor)(GLclampf red,
                                      GLclampf blue,
                                      GLclampf alpha);
 static void (APIENTRY *glClear)(GLbitfield mask);
+static void (APIENTRY *glFlush)(void);
 static void (APIENTRY *glReadPixels)(GLint x, GLint y,
                                      GLsizei width, GLsizei height,
                                      GLenum format, GLenum type,
@@ -202,7 +213,7 @@ get_gl_symbol(enum waffle_enum context_api, const char *name)
 }
 
 static int
-gl_basic_init(void **state, int32_t waffle_platform)
+gl_basic_init(void **state, int32_t waffle_platform, bool gl_dispatch)
 {
     struct test_state_gl_basic *ts;
     int ret;
@@ -213,6 +224,7 @@ gl_basic_init(void **state, int32_t waffle_platform)
 
     const int32_t init_attrib_list[] = {
         WAFFLE_PLATFORM, waffle_platform,
+        WAFFLE_GL_DISPATCH, gl_dispatch,
         0,
     };
 
@@ -236,10 +248,18 @@ gl_basic_fini(void **state)
     // XXX: return immediately on error or attempt to finish the teardown ?
     if (ts->dpy) // XXX: keep track if we've had current ctx ?
         ret = waffle_make_current(ts->dpy, NULL, NULL);
+    if (ts->window2)
+        ret = waffle_window_destroy(ts->window2);
     if (ts->window)
         ret = waffle_window_destroy(ts->window);
+    if (ts->ctx2)
+        ret = waffle_context_destroy(ts->ctx2);
     if (ts->ctx)
         ret = waffle_context_destroy(ts->ctx);
+    if (ts->config2)
+        ret = waffle_config_destroy(ts->config2);
+    if (ts->ctx_config)
+        ret = waffle_config_destroy(ts->ctx_config);
     if (ts->config)
         ret = waffle_config_destroy(ts->config);
     if (ts->dpy)
@@ -260,7 +280,19 @@ gl_basic_fini(void **state)
         .profile = WAFFLE_DONT_CARE, \
         .forward_compatible = false, \
         .debug = false, \
+        .no_error = false, \
+        .priority = WAFFLE_DONT_CARE, \
         .alpha = false, \
+        .damage = false, \
+        .surfaceless = false, \
+        .no_config = false, \
+        .ranked = false, \
+        .async = false, \
+        .async_present = false, \
+        .msaa = false, \
+        .max_frames = false, \
+        .fence = false, \
+        .dispatch = false, \
         .expect_error = WAFFLE_NO_ERROR, \
         __VA_ARGS__ \
         })
@@ -269,10 +301,22 @@ struct gl_basic_draw_args__ {
     int32_t api;
     int32_t version;
     int32_t profile;
+    int32_t priority;
     int32_t expect_error;
     bool forward_compatible;
     bool debug;
+    bool no_error;
     bool alpha;
+    bool damage;
+    bool surfaceless;
+    bool no_config;
+    bool ranked;
+    bool async;
+    bool async_present;
+    bool msaa;
+    bool max_frames;
+    bool fence;
+    bool dispatch;
 };
 
 static void
@@ -285,7 +329,19 @@ gl_basic_draw__(void **state, struct gl_basic_draw_args__ args)
     int32_t expect_error = args.expect_error;
     bool context_forward_compatible = args.forward_compatible;
     bool context_debug = args.debug;
+    bool context_no_error = args.no_error;
+    int32_t context_priority = args.priority;
     bool alpha = args.alpha;
+    bool damage = args.damage;
+    bool surfaceless = args.surfaceless;
+    bool no_config = args.no_config;
+    bool ranked = args.ranked;
+    bool async = args.async;
+    bool async_present = args.async_present;
+    bool msaa = args.msaa;
+    bool max_frames = args.max_frames;
+    bool fence = args.fence;
+    bool dispatch = args.dispatch;
 
     int32_t config_attrib_list[64];
     int i;
@@ -296,6 +352,26 @@ gl_basic_draw__(void **state, struct gl_basic_draw_args__ args)
         0,
     };
 
+    const intptr_t async_present_window_attrib_list[] = {
+        WAFFLE_WINDOW_WIDTH,                WINDOW_WIDTH,
+        WAFFLE_WINDOW_HEIGHT,               WINDOW_HEIGHT,
+        WAFFLE_WINDOW_ASYNC_PRESENT,        true,
+        WAFFLE_WINDOW_PRESENT_QUEUE_DEPTH,  2,
+        0,
+    };
+
+    const intptr_t max_frames_window_attrib_list[] = {
+        WAFFLE_WINDOW_WIDTH,                    WINDOW_WIDTH,
+        WAFFLE_WINDOW_HEIGHT,                   WINDOW_HEIGHT,
+        WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT,     1,
+        0,
+    };
+
+    const intptr_t surfaceless_window_attrib_list[] = {
+        WAFFLE_WINDOW_SURFACELESS,  true,
+        0,
+    };
+
     i = 0;
     config_attrib_list[i++] = WAFFLE_CONTEXT_API;
     config_attrib_list[i++] = waffle_context_api;
@@ -317,6 +393,14 @@ gl_basic_draw__(void **state, struct gl_basic_draw_args__ args)
         config_attrib_list[i++] = WAFFLE_CONTEXT_DEBUG;
         config_attrib_list[i++] = true;
     }
+    if (context_no_error) {
+        config_attrib_list[i++] = WAFFLE_CONTEXT_NO_ERROR;
+        config_attrib_list[i++] = true;
+    }
+    if (context_priority != WAFFLE_DONT_CARE) {
+        config_attrib_list[i++] = WAFFLE_CONTEXT_PRIORITY;
+        config_attrib_list[i++] = context_priority;
+    }
     config_attrib_list[i++] = WAFFLE_RED_SIZE;
     config_attrib_list[i++] = 8;
     config_attrib_list[i++] = WAFFLE_GREEN_SIZE;
@@ -325,11 +409,51 @@ gl_basic_draw__(void **state, struct gl_basic_draw_args__ args)
     config_attrib_list[i++] = 8;
     config_attrib_list[i++] = WAFFLE_ALPHA_SIZE;
     config_attrib_list[i++] = alpha;
+    if (ranked) {
+        // Few platforms have 16 samples, so this usually falls back.
+        config_attrib_list[i++] = WAFFLE_CONFIG_RANKING;
+        config_attrib_list[i++] = WAFFLE_CONFIG_PREFER_SMALLEST;
+        config_attrib_list[i++] = WAFFLE_SAMPLES;
+        config_attrib_list[i++] = 16;
+        config_attrib_list[i++] = WAFFLE_SAMPLES_FALLBACK;
+        config_attrib_list[i++] = true;
+    }
+    if (msaa) {
+        config_attrib_list[i++] = WAFFLE_SAMPLE_BUFFERS;
+        config_attrib_list[i++] = 1;
+        config_attrib_list[i++] = WAFFLE_SAMPLES;
+        config_attrib_list[i++] = 4;
+    }
     config_attrib_list[i++] = 0;
 
     // Create objects.
     assert_true(ts->dpy = waffle_display_connect(NULL));
 
+    if (ranked) {
+        struct waffle_config *configs[4];
+        int32_t num_configs = -1;
+
+        if (waffle_config_enumerate(ts->dpy, config_attrib_list,
+                                    NULL, 0, &num_configs)) {
+            assert_true(num_configs >= 0);
+            assert_true(waffle_config_enumerate(ts->dpy, config_attrib_list,
+                                                configs, 4, &num_configs));
+            assert_true(num_configs >= 0 && num_configs <= 4);
+
+            for (int32_t j = 0; j < num_configs; ++j) {
+                intptr_t red = 0;
+
+                assert_true(waffle_config_query(configs[j], WAFFLE_RED_SIZE,
+                                                &red));
+                assert_true(red >= 8);
+                assert_true(waffle_config_destroy(configs[j]));
+            }
+        } else {
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+    }
+
     ts->config = waffle_config_choose(ts->dpy, config_attrib_list);
     if (expect_error) {
         assert_true(ts->config == NULL);
@@ -348,10 +472,100 @@ gl_basic_draw__(void **state, struct gl_basic_draw_args__ args)
         }
     }
 
-    assert_true(ts->window = waffle_window_create2(ts->config, window_attrib_list));
+    if (ranked) {
+        intptr_t samples = -1;
+
+        if (waffle_config_query(ts->config, WAFFLE_SAMPLES, &samples)) {
+            assert_true(samples >= 0 && samples <= 16);
+        } else {
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+    }
+
+    if (surfaceless) {
+        ts->window = waffle_window_create2(ts->config,
+                                           surfaceless_window_attrib_list);
+        if (ts->window == NULL) {
+            switch (waffle_error_get_code()) {
+            case WAFFLE_ERROR_BAD_ATTRIBUTE:
+                // The platform does not know the attribute.
+            case WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM:
+                // EGL_KHR_surfaceless_context is missing.
+                skip();
+            default:
+                assert_true(0);
+            }
+        }
+    } else if (async_present && msaa) {
+        // The present thread cannot blit to a multisampled surface.
+        assert_null(waffle_window_create2(ts->config,
+                                          async_present_window_attrib_list));
+        assert_int_equal(waffle_error_get_code(),
+                         WAFFLE_ERROR_BAD_ATTRIBUTE);
+        return;
+    } else if (async_present) {
+        ts->window = waffle_window_create2(ts->config,
+                                           async_present_window_attrib_list);
+        if (ts->window == NULL) {
+            // GLX can't be used from a present thread.
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+            skip();
+        }
+    } else if (max_frames) {
+        ts->window = waffle_window_create2(ts->config,
+                                           max_frames_window_attrib_list);
+        if (ts->window == NULL) {
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+            skip();
+        }
+    } else {
+        assert_true(ts->window = waffle_window_create2(ts->config,
+                                                       window_attrib_list));
+    }
     assert_true(waffle_window_show(ts->window));
 
-    ts->ctx = waffle_context_create(ts->config, NULL);
+    if (no_config) {
+        // The context is created without a config and must still drive
+        // the window.
+        const int32_t ctx_config_attrib_list[] = {
+            WAFFLE_CONTEXT_API,     waffle_context_api,
+            WAFFLE_NO_CONFIG,       true,
+            0,
+        };
+
+        ts->ctx_config = waffle_config_choose(ts->dpy, ctx_config_attrib_list);
+        if (ts->ctx_config == NULL) {
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+            skip();
+        }
+
+        // Such a config has no format to give a window.
+        assert_null(waffle_window_create2(ts->ctx_config, window_attrib_list));
+        assert_int_equal(waffle_error_get_code(), WAFFLE_ERROR_BAD_PARAMETER);
+    }
+
+    if (async) {
+        struct waffle_context_future *future =
+            waffle_context_create_async(ts->config, NULL);
+        if (future == NULL) {
+            // GLX can't be used from Waffle's worker thread.
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+            skip();
+        }
+
+        // Polling must not block, whatever the answer.
+        waffle_context_future_is_ready(future);
+        ts->ctx = waffle_context_future_wait(future);
+    } else {
+        ts->ctx = waffle_context_create(no_config ? ts->ctx_config
+                                                  : ts->config,
+                                        NULL);
+    }
     if (ts->ctx == NULL) {
         switch (waffle_error_get_code()) {
         case WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM:
@@ -365,20 +579,82 @@ gl_basic_draw__(void **state, struct gl_basic_draw_args__ args)
         }
     }
 
+    if (context_priority != WAFFLE_DONT_CARE) {
+        // The priority is a hint, so any level may have been granted.
+        intptr_t granted = 0;
+
+        if (waffle_context_query(ts->ctx, WAFFLE_CONTEXT_PRIORITY, &granted)) {
+            assert_true(granted == WAFFLE_CONTEXT_PRIORITY_LOW ||
+                        granted == WAFFLE_CONTEXT_PRIORITY_MEDIUM ||
+                        granted == WAFFLE_CONTEXT_PRIORITY_HIGH);
+        } else {
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+    }
+
     // Get OpenGL functions.
     assert_true(glClear         = get_gl_symbol(waffle_context_api, "glClear"));
     assert_true(glClearColor    = get_gl_symbol(waffle_context_api, "glClearColor"));
+    assert_true(glFlush         = get_gl_symbol(waffle_context_api, "glFlush"));
     assert_true(glGetError      = get_gl_symbol(waffle_context_api, "glGetError"));
     assert_true(glGetIntegerv   = get_gl_symbol(waffle_context_api, "glGetIntegerv"));
     assert_true(glReadPixels    = get_gl_symbol(waffle_context_api, "glReadPixels"));
     assert_true(glGetString     = get_gl_symbol(waffle_context_api, "glGetString"));
 
-    assert_true(waffle_make_current(ts->dpy, ts->window, ts->ctx));
+    if (async_present) {
+        intptr_t value = -1;
+
+        if (!waffle_make_current(ts->dpy, ts->window, ts->ctx)) {
+            // The present thread needs GL 3.2 or ES 3.0 and a context
+            // that can be bound without a surface.
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+            skip();
+        }
+
+        // Rendering is redirected to a framebuffer owned by Waffle.
+        assert_true(waffle_window_query(ts->window,
+                                        WAFFLE_WINDOW_FRAMEBUFFER, &value));
+        assert_true(value != 0);
+        assert_true(waffle_window_query(ts->window,
+                                        WAFFLE_WINDOW_PRESENT_QUEUE_DEPTH,
+                                        &value));
+        assert_int_equal(value, 2);
+
+        // The window holds on to the context until it is destroyed.
+        assert_false(waffle_context_destroy(ts->ctx));
+        assert_int_equal(waffle_error_get_code(), WAFFLE_ERROR_BAD_PARAMETER);
+    } else if (max_frames) {
+        if (!waffle_make_current(ts->dpy, ts->window, ts->ctx)) {
+            // The context has no fences, which GLX learns only now.
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+            assert_null(waffle_get_current_window());
+            skip();
+        }
+    } else {
+        assert_true(waffle_make_current(ts->dpy, ts->window, ts->ctx));
+    }
 
     assert_true(waffle_get_current_display() == ts->dpy);
     assert_true(waffle_get_current_window() == ts->window);
     assert_true(waffle_get_current_context() == ts->ctx);
 
+    // The dispatch table must resolve at least what get_gl_symbol() found.
+    const struct waffle_gl_dispatch *gl = waffle_get_current_dispatch();
+    if (dispatch) {
+        assert_true(gl != NULL);
+        assert_true(gl->Clear != NULL);
+        assert_true(gl->ClearColor != NULL);
+        assert_true(gl->GetError != NULL);
+        assert_true(gl->GetIntegerv != NULL);
+        assert_true(gl->ReadPixels != NULL);
+        assert_true(gl->GetString != NULL);
+    } else {
+        assert_true(gl == NULL);
+    }
+
     const char *version_str;
     int major, minor, count;
 
@@ -398,7 +674,7 @@ gl_basic_draw__(void **state, struct gl_basic_draw_args__ args)
     if ((waffle_context_api == WAFFLE_CONTEXT_OPENGL && version_10x >= 30) ||
         (waffle_context_api != WAFFLE_CONTEXT_OPENGL && version_10x >= 32)) {
         GLint context_flags = 0;
-        if (context_forward_compatible || context_debug) {
+        if (context_forward_compatible || context_debug || context_no_error) {
             glGetIntegerv(GL_CONTEXT_FLAGS, &context_flags);
         }
 
@@ -409,6 +685,49 @@ gl_basic_draw__(void **state, struct gl_basic_draw_args__ args)
         if (context_debug) {
             assert_true(context_flags & GL_CONTEXT_FLAG_DEBUG_BIT);
         }
+
+        if (context_no_error) {
+            assert_true(context_flags & GL_CONTEXT_FLAG_NO_ERROR_BIT);
+        }
+    }
+
+    // Declare the damage before rendering, as EGL_KHR_partial_update
+    // requires.
+    const int32_t rect[4] = { 0, 0, WINDOW_WIDTH, WINDOW_HEIGHT };
+    bool has_damage = false;
+
+    if (damage) {
+        int32_t age = -1;
+
+        has_damage = waffle_window_get_buffer_age(ts->window, &age);
+        if (has_damage) {
+            assert_true(age >= 0);
+            assert_true(waffle_window_set_damage_region(ts->window, rect, 1));
+
+            // The region may be set only once per frame.
+            assert_false(waffle_window_set_damage_region(ts->window, rect, 1));
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_BAD_PARAMETER);
+        } else {
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+    }
+
+    if (surfaceless) {
+        // There is no default framebuffer to draw to or read from, but the
+        // window must behave like any other, and a context made current
+        // with it may also be made current with no window at all.
+        int32_t age = -1;
+
+        assert_true(waffle_window_get_buffer_age(ts->window, &age));
+        assert_int_equal(age, 0);
+        assert_true(waffle_window_swap_buffers(ts->window));
+
+        assert_true(waffle_make_current(ts->dpy, NULL, ts->ctx));
+        assert_true(waffle_get_current_window() == NULL);
+        ASSERT_GL(glGetString(GL_VERSION));
+        return;
     }
 
     // Draw.
@@ -417,10 +736,122 @@ gl_basic_draw__(void **state, struct gl_basic_draw_args__ args)
     ASSERT_GL(glReadPixels(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT,
                            GL_RGBA, GL_UNSIGNED_BYTE,
                            ts->actual_pixels));
-    assert_true(waffle_window_swap_buffers(ts->window));
+    if (has_damage) {
+        assert_true(waffle_window_swap_buffers_with_damage(ts->window,
+                                                           rect, 1));
+
+        // The swap ends the frame, so the age must be queried again.
+        assert_false(waffle_window_set_damage_region(ts->window, rect, 1));
+        assert_int_equal(waffle_error_get_code(),
+                         WAFFLE_ERROR_BAD_PARAMETER);
+    } else if (max_frames) {
+        intptr_t value = -1;
+
+        // Fences were checked by window creation and make current, so the
+        // swaps must succeed, and later ones wait for the previous frame.
+        assert_true(waffle_window_swap_buffers(ts->window));
+        for (int j = 0; j < 3; ++j) {
+            ASSERT_GL(glClear(GL_COLOR_BUFFER_BIT));
+            assert_true(waffle_window_swap_buffers(ts->window));
+        }
+
+        assert_true(waffle_window_query(ts->window,
+                                        WAFFLE_WINDOW_MAX_FRAMES_IN_FLIGHT,
+                                        &value));
+        assert_int_equal(value, 1);
+    } else {
+        assert_true(waffle_window_swap_buffers(ts->window));
+    }
 
     assert_memory_equal(&ts->actual_pixels, &ts->expect_pixels,
                         sizeof(ts->expect_pixels));
+
+    if (fence) {
+        struct waffle_fence *f = waffle_fence_create(ts->ctx);
+        bool signaled = false;
+        int fd = -1;
+
+        if (f == NULL) {
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+            skip();
+        }
+
+        // Polling may find the fence either way.
+        assert_true(waffle_fence_client_wait(f, 0, &signaled));
+        assert_true(waffle_fence_client_wait(f, UINT64_MAX, &signaled));
+        assert_true(signaled);
+
+        if (!waffle_fence_server_wait(f)) {
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+
+        if (waffle_fence_export_fd(f, &fd)) {
+            struct waffle_fence *f2 = waffle_fence_import_fd(ts->ctx, fd);
+
+            assert_non_null(f2);
+            assert_true(waffle_fence_client_wait(f2, UINT64_MAX, &signaled));
+            assert_true(signaled);
+            assert_true(waffle_fence_destroy(f2));
+        } else {
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+
+        assert_true(waffle_fence_destroy(f));
+
+        // A context that shares with the fence's context waits for it.
+        // The fence must be flushed first, because its context will not
+        // be current to flush it.
+        assert_non_null(f = waffle_fence_create(ts->ctx));
+        ASSERT_GL(glFlush());
+        assert_true(ts->ctx2 = waffle_context_create(ts->config, ts->ctx));
+        assert_true(waffle_make_current(ts->dpy, ts->window, ts->ctx2));
+
+        if (!waffle_fence_server_wait(f)) {
+            assert_int_equal(waffle_error_get_code(),
+                             WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+
+        assert_true(waffle_fence_client_wait(f, UINT64_MAX, &signaled));
+        assert_true(signaled);
+        assert_true(waffle_fence_destroy(f));
+
+        // The fence follows the current context's commands, so another
+        // context cannot be named.
+        assert_true(waffle_make_current(ts->dpy, NULL, NULL));
+        assert_null(waffle_fence_create(ts->ctx));
+        assert_int_equal(waffle_error_get_code(), WAFFLE_ERROR_BAD_PARAMETER);
+    }
+
+    if (no_config) {
+        // Bind the same context to a window of a different format.
+        const int32_t config2_attrib_list[] = {
+            WAFFLE_CONTEXT_API,     waffle_context_api,
+            WAFFLE_RED_SIZE,        8,
+            WAFFLE_GREEN_SIZE,      8,
+            WAFFLE_BLUE_SIZE,       8,
+            WAFFLE_ALPHA_SIZE,      alpha ? 0 : 8,
+            WAFFLE_DEPTH_SIZE,      16,
+            0,
+        };
+
+        assert_true(ts->config2 = waffle_config_choose(ts->dpy,
+                                                       config2_attrib_list));
+        assert_true(ts->window2 = waffle_window_create2(ts->config2,
+                                                        window_attrib_list));
+        assert_true(waffle_make_current(ts->dpy, ts->window2, ts->ctx));
+
+        memset(&ts->actual_pixels, 0x99, sizeof(ts->actual_pixels));
+        ASSERT_GL(glClear(GL_COLOR_BUFFER_BIT));
+        ASSERT_GL(glReadPixels(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT,
+                               GL_RGBA, GL_UNSIGNED_BYTE,
+                               ts->actual_pixels));
+        assert_true(waffle_window_swap_buffers(ts->window2));
+        assert_memory_equal(&ts->actual_pixels, &ts->expect_pixels,
+                            sizeof(ts->expect_pixels));
+    }
 }
 
 //
@@ -462,6 +893,136 @@ static void test_gl_basic_gl_debug(void **state)                        \
                   .expect_error=WAFFLE_##error);                        \
 }
 
+#define test_XX_no_error(context_api, waffle_api, error)                \
+static void test_gl_basic_##context_api##_no_error(void **state)        \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .no_error=true,                                       \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_glXX_no_error(waffle_version, error)                        \
+static void test_gl_basic_gl##waffle_version##_no_error(void **state)   \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_OPENGL,                           \
+                  .version=waffle_version,                              \
+                  .no_error=true,                                       \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_glXX_no_error_debug(waffle_version, error)                  \
+static void test_gl_basic_gl##waffle_version##_no_error_debug(void **state) \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_OPENGL,                           \
+                  .version=waffle_version,                              \
+                  .no_error=true,                                       \
+                  .debug=true,                                          \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_priority_high(context_api, waffle_api, error)           \
+static void test_gl_basic_##context_api##_priority_high(void **state)   \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .priority=WAFFLE_CONTEXT_PRIORITY_HIGH,               \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_damage(context_api, waffle_api, error)                  \
+static void test_gl_basic_##context_api##_damage(void **state)          \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .damage=true,                                         \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_surfaceless(context_api, waffle_api, error)             \
+static void test_gl_basic_##context_api##_surfaceless(void **state)     \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .surfaceless=true,                                    \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_no_config(context_api, waffle_api, error)               \
+static void test_gl_basic_##context_api##_no_config(void **state)       \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .no_config=true,                                      \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_ranked(context_api, waffle_api, error)                  \
+static void test_gl_basic_##context_api##_ranked(void **state)          \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .ranked=true,                                         \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_async(context_api, waffle_api, error)                   \
+static void test_gl_basic_##context_api##_async(void **state)           \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .async=true,                                          \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_async_present(context_api, waffle_api, error)           \
+static void test_gl_basic_##context_api##_async_present(void **state)   \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .async_present=true,                                  \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_async_present_msaa(context_api, waffle_api, error)      \
+static void test_gl_basic_##context_api##_async_present_msaa(void **state) \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .async_present=true,                                  \
+                  .msaa=true,                                           \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_max_frames(context_api, waffle_api, error)              \
+static void test_gl_basic_##context_api##_max_frames(void **state)      \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .max_frames=true,                                     \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_fence(context_api, waffle_api, error)                   \
+static void test_gl_basic_##context_api##_fence(void **state)           \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .fence=true,                                          \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
+#define test_XX_dispatch(context_api, waffle_api, error)                \
+static void test_gl_basic_##context_api##_dispatch(void **state)        \
+{                                                                       \
+    gl_basic_draw(state,                                                \
+                  .api=WAFFLE_CONTEXT_##waffle_api,                     \
+                  .dispatch=true,                                       \
+                  .expect_error=WAFFLE_##error);                        \
+}
+
 #define test_glXX(waffle_version, error)                                \
 static void test_gl_basic_gl##waffle_version(void **state)              \
 {                                                                       \
@@ -527,7 +1088,13 @@ static void test_gl_basic_gles##waffle_version(void **state)            \
 static int                                                              \
 setup_##platform(void **state)                                          \
 {                                                                       \
-    return gl_basic_init(state, waffle_platform);                       \
+    return gl_basic_init(state, waffle_platform, false);                \
+}                                                                       \
+                                                                        \
+static int                                                              \
+setup_##platform##_dispatch(void **state)                               \
+{                                                                       \
+    return gl_basic_init(state, waffle_platform, true);                 \
 }                                                                       \
                                                                         \
 static int                                                              \
@@ -539,6 +1106,7 @@ testsuite_##platform(void)                                              \
         unit_test_make(test_gl_basic_gl_rgba),                          \
         unit_test_make(test_gl_basic_gl_fwdcompat),                     \
         unit_test_make(test_gl_basic_gl_debug),                         \
+        unit_test_make(test_gl_basic_gl_no_error),                      \
                                                                         \
         unit_test_make(test_gl_basic_gl10),                             \
         unit_test_make(test_gl_basic_gl11),                             \
@@ -554,6 +1122,8 @@ testsuite_##platform(void)                                              \
         unit_test_make(test_gl_basic_gl30_fwdcompat),                   \
         unit_test_make(test_gl_basic_gl31),                             \
         unit_test_make(test_gl_basic_gl31_fwdcompat),                   \
+        unit_test_make(test_gl_basic_gl30_no_error),                    \
+        unit_test_make(test_gl_basic_gl30_no_error_debug),              \
                                                                         \
         unit_test_make(test_gl_basic_gl32_core),                        \
         unit_test_make(test_gl_basic_gl32_core_fwdcompat),              \
@@ -573,17 +1143,33 @@ testsuite_##platform(void)                                              \
         unit_test_make(test_gl_basic_gles1_rgb),                        \
         unit_test_make(test_gl_basic_gles1_rgba),                       \
         unit_test_make(test_gl_basic_gles1_fwdcompat),                  \
+        unit_test_make(test_gl_basic_gles1_no_error),                   \
         unit_test_make(test_gl_basic_gles10),                           \
         unit_test_make(test_gl_basic_gles11),                           \
                                                                         \
         unit_test_make(test_gl_basic_gles2_rgb),                        \
         unit_test_make(test_gl_basic_gles2_rgba),                       \
         unit_test_make(test_gl_basic_gles2_fwdcompat),                  \
+        unit_test_make(test_gl_basic_gles2_no_error),                   \
+        unit_test_make(test_gl_basic_gles2_priority_high),              \
+        unit_test_make(test_gl_basic_gles2_damage),                     \
+        unit_test_make(test_gl_basic_gles2_surfaceless),                \
+        unit_test_make(test_gl_basic_gles2_no_config),                  \
+        unit_test_make(test_gl_basic_gles2_ranked),                     \
+        unit_test_make(test_gl_basic_gles2_async),                      \
+        unit_test_make(test_gl_basic_gles2_max_frames),                 \
+        unit_test_make(test_gl_basic_gles2_fence),                      \
+        cmocka_unit_test_setup_teardown(test_gl_basic_gles2_dispatch,   \
+                                        setup_##platform##_dispatch,    \
+                                        gl_basic_fini),                 \
         unit_test_make(test_gl_basic_gles20),                           \
                                                                         \
         unit_test_make(test_gl_basic_gles3_rgb),                        \
         unit_test_make(test_gl_basic_gles3_rgba),                       \
         unit_test_make(test_gl_basic_gles3_fwdcompat),                  \
+        unit_test_make(test_gl_basic_gles3_no_error),                   \
+        unit_test_make(test_gl_basic_gles3_async_present),              \
+        unit_test_make(test_gl_basic_gles3_async_present_msaa),         \
         unit_test_make(test_gl_basic_gles30),                           \
                                                                         \
     };                                                                  \
@@ -613,11 +1199,14 @@ test_glXX_fwdcompat(21, ERROR_BAD_ATTRIBUTE)
 
 test_XX_fwdcompat(gl, OPENGL, ERROR_BAD_ATTRIBUTE)
 test_gl_debug(NO_ERROR)
+test_XX_no_error(gl, OPENGL, ERROR_BAD_ATTRIBUTE)
 
 test_glXX(30, NO_ERROR)
 test_glXX_fwdcompat(30, NO_ERROR)
 test_glXX(31, NO_ERROR)
 test_glXX_fwdcompat(31, NO_ERROR)
+test_glXX_no_error(30, NO_ERROR)
+test_glXX_no_error_debug(30, ERROR_BAD_ATTRIBUTE)
 
 test_glXX_core(32, NO_ERROR)
 test_glXX_core_fwdcompat(32, NO_ERROR)
@@ -638,14 +1227,28 @@ test_XX_rgb(gles1, OPENGL_ES1, NO_ERROR)
 test_XX_rgba(gles1, OPENGL_ES1, NO_ERROR)
 test_glesXX(1, 10, NO_ERROR)
 test_glesXX(1, 11, NO_ERROR)
+test_XX_no_error(gles1, OPENGL_ES1, ERROR_BAD_ATTRIBUTE)
 
 test_XX_rgb(gles2, OPENGL_ES2, NO_ERROR)
 test_XX_rgba(gles2, OPENGL_ES2, NO_ERROR)
 test_glesXX(2, 20, NO_ERROR)
+test_XX_no_error(gles2, OPENGL_ES2, NO_ERROR)
+test_XX_priority_high(gles2, OPENGL_ES2, NO_ERROR)
+test_XX_damage(gles2, OPENGL_ES2, NO_ERROR)
+test_XX_surfaceless(gles2, OPENGL_ES2, NO_ERROR)
+test_XX_no_config(gles2, OPENGL_ES2, NO_ERROR)
+test_XX_ranked(gles2, OPENGL_ES2, NO_ERROR)
+test_XX_async(gles2, OPENGL_ES2, NO_ERROR)
+test_XX_max_frames(gles2, OPENGL_ES2, NO_ERROR)
+test_XX_fence(gles2, OPENGL_ES2, NO_ERROR)
+test_XX_dispatch(gles2, OPENGL_ES2, NO_ERROR)
 
 test_XX_rgb(gles3, OPENGL_ES3, NO_ERROR)
 test_XX_rgba(gles3, OPENGL_ES3, NO_ERROR)
 test_glesXX(3, 30, NO_ERROR)
+test_XX_no_error(gles3, OPENGL_ES3, NO_ERROR)
+test_XX_async_present(gles3, OPENGL_ES3, NO_ERROR)
+test_XX_async_present_msaa(gles3, OPENGL_ES3, NO_ERROR)
 
 //
 // As BAD_ATTRIBUTE takes greater precedence over UNSUPPORTED_ON_PLATFORM,
@@ -656,6 +1259,8 @@ test_glesXX(3, 30, NO_ERROR)
     defined(WAFFLE_HAS_GLX) || \
     defined(WAFFLE_HAS_WAYLAND) || \
     defined(WAFFLE_HAS_X11_EGL) || \
+    defined(WAFFLE_HAS_SURFACELESS_EGL) || \
+    defined(WAFFLE_HAS_EGL_DEVICE) || \
     defined(WAFFLE_HAS_WGL)
 
 test_XX_fwdcompat(gles1, OPENGL_ES1, ERROR_BAD_ATTRIBUTE)
@@ -681,6 +1286,17 @@ CREATE_TESTSUITE(WAFFLE_PLATFORM_CGL, cgl)
 
 #endif // WAFFLE_HAS_CGL
 
+#ifdef WAFFLE_HAS_EGL_DEVICE
+
+#define unit_test_make(name)                                            \
+    cmocka_unit_test_setup_teardown(name, setup_egl_device, gl_basic_fini)
+
+CREATE_TESTSUITE(WAFFLE_PLATFORM_EGL_DEVICE, egl_device)
+
+#undef unit_test_make
+
+#endif // WAFFLE_HAS_EGL_DEVICE
+
 #ifdef WAFFLE_HAS_GBM
 
 #define unit_test_make(name)                                            \
@@ -749,12 +1365,16 @@ CREATE_TESTSUITE(WAFFLE_PLATFORM_WGL, wgl)
 
 #undef test_glesXX
 
+#undef test_glXX_no_error_debug
+#undef test_glXX_no_error
 #undef test_glXX_compat
 #undef test_glXX_core_fwdcompat
 #undef test_glXX_core
 #undef test_glXX_fwdcompat
 #undef test_glXX
 
+#undef test_XX_priority_high
+#undef test_XX_no_error
 #undef test_gl_debug
 #undef test_XX_fwdcompat
 #undef test_XX_rgba
@@ -832,6 +1452,7 @@ static const struct enum_map platform_map[] = {
     {WAFFLE_PLATFORM_X11_EGL,   "x11_egl"       },
     {WAFFLE_PLATFORM_SURFACELESS_EGL,   "surfaceless_egl"   },
     {WAFFLE_PLATFORM_SURFACELESS_EGL,   "sl"                },
+    {WAFFLE_PLATFORM_EGL_DEVICE,        "egl_device"        },
     {0,                         0               },
 };
 
@@ -928,6 +1549,10 @@ main(int argc, char *argv[])
     case WAFFLE_PLATFORM_CGL:
         return testsuite_cgl();
 #endif
+#ifdef WAFFLE_HAS_EGL_DEVICE
+    case WAFFLE_PLATFORM_EGL_DEVICE:
+        return testsuite_egl_device();
+#endif
 #ifdef WAFFLE_HAS_GBM
     case WAFFLE_PLATFORM_GBM:
         return testsuite_gbm();